@@ -0,0 +1,499 @@
+﻿/*    Benchmark/Harness/Runner.cpp    */
+
+#include "Benchmark/Pch.h"
+#include "Benchmark/Harness/Runner.h"
+#include "Core/Concurrency/Thread.h"
+
+using namespace core;
+
+namespace bench
+{
+    namespace
+    {
+        volatile const void* gSink = nullptr;
+
+        String8 EscapeJson(String8View text)
+        {
+            String8 escaped;
+            escaped.reserve(text.size());
+            for (const Char8 ch : text)
+            {
+                if ((ch == '"') || (ch == '\\'))
+                {
+                    escaped.push_back('\\');
+                }
+                escaped.push_back(ch);
+            }
+
+            return escaped;
+        }
+
+        /**
+         * 결과 파일 한 줄에서 필드 값을 찾습니다. (이 하네스가 기록한 형식만 지원)
+         *
+         * @param line JSON 객체 한 줄
+         * @param key 필드 이름
+         * @param value 찾은 값 (문자열이면 따옴표 제외)
+         * @return 필드를 찾았으면 true
+         */
+        Bool FindField(String8View line, String8View key, OUT String8View& value)
+        {
+            const String8 pattern = fmt::format("\"{}\":", key);
+            const auto keyPos = line.find(pattern);
+            if (keyPos == String8View::npos)
+            {
+                return false;
+            }
+
+            Int64 begin = static_cast_64(keyPos + pattern.size());
+            if (line[begin] == '"')
+            {
+                ++begin;
+                const auto end = line.find('"', begin);
+                if (end == String8View::npos)
+                {
+                    return false;
+                }
+                value = line.substr(begin, end - begin);
+                return true;
+            }
+
+            const auto end = line.find_first_of(",}", begin);
+            if (end == String8View::npos)
+            {
+                return false;
+            }
+            value = line.substr(begin, end - begin);
+            return true;
+        }
+
+        String8 MakeResultKey(String8View name, Int32 threadCount)
+        {
+            return fmt::format("{}@{}", name, threadCount);
+        }
+    } // namespace
+
+    void DoNotOptimize(const void* value)
+    {
+        gSink = value;
+    }
+
+    // 프로세스의 사용자 + 커널 CPU 시간 (마이크로초)
+    Int64 GetProcessCpuUs()
+    {
+        FILETIME creationTime;
+        FILETIME exitTime;
+        FILETIME kernelTime;
+        FILETIME userTime;
+        if (!::GetProcessTimes(::GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime))
+        {
+            return 0;
+        }
+
+        auto toUs = [](const FILETIME& time)
+            {
+                return static_cast_64((static_cast<UInt64>(time.dwHighDateTime) << 32) | time.dwLowDateTime) / 10;
+            };
+
+        return toUs(kernelTime) + toUs(userTime);
+    }
+
+    BenchmarkRunner::BenchmarkRunner()
+    {}
+
+    BenchmarkRunner::~BenchmarkRunner()
+    {
+        StopWorkers();
+    }
+
+    void BenchmarkRunner::Add(BenchmarkCase benchmark)
+    {
+        ASSERT_CRASH(benchmark.body != nullptr, "INVALID_BENCHMARK_BODY");
+        mBenchmarks.push_back(std::move(benchmark));
+    }
+
+    /**
+     * 필터에 맞는 모든 벤치마크를 측정합니다.
+     *
+     * @param options 측정 설정
+     * @return 결과 기록과 비교에 성공하고 회귀가 없으면 SUCCESS, 아니면 FAILURE
+     *
+     * 동작:
+     * 1. 필요한 최대 스레드 수만큼 측정 스레드 준비
+     * 2. 벤치마크마다 스레드 수별로 측정하고 결과 출력
+     * 3. 측정 스레드 종료 후 결과 기록 및 비교 (Report)
+     */
+    Int64 BenchmarkRunner::Run(const BenchmarkOptions& options)
+    {
+        Vector<const BenchmarkCase*> selected;
+        Int32 maxThreadCount = 1;
+        for (const BenchmarkCase& benchmark : mBenchmarks)
+        {
+            if (!options.filter.empty() && (benchmark.name.find(options.filter) == String8::npos))
+            {
+                continue;
+            }
+
+            selected.push_back(&benchmark);
+            for (const Int32 threadCount : benchmark.threadCounts)
+            {
+                maxThreadCount = std::max(maxThreadCount, threadCount);
+            }
+        }
+
+        if (selected.empty())
+        {
+            gLogger->Warn(TEXT_8("Benchmark: No benchmark matches filter '{}'"), options.filter);
+            return FAILURE;
+        }
+
+        EnsureWorkers(maxThreadCount);
+
+        Vector<BenchmarkResult> results;
+        for (const BenchmarkCase* benchmark : selected)
+        {
+            for (const Int32 threadCount : benchmark->threadCounts)
+            {
+                const BenchmarkResult result = Measure(*benchmark, threadCount, options);
+                gLogger->Info(TEXT_8("{:<36} threads={:<3} median={:>10.1f} ns/op, min={:>10.1f} ns/op, {:>14.0f} ops/s"),
+                              result.name, result.threadCount, result.medianNsPerOp, result.minNsPerOp, result.opsPerSec);
+                if (result.cpuNsPerOp > 0.0)
+                {
+                    gLogger->Info(TEXT_8("{:<36} threads={:<3} cpu={:>13.1f} ns/op"), result.name, result.threadCount, result.cpuNsPerOp);
+                }
+                if (result.backgroundOpsPerSec > 0.0)
+                {
+                    gLogger->Info(TEXT_8("{:<36} threads={:<3} background={:>14.0f} ops/s"), result.name, result.threadCount, result.backgroundOpsPerSec);
+                }
+                results.push_back(result);
+            }
+        }
+
+        StopWorkers();
+
+        return Report(results, options);
+    }
+
+    /**
+     * 결과를 파일에 기록하고, 기준 파일이 있으면 비교합니다.
+     *
+     * @return 기록과 비교에 성공하고 회귀가 없으면 SUCCESS, 아니면 FAILURE
+     */
+    Int64 BenchmarkRunner::Report(const Vector<BenchmarkResult>& results, const BenchmarkOptions& options)
+    {
+        if (!WriteResults(results, options))
+        {
+            return FAILURE;
+        }
+
+        if (options.baselinePath.empty())
+        {
+            return SUCCESS;
+        }
+
+        return CompareResults(results, options);
+    }
+
+    /**
+     * 벤치마크 하나를 지정한 스레드 수로 반복 측정합니다.
+     *
+     * 첫 실행은 캐시, 풀, 락프리 큐 내부 블록을 데우기 위한 워밍업으로 반복 횟수의 1/10만 실행하고 버립니다.
+     * measureCpu이면 CPU 시간도 중앙값을 기록하며, 완료를 기다리며 양보하는 메인 스레드의 CPU 시간도 포함됩니다.
+     */
+    BenchmarkResult BenchmarkRunner::Measure(const BenchmarkCase& benchmark, Int32 threadCount, const BenchmarkOptions& options)
+    {
+        const Int64 iterations = std::max<Int64>(std::llround(benchmark.iterations * options.iterationScale), 1);
+        const Int32 repetitions = std::max(options.repetitions, 1);
+        const Int32 foregroundCount = std::max(threadCount - benchmark.backgroundThreadCount, 1);
+
+        RunOnce(benchmark, threadCount, std::max<Int64>(iterations / 10, 1));
+
+        Vector<Float64> nsPerOps;
+        Vector<Float64> cpuNsPerOps;
+        Vector<Float64> backgroundOpsPerSecs;
+        nsPerOps.reserve(repetitions);
+        for (Int32 i = 0; i < repetitions; ++i)
+        {
+            const Int64 beginCpuUs = benchmark.measureCpu ? GetProcessCpuUs() : 0;
+            const Int64 elapsedNs = RunOnce(benchmark, threadCount, iterations);
+            nsPerOps.push_back(static_cast<Float64>(elapsedNs) / iterations);
+
+            if (benchmark.measureCpu)
+            {
+                const Int64 cpuUs = GetProcessCpuUs() - beginCpuUs;
+                cpuNsPerOps.push_back(cpuUs * 1'000.0 / (static_cast<Float64>(iterations) * foregroundCount));
+            }
+
+            if (benchmark.takeBackgroundOps && (elapsedNs > 0))
+            {
+                backgroundOpsPerSecs.push_back(benchmark.takeBackgroundOps() * 1e9 / elapsedNs);
+            }
+        }
+        std::sort(nsPerOps.begin(), nsPerOps.end());
+        std::sort(cpuNsPerOps.begin(), cpuNsPerOps.end());
+        std::sort(backgroundOpsPerSecs.begin(), backgroundOpsPerSecs.end());
+
+        BenchmarkResult result;
+        result.name = benchmark.name;
+        result.threadCount = threadCount;
+        result.iterations = iterations;
+        result.repetitions = repetitions;
+        result.minNsPerOp = nsPerOps.front();
+        result.medianNsPerOp = nsPerOps[nsPerOps.size() / 2];
+        result.opsPerSec = (result.medianNsPerOp > 0.0) ? (foregroundCount * 1e9 / result.medianNsPerOp) : 0.0;
+        result.cpuNsPerOp = cpuNsPerOps.empty() ? 0.0 : cpuNsPerOps[cpuNsPerOps.size() / 2];
+        result.backgroundOpsPerSec = backgroundOpsPerSecs.empty() ? 0.0 : backgroundOpsPerSecs[backgroundOpsPerSecs.size() / 2];
+
+        return result;
+    }
+
+    /**
+     * 측정 스레드들로 body를 한 번 실행하고 경과 시간을 반환합니다.
+     *
+     * @return 모든 스레드가 출발한 시점부터 마지막 스레드가 끝난 시점까지의 시간(나노초)
+     *
+     * 동작:
+     * 1. setUp 호출 후 실행할 body와 스레드 수를 게시하고 측정 스레드를 깨움
+     * 2. 참여하는 스레드가 모두 준비될 때까지 스핀 대기 (스레드 기상 지연 제외)
+     * 3. 출발 신호를 보낸 뒤 모든 스레드가 끝날 때까지 양보하며 대기
+     * 4. tearDown 호출
+     */
+    Int64 BenchmarkRunner::RunOnce(const BenchmarkCase& benchmark, Int32 threadCount, Int64 iterations)
+    {
+        ASSERT_CRASH(threadCount <= mWorkerCount, "NOT_ENOUGH_BENCHMARK_WORKERS");
+
+        if (benchmark.setUp)
+        {
+            benchmark.setUp(threadCount);
+        }
+
+        {
+            SrwLockWriteGuard guard(mLock);
+
+            mBody = &benchmark.body;
+            mActiveCount = threadCount;
+            mIterations = iterations;
+            mReadyCount.store(0);
+            mDoneCount.store(0);
+            mStarted.store(false);
+            ++mGeneration;
+        }
+        ::WakeAllConditionVariable(&mCondVar);
+
+        while (mReadyCount.load() < threadCount)
+        {
+            _mm_pause();
+        }
+
+        const auto begin = std::chrono::steady_clock::now();
+        mStarted.store(true);
+
+        while (mDoneCount.load() < threadCount)
+        {
+            std::this_thread::yield();
+        }
+        const auto end = std::chrono::steady_clock::now();
+
+        if (benchmark.tearDown)
+        {
+            benchmark.tearDown();
+        }
+
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+    }
+
+    void BenchmarkRunner::EnsureWorkers(Int32 threadCount)
+    {
+        for (; mWorkerCount < threadCount; ++mWorkerCount)
+        {
+            const Int32 index = mWorkerCount;
+            gThreadManager->Launch(ThreadRole::General, [this, index]
+                                   {
+                                       RunWorker(index);
+                                   });
+        }
+    }
+
+    void BenchmarkRunner::StopWorkers()
+    {
+        if (mWorkerCount == 0)
+        {
+            return;
+        }
+
+        {
+            SrwLockWriteGuard guard(mLock);
+            mStopping = true;
+        }
+        ::WakeAllConditionVariable(&mCondVar);
+
+        gThreadManager->Join(ThreadRole::General);
+        mWorkerCount = 0;
+        mStopping = false;
+    }
+
+    /**
+     * 측정 스레드의 메인 루프입니다.
+     *
+     * 동작:
+     * 1. 새 실행(mGeneration 변경) 또는 종료 요청까지 조건 변수로 대기
+     * 2. 자신의 인덱스가 참여 스레드 수 이상이면 다음 실행까지 다시 대기
+     * 3. 준비 완료를 알리고 출발 신호까지 스핀 대기
+     * 4. body 실행 후 완료를 알림
+     */
+    void BenchmarkRunner::RunWorker(Int32 index)
+    {
+        Int64 seenGeneration = 0;
+        while (true)
+        {
+            const Function<void(Int32, Int64)>* body = nullptr;
+            Int64 iterations = 0;
+            {
+                SrwLockWriteGuard guard(mLock);
+
+                while (!mStopping && (mGeneration == seenGeneration))
+                {
+                    BOOL result = ::SleepConditionVariableSRW(&mCondVar, &mLock, INFINITE, 0);
+                }
+
+                if (mStopping)
+                {
+                    return;
+                }
+
+                seenGeneration = mGeneration;
+                if (index >= mActiveCount)
+                {
+                    continue;
+                }
+
+                body = mBody;
+                iterations = mIterations;
+            }
+
+            mReadyCount.fetch_add(1);
+            while (!mStarted.load())
+            {
+                _mm_pause();
+            }
+
+            (*body)(index, iterations);
+
+            mDoneCount.fetch_add(1);
+        }
+    }
+
+    /**
+     * 결과를 JSON Lines 형식으로 기록합니다.
+     *
+     * 한 줄에 결과 하나를 기록하므로 커밋별 결과 파일을 이어 붙이거나 줄 단위 도구로 비교할 수 있습니다.
+     * 예: {"name":"SendChunkPool/Alloc","threads":4,"iterations":200000,"repetitions":5,
+     *      "ns_per_op_min":41.2,"ns_per_op_median":43.9,"ops_per_sec":91116173.1,"label":"a1b2c3d"}
+     */
+    Bool BenchmarkRunner::WriteResults(const Vector<BenchmarkResult>& results, const BenchmarkOptions& options)
+    {
+        if (options.outputPath.empty())
+        {
+            return true;
+        }
+
+        std::ofstream file(options.outputPath, std::ios::trunc);
+        if (!file.is_open())
+        {
+            gLogger->Error(TEXT_8("Benchmark: Failed to open {}"), options.outputPath);
+            return false;
+        }
+
+        const String8 label = EscapeJson(options.label);
+        for (const BenchmarkResult& result : results)
+        {
+            String8 line = fmt::format("{{\"name\":\"{}\",\"threads\":{},\"iterations\":{},\"repetitions\":{},"
+                                       "\"ns_per_op_min\":{:.3f},\"ns_per_op_median\":{:.3f},\"ops_per_sec\":{:.1f}",
+                                       EscapeJson(result.name), result.threadCount, result.iterations, result.repetitions,
+                                       result.minNsPerOp, result.medianNsPerOp, result.opsPerSec);
+            if (result.bytesPerSec > 0.0)
+            {
+                line += fmt::format(",\"bytes_per_sec\":{:.1f}", result.bytesPerSec);
+            }
+            if (result.cpuNsPerOp > 0.0)
+            {
+                line += fmt::format(",\"cpu_ns_per_op\":{:.1f}", result.cpuNsPerOp);
+            }
+            if (result.backgroundOpsPerSec > 0.0)
+            {
+                line += fmt::format(",\"background_ops_per_sec\":{:.1f}", result.backgroundOpsPerSec);
+            }
+            file << line << fmt::format(",\"label\":\"{}\"}}\n", label);
+        }
+
+        gLogger->Info(TEXT_8("Benchmark: Wrote {} results to {}"), results.size(), options.outputPath);
+
+        return true;
+    }
+
+    /**
+     * 이전 결과 파일과 비교해 회귀를 보고합니다.
+     *
+     * @return 회귀가 없으면 SUCCESS, 기준 파일을 읽지 못했거나 회귀가 있으면 FAILURE
+     *
+     * 동작:
+     * 1. 기준 파일에서 이름과 스레드 수별 중앙값을 읽음
+     * 2. 같은 결과가 있으면 중앙값 변화율을 계산해 출력
+     * 3. 변화율이 임계값을 넘으면 회귀로 집계
+     */
+    Int64 BenchmarkRunner::CompareResults(const Vector<BenchmarkResult>& results, const BenchmarkOptions& options)
+    {
+        std::ifstream file(options.baselinePath);
+        if (!file.is_open())
+        {
+            gLogger->Error(TEXT_8("Benchmark: Failed to open baseline {}"), options.baselinePath);
+            return FAILURE;
+        }
+
+        HashMap<String8, Float64> baseline;
+        String8 line;
+        while (std::getline(file, line))
+        {
+            String8View name;
+            String8View threads;
+            String8View median;
+            if (!FindField(line, "name", OUT name) ||
+                !FindField(line, "threads", OUT threads) ||
+                !FindField(line, "ns_per_op_median", OUT median))
+            {
+                continue;
+            }
+
+            baseline[MakeResultKey(name, std::atoi(String8(threads).c_str()))] = std::atof(String8(median).c_str());
+        }
+
+        Int64 regressionCount = 0;
+        for (const BenchmarkResult& result : results)
+        {
+            auto it = baseline.find(MakeResultKey(result.name, result.threadCount));
+            if ((it == baseline.end()) || (it->second <= 0.0))
+            {
+                gLogger->Info(TEXT_8("{:<36} threads={:<3} no baseline"), result.name, result.threadCount);
+                continue;
+            }
+
+            const Float64 changePercent = (result.medianNsPerOp / it->second - 1.0) * 100.0;
+            if (changePercent > options.thresholdPercent)
+            {
+                ++regressionCount;
+                gLogger->Warn(TEXT_8("{:<36} threads={:<3} {:>10.1f} -> {:>10.1f} ns/op ({:+.1f}%) REGRESSION"),
+                              result.name, result.threadCount, it->second, result.medianNsPerOp, changePercent);
+            }
+            else
+            {
+                gLogger->Info(TEXT_8("{:<36} threads={:<3} {:>10.1f} -> {:>10.1f} ns/op ({:+.1f}%)"),
+                              result.name, result.threadCount, it->second, result.medianNsPerOp, changePercent);
+            }
+        }
+
+        gLogger->Info(TEXT_8("Benchmark: {} regressions over {:.1f}% against {}"),
+                      regressionCount, options.thresholdPercent, options.baselinePath);
+
+        return (regressionCount == 0) ? SUCCESS : FAILURE;
+    }
+} // namespace bench
@@ -0,0 +1,139 @@
+﻿/*    Benchmark/Harness/Runner.h    */
+
+#pragma once
+
+namespace bench
+{
+    /**
+     * BenchmarkCase - 하나의 벤치마크 정의
+     *
+     * name: 결과 비교에 쓰이는 고유 이름 (예: SendChunkPool/Alloc)
+     * threadCounts: 측정할 동시 실행 스레드 수 목록, 스레드 수마다 결과가 하나씩 나옴
+     * iterations: 스레드 하나가 body에서 반복할 횟수
+     * setUp: 반복 측정마다 시간 측정 전에 호출 (선택, 인자는 스레드 수)
+     * body: 측정 대상, 모든 스레드가 동시에 시작하며 인자는 스레드 인덱스와 반복 횟수
+     * tearDown: 반복 측정마다 시간 측정 후에 호출 (선택)
+     * measureCpu: 반복 측정마다 프로세스 CPU 시간도 측정해 cpuNsPerOp로 기록 (스핀/양보 대기의 CPU 낭비 비교용)
+     * backgroundThreadCount: 스레드 인덱스가 이 값 미만인 스레드는 반복 횟수 대신 다른 스레드가 끝날 때까지 도는 배경 작업
+     *                        (예: 조회 중 갱신하는 쓰기 스레드), 연산 시간과 처리량은 나머지 스레드 기준으로 계산
+     * takeBackgroundOps: 반복 측정마다 시간 측정 후 배경 작업의 연산 수를 가져와 backgroundOpsPerSec로 기록 (선택)
+     */
+    struct BenchmarkCase
+    {
+        String8                             name;
+        Vector<Int32>                       threadCounts = {1};
+        Int64                               iterations = 100'000;
+        Function<void(Int32)>               setUp;
+        Function<void(Int32, Int64)>        body;
+        Function<void(void)>                tearDown;
+        Bool                                measureCpu = false;
+        Int32                               backgroundThreadCount = 0;
+        Function<Int64(void)>               takeBackgroundOps;
+    };
+
+    /**
+     * BenchmarkResult - 스레드 수 하나에 대한 측정 결과
+     *
+     * 연산 하나의 시간은 경과 시간을 스레드별 반복 횟수로 나눈 값이고,
+     * 처리량은 모든 스레드의 연산 수를 경과 시간으로 나눈 값입니다.
+     * bytesPerSec, cpuNsPerOp, backgroundOpsPerSec는 측정한 벤치마크만 기록합니다. (0이면 결과 파일에서 생략)
+     */
+    struct BenchmarkResult
+    {
+        String8     name;
+        Int32       threadCount = 1;
+        Int64       iterations = 0;
+        Int32       repetitions = 0;
+        Float64     minNsPerOp = 0.0;
+        Float64     medianNsPerOp = 0.0;
+        Float64     opsPerSec = 0.0;
+        Float64     bytesPerSec = 0.0;
+        Float64     cpuNsPerOp = 0.0;
+        Float64     backgroundOpsPerSec = 0.0;
+    };
+
+    /**
+     * BenchmarkOptions - 실행 인자로 지정하는 측정 설정
+     *
+     * filter: 이름에 포함된 벤치마크만 실행 (비어 있으면 전체)
+     * repetitions: 결과마다 반복 측정 횟수 (최솟값과 중앙값 계산, 워밍업 1회 별도)
+     * iterationScale: 벤치마크별 반복 횟수에 곱하는 배율 (빠른 확인용으로 줄일 때 사용)
+     * outputPath: JSON Lines 결과 파일 경로 (비어 있으면 파일로 쓰지 않음)
+     * baselinePath: 비교할 이전 결과 파일 경로 (비어 있으면 비교하지 않음)
+     * label: 결과 줄마다 기록할 식별자 (예: 커밋 해시)
+     * thresholdPercent: 중앙값이 기준보다 이 비율 이상 느려지면 회귀로 판정
+     */
+    struct BenchmarkOptions
+    {
+        String8     filter;
+        Int32       repetitions = 5;
+        Float64     iterationScale = 1.0;
+        String8     outputPath;
+        String8     baselinePath;
+        String8     label;
+        Float64     thresholdPercent = 10.0;
+    };
+
+    /*
+     * BenchmarkRunner - 마이크로벤치마크 실행 및 결과 기록
+     *
+     * 주요 기능:
+     * - 등록된 벤치마크를 스레드 수별로 반복 측정해 최솟값/중앙값 계산
+     * - 측정 스레드는 ThreadManager로 한 번만 생성해 재사용 (tThreadId, TLS 초기화 보장)
+     * - 모든 측정 스레드가 준비된 뒤 동시에 출발시키고, 마지막 스레드가 끝날 때까지의 시간을 측정
+     * - 결과를 JSON Lines로 기록하고 이전 결과와 비교해 회귀를 보고
+     *
+     * 사용 패턴:
+     * - Register*Benchmarks()로 벤치마크 등록 후 Run() 호출
+     * - Run()은 회귀가 없으면 SUCCESS, 있으면 FAILURE 반환 (프로세스 종료 코드로 사용)
+     * - 하네스 밖에서 측정한 결과(루프백 벤치마크 등)는 Report()로 같은 형식으로 기록/비교
+     */
+    class BenchmarkRunner
+    {
+    public:
+        BenchmarkRunner();
+        ~BenchmarkRunner();
+
+        // 복사 금지
+        BenchmarkRunner(const BenchmarkRunner&) = delete;
+        BenchmarkRunner& operator=(const BenchmarkRunner&) = delete;
+
+        void                    Add(BenchmarkCase benchmark);
+        Int64                   Run(const BenchmarkOptions& options);
+        Int64                   Report(const Vector<BenchmarkResult>& results, const BenchmarkOptions& options);
+
+    private:
+        BenchmarkResult         Measure(const BenchmarkCase& benchmark, Int32 threadCount, const BenchmarkOptions& options);
+        Int64                   RunOnce(const BenchmarkCase& benchmark, Int32 threadCount, Int64 iterations);
+
+        void                    EnsureWorkers(Int32 threadCount);
+        void                    StopWorkers();
+        void                    RunWorker(Int32 index);
+
+        Bool                    WriteResults(const Vector<BenchmarkResult>& results, const BenchmarkOptions& options);
+        Int64                   CompareResults(const Vector<BenchmarkResult>& results, const BenchmarkOptions& options);
+
+    private:
+        Vector<BenchmarkCase>   mBenchmarks;
+
+        // 측정 스레드 제어 (mLock으로 보호, 준비/완료 카운터는 스핀 대기)
+        SRWLOCK                 mLock = SRWLOCK_INIT;
+        CONDITION_VARIABLE      mCondVar = CONDITION_VARIABLE_INIT;
+        Int32                   mWorkerCount = 0;
+        Int64                   mGeneration = 0;
+        Bool                    mStopping = false;
+
+        const Function<void(Int32, Int64)>*     mBody = nullptr;
+        Int32                   mActiveCount = 0;
+        Int64                   mIterations = 0;
+
+        alignas(64) Atomic<Int32>   mReadyCount = 0;
+        alignas(64) Atomic<Bool>    mStarted = false;
+        alignas(64) Atomic<Int32>   mDoneCount = 0;
+    };
+
+    // 측정 대상 결과를 최적화로 제거하지 못하도록 소비
+    void DoNotOptimize(const void* value);
+    // 프로세스의 사용자 + 커널 CPU 시간 (마이크로초)
+    Int64 GetProcessCpuUs();
+} // namespace bench
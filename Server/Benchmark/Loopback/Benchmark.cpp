@@ -0,0 +1,505 @@
+﻿/*    Benchmark/Loopback/Benchmark.cpp    */
+
+#include "Benchmark/Pch.h"
+#include "Benchmark/Loopback/Benchmark.h"
+#include "Benchmark/Loopback/Session.h"
+#include "Core/Concurrency/Thread.h"
+#include "Core/Io/Dispatcher.h"
+#include "Core/Metric/Metric.h"
+#include "Core/Network/Service.h"
+#include "Core/Network/Batch.h"
+
+using namespace core;
+
+namespace bench
+{
+    LoopbackBenchmark::LoopbackBenchmark()
+        : mDeliveredMessages(gMetricRegistry->AddCounter(TEXT_8("bench_loopback_delivered_messages_total"),
+                                                         TEXT_8("Messages delivered to loopback clients")))
+        , mDeliveredBytes(gMetricRegistry->AddCounter(TEXT_8("bench_loopback_delivered_bytes_total"),
+                                                      TEXT_8("Bytes delivered to loopback clients")))
+        , mServerMessages(gMetricRegistry->AddCounter(TEXT_8("bench_loopback_server_messages_total"),
+                                                      TEXT_8("Messages received by the loopback server")))
+        , mSendCalls(gMetricRegistry->AddCounter(TEXT_8("net_session_send_calls_total"), TEXT_8("WSASend calls issued by sessions")))
+        , mSocketsCreated(gMetricRegistry->AddCounter(TEXT_8("net_session_sockets_created_total"), TEXT_8("Session sockets created with WSASocket")))
+        , mSocketsReused(gMetricRegistry->AddCounter(TEXT_8("net_session_sockets_reused_total"), TEXT_8("Session sockets reused after a TF_REUSE_SOCKET disconnect")))
+        , mSessionsCreated(gMetricRegistry->AddCounter(TEXT_8("net_sessions_created_total"), TEXT_8("Session objects created by the session factory")))
+        , mSessionsReused(gMetricRegistry->AddCounter(TEXT_8("net_sessions_reused_total"), TEXT_8("Session objects reset and reused from the session pool")))
+    {}
+
+    /**
+     * 루프백 벤치마크를 한 번 실행합니다.
+     *
+     * @param config 벤치마크 설정
+     * @param result 측정 결과 (이름, 입출력 워커 수, 전달 메시지/연결 수, 연산당 시간/CPU, 처리량)
+     * @return 모든 클라이언트가 연결되어 측정을 마쳤으면 true
+     *
+     * 동작:
+     * 1. 같은 디스패처를 쓰는 서버/클라이언트 서비스 생성, 서버 수신 시작 후 입출력 워커 실행
+     * 2. 연결 패턴이면 로그인 폭주(RunConnectStorm), 그 외에는 닫힌 루프(RunClosedLoop) 측정
+     * 3. 송신 중지, 클라이언트/서버 서비스 중지, 입출력 워커 조인
+     */
+    Bool LoopbackBenchmark::Run(const LoopbackConfig& config, OUT BenchmarkResult& result)
+    {
+        mConfig = config;
+        mConfig.messageSize = std::clamp(config.messageSize, LoopbackConfig::kMinMessageSize, LoopbackConfig::kMaxMessageSize);
+        mConfig.roomSize = std::max<Int64>(config.roomSize, 1);
+        mConfig.window = std::max<Int64>(config.window, 1);
+
+        const Int64 roomCount = (mConfig.pattern == LoopbackPattern::Broadcast) ?
+            (mConfig.clientCount + mConfig.roomSize - 1) / mConfig.roomSize : 1;
+        mRooms.assign(roomCount, {});
+
+        SendBatch::Configure(mConfig.sendBatchUs);
+
+        auto dispatcher = std::make_shared<IoEventDispatcher>();
+        const NetAddress address(TEXT_16("127.0.0.1"), mConfig.port);
+
+        Service::Config serverConfig{
+            address,
+            dispatcher,
+            MakeSessionFactory<LoopbackServerSession>(),
+            mConfig.clientCount,
+        };
+        serverConfig.listenerCount = mConfig.listenerCount;
+        serverConfig.poolSessions = mConfig.poolSessions;
+        Service::Config clientConfig{
+            address,
+            dispatcher,
+            MakeSessionFactory<LoopbackClientSession>(),
+            mConfig.clientCount,
+        };
+        clientConfig.listenerCount = mConfig.listenerCount;
+        clientConfig.poolSessions = mConfig.poolSessions;
+
+        auto server = std::make_shared<ServerService>(serverConfig);
+        auto client = std::make_shared<ClientService>(clientConfig);
+
+        if (server->Run() != SUCCESS)
+        {
+            gLogger->Error(TEXT_8("Loopback: Failed to listen on port {}"), mConfig.port);
+            return false;
+        }
+
+        const Int32 ioThreadCount = gThreadManager->GetRoleConfig(ThreadRole::Io).count;
+        for (Int32 i = 0; i < ioThreadCount; ++i)
+        {
+            gThreadManager->Launch(ThreadRole::Io, [dispatcher]
+                                   {
+                                       while (dispatcher->IsRunning())
+                                       {
+                                           Int64 result = dispatcher->Dispatch();
+                                       }
+                                   });
+        }
+
+        Bool measured = false;
+        if (mConfig.pattern == LoopbackPattern::Connect)
+        {
+            measured = RunConnectStorm(*server, *client, ioThreadCount, OUT result);
+        }
+        else
+        {
+            measured = RunClosedLoop(*client, ioThreadCount, OUT result);
+        }
+
+        mSending.store(false);
+        client->Stop();
+        server->Stop();
+
+        // 연결 해제 완료 통지를 처리한 뒤 입출력 워커 종료
+        ::Sleep(static_cast<DWORD>(kDisconnectWaitMs));
+        dispatcher->Stop();
+        gThreadManager->Join(ThreadRole::Io);
+
+        SendBatch::Configure(0);
+        Reset();
+
+        return measured;
+    }
+
+    /**
+     * 닫힌 루프 측정: 모든 클라이언트를 연결한 뒤 윈도우만큼 메시지를 돌리며 처리량을 측정합니다.
+     *
+     * @return 모든 클라이언트가 연결되어 메시지를 한 번 이상 전달했으면 true
+     */
+    Bool LoopbackBenchmark::RunClosedLoop(ClientService& client, Int32 ioThreadCount, OUT BenchmarkResult& result)
+    {
+        // 백로그가 넘치지 않도록 나눠서 연결
+        Bool connected = true;
+        for (Int64 remaining = mConfig.clientCount; connected && (remaining > 0); remaining -= kConnectBatchCount)
+        {
+            connected = (client.Connect(std::min(remaining, kConnectBatchCount)) == SUCCESS);
+            ::Sleep(10);
+        }
+        connected = connected && WaitForConnections();
+
+        Bool measured = false;
+        if (connected)
+        {
+            // 닫힌 루프 시작
+            mSending.store(true);
+            {
+                SrwLockReadGuard guard(mClientLock);
+                for (const SharedPtr<Session>& session : mClients)
+                {
+                    for (Int64 i = 0; i < mConfig.window; ++i)
+                    {
+                        std::static_pointer_cast<LoopbackClientSession>(session)->SendMessage();
+                    }
+                }
+            }
+
+            ::Sleep(static_cast<DWORD>(mConfig.warmupSec * 1'000));
+
+            const Int64 beginMessages = mDeliveredMessages.GetValue();
+            const Int64 beginBytes = mDeliveredBytes.GetValue();
+            const Int64 beginServerMessages = mServerMessages.GetValue();
+            const Int64 beginSendCalls = mSendCalls.GetValue();
+            const Int64 beginCpuUs = GetProcessCpuUs();
+            const auto begin = std::chrono::steady_clock::now();
+
+            ::Sleep(static_cast<DWORD>(std::max<Int64>(mConfig.durationSec, 1) * 1'000));
+
+            const Int64 messageCount = mDeliveredMessages.GetValue() - beginMessages;
+            const Int64 byteCount = mDeliveredBytes.GetValue() - beginBytes;
+            const Int64 serverMessageCount = mServerMessages.GetValue() - beginServerMessages;
+            const Int64 sendCallCount = mSendCalls.GetValue() - beginSendCalls;
+            const Int64 cpuUs = GetProcessCpuUs() - beginCpuUs;
+            const Int64 elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+
+            mSending.store(false);
+
+            const Float64 elapsedSec = elapsedNs / 1e9;
+            result.name = fmt::format("Loopback/{}/{}B/{}c{}", GetPatternName(mConfig.pattern), mConfig.messageSize, mConfig.clientCount,
+                                      (mConfig.sendBatchUs > 0) ? "/Batched" : "");
+            result.threadCount = ioThreadCount;
+            result.iterations = messageCount;
+            result.repetitions = 1;
+            result.minNsPerOp = (messageCount > 0) ? static_cast<Float64>(elapsedNs) / messageCount : 0.0;
+            result.medianNsPerOp = result.minNsPerOp;
+            result.opsPerSec = messageCount / elapsedSec;
+            result.bytesPerSec = byteCount / elapsedSec;
+            result.cpuNsPerOp = (messageCount > 0) ? cpuUs * 1'000.0 / messageCount : 0.0;
+
+            gLogger->Info(TEXT_8("Loopback: {} io={} window={} room={}"),
+                          result.name, ioThreadCount, mConfig.window, mConfig.roomSize);
+            gLogger->Info(TEXT_8("Loopback: delivered {:.0f} msgs/s, {:.1f} MB/s, server ingress {:.0f} msgs/s, CPU {:.0f} ns/msg ({:.1f} cores)"),
+                          result.opsPerSec, result.bytesPerSec / (1024.0 * 1024.0), serverMessageCount / elapsedSec,
+                          result.cpuNsPerOp, cpuUs / 1e6 / elapsedSec);
+            gLogger->Info(TEXT_8("Loopback: WSASend {:.0f} calls/s, {:.2f} msgs per call (batch cap {} us)"),
+                          sendCallCount / elapsedSec, static_cast<Float64>(messageCount) / std::max<Int64>(sendCallCount, 1),
+                          mConfig.sendBatchUs);
+
+            measured = (messageCount > 0);
+        }
+
+        return measured;
+    }
+
+    /**
+     * 로그인 폭주 측정: 클라이언트 전체가 한꺼번에 연결할 때의 초당 연결 수를 측정합니다.
+     *
+     * @return 모든 라운드에서 모든 클라이언트가 연결되었으면 true
+     *
+     * 동작:
+     * 1. 라운드마다 연결 완료를 기다리지 않고 연결을 요청 (서버가 아직 받지 않은 연결 수만 kStormInFlightCount로 제한)
+     * 2. 서버가 모든 연결을 받을 때까지의 시간과 프로세스 CPU 시간 차이 기록
+     * 3. 클라이언트 쪽에서 모두 연결을 해제하고 양쪽 세션이 비면 다음 라운드 (해제한 세션과 소켓을 다음 라운드가 재사용)
+     * 4. 라운드별 연결당 시간의 최솟값/중앙값과 초당 연결 수, 세션/소켓 생성과 재사용 수 보고
+     */
+    Bool LoopbackBenchmark::RunConnectStorm(ServerService& server, ClientService& client, Int32 ioThreadCount, OUT BenchmarkResult& result)
+    {
+        const Int64 rounds = std::max<Int64>(mConfig.stormRounds, 1);
+        const Int64 beginSocketsCreated = mSocketsCreated.GetValue();
+        const Int64 beginSocketsReused = mSocketsReused.GetValue();
+        const Int64 beginSessionsCreated = mSessionsCreated.GetValue();
+        const Int64 beginSessionsReused = mSessionsReused.GetValue();
+
+        Vector<Float64> roundNsPerConnect;
+        Int64 totalCpuUs = 0;
+        for (Int64 round = 0; round < rounds; ++round)
+        {
+            const Int64 baseCount = GetServerSessionCount();
+            const Int64 beginCpuUs = GetProcessCpuUs();
+            const auto begin = std::chrono::steady_clock::now();
+
+            for (Int64 requested = 0; requested < mConfig.clientCount;)
+            {
+                if (mConnectFailedCount.load() > 0)
+                {
+                    break;
+                }
+
+                if (requested - (GetServerSessionCount() - baseCount) >= kStormInFlightCount)
+                {
+                    ::SwitchToThread();
+                    continue;
+                }
+
+                const Int64 count = std::min(kConnectBatchCount, mConfig.clientCount - requested);
+                if (client.Connect(count) != SUCCESS)
+                {
+                    gLogger->Error(TEXT_8("Loopback: Failed to request connections"));
+                    return false;
+                }
+                requested += count;
+            }
+
+            if (!WaitForServerSessions(baseCount + mConfig.clientCount))
+            {
+                return false;
+            }
+
+            const Int64 elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+            totalCpuUs += GetProcessCpuUs() - beginCpuUs;
+            roundNsPerConnect.push_back(static_cast<Float64>(elapsedNs) / mConfig.clientCount);
+
+            gLogger->Info(TEXT_8("Loopback: Storm round {}: {} connects in {:.1f} ms"),
+                          round + 1, mConfig.clientCount, elapsedNs / 1e6);
+
+            // 다음 라운드 전에 모든 연결 해제
+            if (!DisconnectClients(server, client))
+            {
+                return false;
+            }
+        }
+
+        std::sort(roundNsPerConnect.begin(), roundNsPerConnect.end());
+        const Int64 connectCount = mConfig.clientCount * rounds;
+
+        result.name = fmt::format("Loopback/Connect/{}c{}{}", mConfig.clientCount,
+                                  (mConfig.listenerCount > 1) ? fmt::format("/{}l", mConfig.listenerCount) : String8(),
+                                  mConfig.poolSessions ? "" : "/NoPool");
+        result.threadCount = ioThreadCount;
+        result.iterations = connectCount;
+        result.repetitions = static_cast_32(rounds);
+        result.minNsPerOp = roundNsPerConnect.front();
+        result.medianNsPerOp = roundNsPerConnect[roundNsPerConnect.size() / 2];
+        result.opsPerSec = 1e9 / result.medianNsPerOp;
+        result.cpuNsPerOp = totalCpuUs * 1'000.0 / connectCount;
+
+        gLogger->Info(TEXT_8("Loopback: {} io={} listeners={}"), result.name, ioThreadCount, mConfig.listenerCount);
+        gLogger->Info(TEXT_8("Loopback: {:.0f} connects/s (median round), CPU {:.0f} ns/connect"),
+                      result.opsPerSec, result.cpuNsPerOp);
+        gLogger->Info(TEXT_8("Loopback: sessions created {}, reused {} / sockets created {}, reused {}"),
+                      mSessionsCreated.GetValue() - beginSessionsCreated, mSessionsReused.GetValue() - beginSessionsReused,
+                      mSocketsCreated.GetValue() - beginSocketsCreated, mSocketsReused.GetValue() - beginSocketsReused);
+
+        return true;
+    }
+
+    /**
+     * 서버 세션을 룸에 추가합니다. 연결된 순서대로 룸을 채웁니다.
+     *
+     * @return 세션이 속한 룸 인덱스
+     */
+    Int64 LoopbackBenchmark::JoinServerSession(const SharedPtr<Session>& session)
+    {
+        SrwLockWriteGuard guard(mRoomLock);
+
+        const Int64 roomIndex = (mServerSessionCount++ / mConfig.roomSize) % static_cast_64(mRooms.size());
+        if ((mConfig.pattern == LoopbackPattern::Broadcast) ||
+            (mConfig.pattern == LoopbackPattern::AllToAll))
+        {
+            mRooms[roomIndex].push_back(session);
+        }
+
+        return roomIndex;
+    }
+
+    /**
+     * 서버가 받은 메시지를 패턴에 맞게 전달합니다.
+     * 같은 메시지를 여러 세션에 보낼 때는 룸 브로드캐스트처럼 송신 버퍼 하나를 공유합니다.
+     */
+    void LoopbackBenchmark::Forward(const SharedPtr<Session>& sender, Int64 roomIndex, const Byte* message, Int64 size)
+    {
+        mServerMessages.Add();
+
+        SharedPtr<SendBuffer> buffer = gSendChunkPool->Alloc(size);
+        ::memcpy(buffer->GetBuffer(), message, size);
+        buffer->OnWritten(size);
+
+        if (mConfig.pattern == LoopbackPattern::Echo)
+        {
+            sender->SendAsync(std::move(buffer));
+            return;
+        }
+
+        SrwLockReadGuard guard(mRoomLock);
+        for (const SharedPtr<Session>& session : mRooms[roomIndex])
+        {
+            session->SendAsync(buffer);
+        }
+    }
+
+    void LoopbackBenchmark::OnClientConnected(const SharedPtr<Session>& session)
+    {
+        SrwLockWriteGuard guard(mClientLock);
+        mClients.push_back(session);
+    }
+
+    void LoopbackBenchmark::OnDelivered(Int64 messageCount, Int64 byteCount)
+    {
+        mDeliveredMessages.Add(messageCount);
+        mDeliveredBytes.Add(byteCount);
+    }
+
+    const Char8* LoopbackBenchmark::GetPatternName(LoopbackPattern pattern)
+    {
+        switch (pattern)
+        {
+        case LoopbackPattern::Echo:
+            return "Echo";
+        case LoopbackPattern::Broadcast:
+            return "Broadcast";
+        case LoopbackPattern::AllToAll:
+            return "AllToAll";
+        case LoopbackPattern::Connect:
+            return "Connect";
+        default:
+            return "Unknown";
+        }
+    }
+
+    Bool LoopbackBenchmark::FindPattern(String8View name, OUT LoopbackPattern& pattern)
+    {
+        if (name == "echo")
+        {
+            pattern = LoopbackPattern::Echo;
+        }
+        else if (name == "broadcast")
+        {
+            pattern = LoopbackPattern::Broadcast;
+        }
+        else if (name == "alltoall")
+        {
+            pattern = LoopbackPattern::AllToAll;
+        }
+        else if (name == "connect")
+        {
+            pattern = LoopbackPattern::Connect;
+        }
+        else
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * 모든 클라이언트가 연결되거나, 연결 실패가 있거나, 기한이 지날 때까지 대기합니다.
+     */
+    Bool LoopbackBenchmark::WaitForConnections()
+    {
+        const Int64 deadlineTick = ::GetTickCount64() + kConnectTimeoutMs;
+        while (static_cast_64(::GetTickCount64()) < deadlineTick)
+        {
+            Int64 connectedCount = 0;
+            {
+                SrwLockReadGuard guard(mClientLock);
+                connectedCount = static_cast_64(mClients.size());
+            }
+
+            if (connectedCount == mConfig.clientCount)
+            {
+                return true;
+            }
+
+            if (mConnectFailedCount.load() > 0)
+            {
+                break;
+            }
+
+            ::Sleep(10);
+        }
+
+        gLogger->Error(TEXT_8("Loopback: Only {} of {} clients connected ({} failed)"),
+                       mClients.size(), mConfig.clientCount, mConnectFailedCount.load());
+        return false;
+    }
+
+    /**
+     * 서버가 받은 연결 수가 목표에 이를 때까지 대기합니다. 연결 실패가 있거나 기한이 지나면 실패합니다.
+     */
+    Bool LoopbackBenchmark::WaitForServerSessions(Int64 targetCount)
+    {
+        const Int64 deadlineTick = ::GetTickCount64() + kConnectTimeoutMs;
+        while (static_cast_64(::GetTickCount64()) < deadlineTick)
+        {
+            if (GetServerSessionCount() >= targetCount)
+            {
+                return true;
+            }
+
+            if (mConnectFailedCount.load() > 0)
+            {
+                break;
+            }
+
+            ::SwitchToThread();
+        }
+
+        gLogger->Error(TEXT_8("Loopback: Server accepted {} of {} connections ({} failed)"),
+                       GetServerSessionCount(), targetCount, mConnectFailedCount.load());
+        return false;
+    }
+
+    /**
+     * 클라이언트 쪽에서 모든 연결을 해제하고 서버/클라이언트 세션이 모두 제거될 때까지 대기합니다.
+     */
+    Bool LoopbackBenchmark::DisconnectClients(ServerService& server, ClientService& client)
+    {
+        Vector<SharedPtr<Session>> clients;
+        {
+            SrwLockWriteGuard guard(mClientLock);
+            clients.swap(mClients);
+        }
+
+        for (const SharedPtr<Session>& session : clients)
+        {
+            session->DisconnectAsync(TEXT_8("Storm round finished"));
+        }
+        clients.clear();
+
+        const Int64 deadlineTick = ::GetTickCount64() + kConnectTimeoutMs;
+        while ((server.GetCurrentSessionCount() > 0) ||
+               (client.GetCurrentSessionCount() > 0))
+        {
+            if (static_cast_64(::GetTickCount64()) >= deadlineTick)
+            {
+                gLogger->Error(TEXT_8("Loopback: Sessions left after disconnect (server {}, client {})"),
+                               server.GetCurrentSessionCount(), client.GetCurrentSessionCount());
+                return false;
+            }
+
+            ::Sleep(1);
+        }
+
+        // 연결 해제 완료 통지를 처리해 소켓이 재사용 대기 목록에 들어가도록 대기
+        ::Sleep(static_cast<DWORD>(kDisconnectWaitMs));
+
+        return true;
+    }
+
+    Int64 LoopbackBenchmark::GetServerSessionCount()
+    {
+        SrwLockReadGuard guard(mRoomLock);
+        return mServerSessionCount;
+    }
+
+    void LoopbackBenchmark::Reset()
+    {
+        {
+            SrwLockWriteGuard guard(mRoomLock);
+            mRooms.clear();
+            mServerSessionCount = 0;
+        }
+        {
+            SrwLockWriteGuard guard(mClientLock);
+            mClients.clear();
+        }
+        mConnectFailedCount.store(0);
+    }
+} // namespace bench
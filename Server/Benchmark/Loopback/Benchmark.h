@@ -0,0 +1,142 @@
+﻿/*    Benchmark/Loopback/Benchmark.h    */
+
+#pragma once
+
+#include "Benchmark/Harness/Runner.h"
+
+namespace core
+{
+    class Counter;
+    class Session;
+    class ServerService;
+    class ClientService;
+} // namespace core
+
+namespace bench
+{
+    // 서버가 수신한 메시지를 전달하는 방식
+    enum class LoopbackPattern : Int32
+    {
+        Echo = 0,       // 보낸 클라이언트에게만
+        Broadcast,      // 같은 룸(roomSize명)의 모든 클라이언트에게
+        AllToAll,       // 연결된 모든 클라이언트에게
+        Connect,        // 메시지 없이 연결만 (로그인 폭주 측정)
+    };
+
+    /**
+     * LoopbackConfig - 루프백 벤치마크 설정
+     *
+     * pattern: 서버의 전달 방식
+     * clientCount: 연결할 클라이언트 수
+     * messageSize: 헤더를 포함한 메시지 크기 (바이트)
+     * roomSize: 브로드캐스트 룸 하나의 클라이언트 수
+     * window: 클라이언트마다 서버를 거쳐 돌아오지 않은 메시지의 최대 수
+     * warmupSec: 측정 전에 버리는 시간 (연결 직후 송신 청크와 버퍼 할당 제외)
+     * durationSec: 측정 시간
+     * port: 루프백 포트 (게임 서버와 겹치지 않도록 기본 7800)
+     * sendBatchUs: 송신 묶음의 지연 상한 (0이면 즉시 송신, 양수면 결과 이름에 /Batched 추가)
+     * listenerCount: 서버 리슨 소켓 수 (port부터 연속된 포트, 클라이언트는 포트를 번갈아 연결)
+     * stormRounds: 연결 패턴에서 전체 연결/해제를 반복하는 횟수 (두 번째 라운드부터 세션/소켓 재사용)
+     * poolSessions: 연결 해제한 세션을 재사용 (false면 결과 이름에 /NoPool 추가)
+     */
+    struct LoopbackConfig
+    {
+        static constexpr Int64      kMinMessageSize = 16;
+        static constexpr Int64      kMaxMessageSize = 4096;
+
+        LoopbackPattern     pattern = LoopbackPattern::Echo;
+        Int64               clientCount = 100;
+        Int64               messageSize = 64;
+        Int64               roomSize = 50;
+        Int64               window = 8;
+        Int64               warmupSec = 1;
+        Int64               durationSec = 5;
+        UInt16              port = 7800;
+        Int64               sendBatchUs = 0;
+        Int64               listenerCount = 1;
+        Int64               stormRounds = 3;
+        Bool                poolSessions = true;
+    };
+
+    /*
+     * LoopbackBenchmark - 서버와 클라이언트를 한 프로세스에서 루프백으로 연결하는 네트워크 경로 벤치마크
+     *
+     * 주요 기능:
+     * - ServerService와 ClientService가 같은 IoEventDispatcher(IOCP)와 입출력 워커를 공유
+     * - 모든 클라이언트가 연결된 뒤 동시에 송신을 시작하고, 워밍업 이후 구간만 측정
+     * - 클라이언트가 받은 메시지 수/바이트와 프로세스 CPU 시간으로 처리량과 메시지당 CPU 계산
+     * - 연결 패턴은 클라이언트 전체가 한꺼번에 접속하는 로그인 폭주의 초당 연결 수 측정
+     *
+     * 특징:
+     * - 서버와 클라이언트가 같은 코어를 나눠 쓰므로 메시지당 CPU는 송수신 양쪽 비용의 합
+     * - 게임 루프와 패킷 디스패치를 거치지 않으므로 세션/소켓/송신 큐 경로 변경의 전후 비교에 사용
+     */
+    class LoopbackBenchmark
+    {
+    public:
+        static LoopbackBenchmark& GetInstance()
+        {
+            static LoopbackBenchmark sInstance;
+            return sInstance;
+        }
+
+        Bool                Run(const LoopbackConfig& config, OUT BenchmarkResult& result);
+
+        // 서버 세션
+        Int64               JoinServerSession(const SharedPtr<core::Session>& session);
+        void                Forward(const SharedPtr<core::Session>& sender, Int64 roomIndex, const Byte* message, Int64 size);
+
+        // 클라이언트 세션
+        void                OnClientConnected(const SharedPtr<core::Session>& session);
+        void                OnClientConnectFailed() { mConnectFailedCount.fetch_add(1); }
+        void                OnDelivered(Int64 messageCount, Int64 byteCount);
+
+        const LoopbackConfig&   GetConfig() const { return mConfig; }
+        Bool                IsSending() const { return mSending.load(std::memory_order_relaxed); }
+
+    public:
+        static const Char8* GetPatternName(LoopbackPattern pattern);
+        static Bool         FindPattern(String8View name, OUT LoopbackPattern& pattern);
+
+    private:
+        LoopbackBenchmark();
+
+        Bool                RunClosedLoop(core::ClientService& client, Int32 ioThreadCount, OUT BenchmarkResult& result);
+        Bool                RunConnectStorm(core::ServerService& server, core::ClientService& client, Int32 ioThreadCount, OUT BenchmarkResult& result);
+
+        Bool                WaitForConnections();
+        Bool                WaitForServerSessions(Int64 targetCount);
+        Bool                DisconnectClients(core::ServerService& server, core::ClientService& client);
+        Int64               GetServerSessionCount();
+        void                Reset();
+
+    private:
+        static constexpr Int64      kConnectBatchCount = 100;
+        static constexpr Int64      kStormInFlightCount = 512; // 로그인 폭주에서 서버가 아직 받지 않은 연결 수 상한 (리슨 백로그 초과 방지)
+        static constexpr Int64      kConnectTimeoutMs = 10'000;
+        static constexpr Int64      kDisconnectWaitMs = 100;
+
+    private:
+        LoopbackConfig      mConfig;
+        Atomic<Bool>        mSending = false;
+
+        // 서버 세션 룸 (에코는 사용하지 않고, 전체 전달은 룸 하나)
+        SRWLOCK                             mRoomLock = SRWLOCK_INIT;
+        Vector<Vector<SharedPtr<core::Session>>>    mRooms;
+        Int64                               mServerSessionCount = 0;
+
+        // 클라이언트 세션
+        SRWLOCK                             mClientLock = SRWLOCK_INIT;
+        Vector<SharedPtr<core::Session>>    mClients;
+        Atomic<Int64>                       mConnectFailedCount = 0;
+
+        core::Counter&      mDeliveredMessages;
+        core::Counter&      mDeliveredBytes;
+        core::Counter&      mServerMessages;
+        core::Counter&      mSendCalls;
+        core::Counter&      mSocketsCreated;
+        core::Counter&      mSocketsReused;
+        core::Counter&      mSessionsCreated;
+        core::Counter&      mSessionsReused;
+    };
+} // namespace bench
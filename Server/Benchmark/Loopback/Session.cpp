@@ -0,0 +1,150 @@
+﻿/*    Benchmark/Loopback/Session.cpp    */
+
+#include "Benchmark/Pch.h"
+#include "Benchmark/Loopback/Session.h"
+#include "Benchmark/Loopback/Benchmark.h"
+#include "Protocol/Packet/Type.h"
+
+using namespace core;
+
+namespace bench
+{
+    namespace
+    {
+        /**
+         * 버퍼에서 완성된 메시지를 하나씩 꺼내 콜백을 호출합니다.
+         *
+         * @return 처리한 메시지 크기의 합 (일부만 받은 메시지는 다음 수신까지 남김)
+         */
+        template<typename Func>
+        Int64 ForEachMessage(const Byte* buffer, Int64 numBytes, Func&& func)
+        {
+            Int64 offset = 0;
+            while (numBytes - offset >= sizeof_64(proto::PacketHeader))
+            {
+                const proto::PacketHeader* header = reinterpret_cast<const proto::PacketHeader*>(buffer + offset);
+                ASSERT_CRASH_DEBUG(header->size > 0, "INVALID_PACKET_SIZE");
+                if (header->size > numBytes - offset)
+                {
+                    break;
+                }
+
+                func(buffer + offset, static_cast_64(header->size));
+                offset += header->size;
+            }
+
+            return offset;
+        }
+
+        // 메시지 페이로드 앞부분에 기록한 보낸 클라이언트 세션 ID
+        Int64 GetSenderId(const Byte* message)
+        {
+            Int64 senderId = 0;
+            ::memcpy(&senderId, message + sizeof(proto::PacketHeader), sizeof(senderId));
+            return senderId;
+        }
+    } // namespace
+
+    void LoopbackServerSession::OnConnected()
+    {
+        mRoomIndex = LoopbackBenchmark::GetInstance().JoinServerSession(GetSession());
+    }
+
+    void LoopbackServerSession::OnDisconnected(String8 cause)
+    {
+        LOG_DEBUG(Network, TEXT_8("Session[{}]: Loopback client disconnected: {}"), GetId(), cause);
+    }
+
+    Int64 LoopbackServerSession::OnReceived(const Byte* buffer, Int64 numBytes)
+    {
+        const SharedPtr<Session> self = GetSession();
+        return ForEachMessage(buffer, numBytes, [this, &self](const Byte* message, Int64 size)
+                              {
+                                  LoopbackBenchmark::GetInstance().Forward(self, mRoomIndex, message, size);
+                              });
+    }
+
+    void LoopbackServerSession::OnSent(Int64 numBytes)
+    {}
+
+    void LoopbackServerSession::OnReset()
+    {
+        mRoomIndex = 0;
+    }
+
+    /**
+     * 설정된 크기의 메시지를 하나 보냅니다.
+     * 페이로드 앞 8바이트에 자신의 세션 ID를 기록해 전달받은 메시지 중 자신이 보낸 것을 구분합니다.
+     */
+    void LoopbackClientSession::SendMessage()
+    {
+        const Int64 messageSize = LoopbackBenchmark::GetInstance().GetConfig().messageSize;
+
+        SharedPtr<SendBuffer> buffer = gSendChunkPool->Alloc(messageSize);
+        ::memset(buffer->GetBuffer(), 0, messageSize);
+
+        proto::PacketHeader* header = reinterpret_cast<proto::PacketHeader*>(buffer->GetBuffer());
+        header->size = static_cast_32(messageSize);
+        header->id = proto::PacketId::C2S_Chat;
+
+        const Int64 senderId = GetId();
+        ::memcpy(header + 1, &senderId, sizeof(senderId));
+
+        buffer->OnWritten(messageSize);
+        SendAsync(std::move(buffer));
+    }
+
+    void LoopbackClientSession::OnConnected()
+    {
+        LoopbackBenchmark::GetInstance().OnClientConnected(GetSession());
+    }
+
+    void LoopbackClientSession::OnDisconnected(String8 cause)
+    {
+        LOG_DEBUG(Network, TEXT_8("Session[{}]: Disconnected from loopback server: {}"), GetId(), cause);
+    }
+
+    /**
+     * 받은 메시지를 집계하고, 자신이 보낸 메시지가 돌아온 수만큼 다음 메시지를 보냅니다.
+     */
+    Int64 LoopbackClientSession::OnReceived(const Byte* buffer, Int64 numBytes)
+    {
+        LoopbackBenchmark& benchmark = LoopbackBenchmark::GetInstance();
+
+        const Int64 sessionId = GetId();
+        Int64 messageCount = 0;
+        Int64 byteCount = 0;
+        Int64 returnedCount = 0;
+        const Int64 processedSize = ForEachMessage(buffer, numBytes,
+                                                   [sessionId, &messageCount, &byteCount, &returnedCount](const Byte* message, Int64 size)
+                                                   {
+                                                       ++messageCount;
+                                                       byteCount += size;
+                                                       if (GetSenderId(message) == sessionId)
+                                                       {
+                                                           ++returnedCount;
+                                                       }
+                                                   });
+
+        benchmark.OnDelivered(messageCount, byteCount);
+
+        if (benchmark.IsSending())
+        {
+            for (Int64 i = 0; i < returnedCount; ++i)
+            {
+                SendMessage();
+            }
+        }
+
+        return processedSize;
+    }
+
+    void LoopbackClientSession::OnSent(Int64 numBytes)
+    {}
+
+    void LoopbackClientSession::OnConnectFailed(Int64 errorCode)
+    {
+        LOG_DEBUG(Network, TEXT_8("Session[{}]: Failed to connect to loopback server: {}"), GetId(), errorCode);
+        LoopbackBenchmark::GetInstance().OnClientConnectFailed();
+    }
+} // namespace bench
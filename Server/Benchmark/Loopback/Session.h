@@ -0,0 +1,51 @@
+﻿/*    Benchmark/Loopback/Session.h    */
+
+#pragma once
+
+#include "Core/Network/Session.h"
+
+namespace bench
+{
+    /*
+     * LoopbackServerSession - 루프백 벤치마크의 서버 측 세션
+     *
+     * 입출력 워커에서 수신한 메시지를 게임 루프를 거치지 않고 바로 패턴에 맞게 전달합니다.
+     * (에코: 보낸 세션, 룸 브로드캐스트: 같은 룸의 모든 세션, 전체 전달: 모든 세션)
+     */
+    class LoopbackServerSession
+        : public core::Session
+    {
+    public:
+        Int64               GetRoomIndex() const { return mRoomIndex; }
+
+    protected:
+        virtual void        OnConnected() override;
+        virtual void        OnDisconnected(String8 cause) override;
+        virtual Int64       OnReceived(const Byte* buffer, Int64 numBytes) override;
+        virtual void        OnSent(Int64 numBytes) override;
+        virtual void        OnReset() override;
+
+    private:
+        Int64               mRoomIndex = 0;
+    };
+
+    /*
+     * LoopbackClientSession - 루프백 벤치마크의 클라이언트 측 세션
+     *
+     * 자신이 보낸 메시지가 서버를 거쳐 돌아올 때마다 다음 메시지를 보내는 닫힌 루프로 동작하므로,
+     * 세션마다 진행 중인 메시지 수가 윈도우 크기로 유지되어 송신 큐가 무한히 쌓이지 않습니다.
+     */
+    class LoopbackClientSession
+        : public core::Session
+    {
+    public:
+        void                SendMessage();
+
+    protected:
+        virtual void        OnConnected() override;
+        virtual void        OnDisconnected(String8 cause) override;
+        virtual Int64       OnReceived(const Byte* buffer, Int64 numBytes) override;
+        virtual void        OnSent(Int64 numBytes) override;
+        virtual void        OnConnectFailed(Int64 errorCode) override;
+    };
+} // namespace bench
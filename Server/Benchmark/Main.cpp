@@ -0,0 +1,201 @@
+﻿/*    Benchmark/Main.cpp    */
+
+#include "Benchmark/Pch.h"
+#include "Benchmark/Harness/Runner.h"
+#include "Benchmark/Suite/Suite.h"
+#include "Benchmark/Loopback/Benchmark.h"
+#include "Core/Concurrency/Thread.h"
+
+using namespace bench;
+
+/**
+ * 실행 인자
+ *
+ * --filter <text>          이름에 text가 포함된 벤치마크만 실행 (예: --filter SendChunkPool)
+ * --repeat <count>         결과마다 반복 측정 횟수 (기본 5, 최솟값과 중앙값 보고)
+ * --scale <factor>         벤치마크별 반복 횟수 배율 (기본 1.0, 빠른 확인은 0.1)
+ * --out <path>             JSON Lines 결과 파일 경로
+ * --label <text>           결과 줄마다 기록할 식별자 (예: 커밋 해시)
+ * --compare <path>         이전 결과 파일과 중앙값을 비교해 회귀가 있으면 종료 코드 1 반환
+ * --threshold <percent>    회귀로 판정할 중앙값 증가율 (기본 10)
+ *
+ * 루프백 벤치마크 (마이크로벤치마크 대신 실행, 결과 기록/비교 인자는 같이 사용)
+ * --loopback <pattern>     echo, broadcast, alltoall, connect(로그인 폭주) 중 하나
+ * --clients <count>        클라이언트 수 (기본 100)
+ * --size <bytes>           헤더를 포함한 메시지 크기 (기본 64, 16 ~ 4096)
+ * --room <count>           broadcast 룸 하나의 클라이언트 수 (기본 50)
+ * --window <count>         클라이언트별 진행 중인 메시지 수 (기본 8)
+ * --warmup <sec>           측정 전 워밍업 시간 (기본 1)
+ * --duration <sec>         측정 시간 (기본 5)
+ * --port <port>            루프백 포트 (기본 7800)
+ * --send-batch-us <us>     수신 하나를 처리하며 보낸 메시지를 세션마다 묶어 송신 (기본 0: 즉시 송신)
+ * --listeners <count>      서버 리슨 소켓 수 (기본 1, port부터 연속된 포트 사용)
+ * --rounds <count>         connect 패턴의 연결/해제 반복 횟수 (기본 3)
+ * --session-pool <0|1>     연결 해제한 세션 재사용 여부 (기본 1, 0이면 결과 이름에 /NoPool)
+ * --threads <role>=<count> 역할별 스레드 수 지정 (예: --threads io=4), 반복 가능
+ *
+ * 커밋 간 비교 예:
+ *   Benchmark.exe --label base --out base.jsonl
+ *   Benchmark.exe --label head --out head.jsonl --compare base.jsonl
+ *   Benchmark.exe --loopback broadcast --clients 500 --size 128 --out loopback.jsonl
+ *   Benchmark.exe --loopback connect --clients 5000 --listeners 4 --out storm.jsonl
+ *
+ * 짝으로 비교하는 마이크로벤치마크:
+ *   SendQueue/PushPopAll과 SendQueue/HeapNodes      송신 큐 노드 풀 유무
+ *   LockCompare/RwSpinLock과 LockCompare/LegacySpinLock   파킹 락과 이전 양보 락 (cpu_ns_per_op 포함)
+ *   SessionLayout/Split과 SessionLayout/Packed      세션 필드 캐시 라인 배치
+ *   RcuMap/FindWithChurn과 RwSpinLockMap/FindWithChurn   갱신 중 조회 (background_ops_per_sec는 쓰기 처리량)
+ *
+ * 이 실행 파일 밖에서 하는 측정 (결과는 로그로 확인):
+ *   GameServer --zone-bench 10000                   존 워커 수별 평균/p99 틱 시간과 속도 향상
+ *   GameServer --max-sessions 10000 과 DummyClient --agents 10000 --rooms 500 --duration 120
+ *                                                   룸별 잡 큐의 부하 (클라이언트 종료 시 지연/처리량 보고)
+ *
+ * 측정값은 빌드 구성의 영향을 크게 받으므로 Release 빌드끼리 비교합니다.
+ */
+struct Options
+{
+    BenchmarkOptions    benchmark;
+    Bool                loopback = false;
+    LoopbackConfig      loopbackConfig;
+};
+
+void ParseThreadOption(String8View option)
+{
+    const auto separator = option.find('=');
+    core::ThreadRole role;
+    if ((separator == String8View::npos) ||
+        !core::ThreadManager::FindRole(option.substr(0, separator), OUT role))
+    {
+        core::gLogger->Warn(TEXT_8("Invalid thread option: {}"), option);
+        return;
+    }
+
+    core::ThreadRoleConfig config = core::gThreadManager->GetRoleConfig(role);
+    config.count = std::max(std::atoi(String8(option.substr(separator + 1)).c_str()), 1);
+    core::gThreadManager->SetRoleConfig(role, config);
+}
+
+Options ParseOptions(int argc, char* argv[])
+{
+    Options options;
+    BenchmarkOptions& benchmark = options.benchmark;
+    LoopbackConfig& loopback = options.loopbackConfig;
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+        const String8View arg = argv[i];
+        if (arg == "--filter")
+        {
+            benchmark.filter = argv[++i];
+        }
+        else if (arg == "--repeat")
+        {
+            benchmark.repetitions = std::max(std::atoi(argv[++i]), 1);
+        }
+        else if (arg == "--scale")
+        {
+            benchmark.iterationScale = std::max(std::atof(argv[++i]), 0.0);
+        }
+        else if (arg == "--out")
+        {
+            benchmark.outputPath = argv[++i];
+        }
+        else if (arg == "--label")
+        {
+            benchmark.label = argv[++i];
+        }
+        else if (arg == "--compare")
+        {
+            benchmark.baselinePath = argv[++i];
+        }
+        else if (arg == "--threshold")
+        {
+            benchmark.thresholdPercent = std::max(std::atof(argv[++i]), 0.0);
+        }
+        else if (arg == "--loopback")
+        {
+            options.loopback = LoopbackBenchmark::FindPattern(argv[++i], OUT loopback.pattern);
+            if (!options.loopback)
+            {
+                core::gLogger->Warn(TEXT_8("Invalid loopback pattern: {}"), argv[i]);
+            }
+        }
+        else if (arg == "--clients")
+        {
+            loopback.clientCount = std::max<Int64>(std::atoll(argv[++i]), 1);
+        }
+        else if (arg == "--size")
+        {
+            loopback.messageSize = std::atoll(argv[++i]);
+        }
+        else if (arg == "--room")
+        {
+            loopback.roomSize = std::max<Int64>(std::atoll(argv[++i]), 1);
+        }
+        else if (arg == "--window")
+        {
+            loopback.window = std::max<Int64>(std::atoll(argv[++i]), 1);
+        }
+        else if (arg == "--warmup")
+        {
+            loopback.warmupSec = std::max<Int64>(std::atoll(argv[++i]), 0);
+        }
+        else if (arg == "--duration")
+        {
+            loopback.durationSec = std::max<Int64>(std::atoll(argv[++i]), 1);
+        }
+        else if (arg == "--port")
+        {
+            loopback.port = static_cast<UInt16>(std::atoi(argv[++i]));
+        }
+        else if (arg == "--send-batch-us")
+        {
+            loopback.sendBatchUs = std::max<Int64>(std::atoll(argv[++i]), 0);
+        }
+        else if (arg == "--listeners")
+        {
+            loopback.listenerCount = std::max<Int64>(std::atoll(argv[++i]), 1);
+        }
+        else if (arg == "--rounds")
+        {
+            loopback.stormRounds = std::max<Int64>(std::atoll(argv[++i]), 1);
+        }
+        else if (arg == "--session-pool")
+        {
+            loopback.poolSessions = (std::atoi(argv[++i]) != 0);
+        }
+        else if (arg == "--threads")
+        {
+            ParseThreadOption(argv[++i]);
+        }
+    }
+
+    return options;
+}
+
+int main(int argc, char* argv[])
+{
+    const Options options = ParseOptions(argc, argv);
+
+    BenchmarkRunner runner;
+
+    if (options.loopback)
+    {
+        BenchmarkResult result;
+        if (!LoopbackBenchmark::GetInstance().Run(options.loopbackConfig, OUT result))
+        {
+            return 1;
+        }
+
+        return (runner.Report({result}, options.benchmark) == SUCCESS) ? 0 : 1;
+    }
+
+    RegisterNetworkBenchmarks(runner);
+    RegisterPacketBenchmarks(runner);
+    RegisterConcurrencyBenchmarks(runner);
+    RegisterJobBenchmarks(runner);
+
+    const Int64 result = runner.Run(options.benchmark);
+
+    return (result == SUCCESS) ? 0 : 1;
+}
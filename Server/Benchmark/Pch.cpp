@@ -0,0 +1,3 @@
+﻿/*    Benchmark/Pch.cpp    */
+
+#include "Benchmark/Pch.h"
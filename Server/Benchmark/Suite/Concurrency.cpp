@@ -0,0 +1,340 @@
+﻿/*    Benchmark/Suite/Concurrency.cpp    */
+
+#include "Benchmark/Pch.h"
+#include "Benchmark/Suite/Suite.h"
+#include "Benchmark/Harness/Runner.h"
+#include "Core/Concurrency/Rcu.h"
+
+using namespace core;
+
+namespace bench
+{
+    namespace
+    {
+        constexpr const Char8*  kLockName = "Benchmark";
+        // 읽기 위주 비율에서 쓰기 한 번당 읽기 횟수
+        constexpr Int64         kReadsPerWrite = 16;
+        // 룸의 플레이어 맵 정도 크기
+        constexpr Int64         kMapSize = 1024;
+        // 조회 중 입장/퇴장을 반복하는 쓰기 스레드 수와 키 수 (조회 키와 겹치지 않는 범위)
+        constexpr Int32         kChurnWriterCount = 1;
+        constexpr Int64         kChurnKeyCount = 64;
+        // 송신 청크 풀의 프리 리스트 정도 크기
+        constexpr Int64         kFreeListSize = 64;
+
+        struct LockedValue
+        {
+            alignas(64) RwSpinLock  lock;
+            Int64                   value = 0;
+        };
+
+        struct RcuChurnMap
+        {
+            RcuMap<Int64, Int64>    map;
+
+            void    Insert(Int64 key, Int64 value) { map.Insert(key, value); }
+            void    Erase(Int64 key) { map.Erase(key); }
+            Int64   Find(Int64 key) const { return map.Find(key); }
+        };
+
+        // RcuMap 도입 전 Room/PlayerManager처럼 조회도 쓰기 락으로 직렬화하는 맵
+        struct LockedChurnMap
+        {
+            mutable RwSpinLock      lock;
+            HashMap<Int64, Int64>   map;
+
+            void Insert(Int64 key, Int64 value)
+            {
+                RwSpinLock::WriteGuard guard(lock, kLockName);
+                map.emplace(key, value);
+            }
+
+            void Erase(Int64 key)
+            {
+                RwSpinLock::WriteGuard guard(lock, kLockName);
+                map.erase(key);
+            }
+
+            Int64 Find(Int64 key) const
+            {
+                RwSpinLock::WriteGuard guard(lock, kLockName);
+                auto it = map.find(key);
+                return (it != map.end()) ? it->second : 0;
+            }
+        };
+
+        template <typename Map>
+        struct ChurnState
+        {
+            Map                     map;
+            Int32                   readerCount = 0;
+            alignas(64) Atomic<Int32>   finishedReaderCount = 0;
+            alignas(64) Atomic<Int64>   writerOpCount = 0;
+        };
+
+        /**
+         * LegacySpinLock - 파킹 도입 전의 RwSpinLock (비교 기준)
+         *
+         * 지수적 _mm_pause 백오프가 상한에 닿으면 락을 얻을 때까지 yield로 양보합니다.
+         * 알고리즘만 비교하도록 데드락 감지와 시간 초과 검사는 뺐습니다.
+         */
+        class LegacySpinLock
+        {
+        public:
+            void LockWrite(const Char8* name)
+            {
+                Int32 backoff = 1;
+                while (true)
+                {
+                    UInt64 expected = kEmptyFlag;
+                    if (mLockFlag.compare_exchange_weak(OUT expected, kWriteFlag))
+                    {
+                        return;
+                    }
+                    Backoff(backoff);
+                }
+            }
+
+            void UnlockWrite(const Char8* name) { mLockFlag.fetch_and(kEmptyFlag); }
+
+            void LockRead(const Char8* name)
+            {
+                Int32 backoff = 1;
+                while (true)
+                {
+                    UInt64 expected = (mLockFlag.load() & kReadCountMask);
+                    if (mLockFlag.compare_exchange_weak(OUT expected, expected + 1))
+                    {
+                        return;
+                    }
+                    Backoff(backoff);
+                }
+            }
+
+            void UnlockRead(const Char8* name) { mLockFlag.fetch_sub(1); }
+
+        private:
+            static void Backoff(Int32& backoff)
+            {
+                for (Int32 i = 0; i < backoff; ++i)
+                {
+                    ::_mm_pause();
+                }
+
+                if (backoff < kMaxBackoff)
+                {
+                    backoff <<= 1;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+        private:
+            static constexpr UInt64     kWriteFlag = 0xF000'0000;
+            static constexpr UInt64     kEmptyFlag = 0x0000'0000;
+            static constexpr UInt64     kReadCountMask = 0x0FFF'FFFF;
+            static constexpr Int32      kMaxBackoff = 1'024;
+
+        private:
+            Atomic<UInt64>              mLockFlag = kEmptyFlag;
+        };
+
+        // SendChunkPool처럼 짧은 임계 구역에서 프리 리스트를 꺼내고 돌려놓는 락
+        template <typename Lock>
+        struct LockedFreeList
+        {
+            alignas(64) Lock        lock;
+            Vector<Int64>           freeList = Vector<Int64>(kFreeListSize);
+        };
+
+        /**
+         * 같은 작업을 현재 락과 이전 락으로 측정하도록 등록합니다.
+         *
+         * 스레드 수가 논리 프로세서 수를 넘는 경우(입출력, 잡, 타이머, 루프, 로거 스레드가 함께 도는 서버 상황)까지 측정하며,
+         * 대기 중 낭비한 CPU를 비교하도록 CPU 시간도 기록합니다.
+         */
+        template <typename Lock>
+        void AddLockComparison(BenchmarkRunner& runner, const String8& lockName, const Vector<Int32>& threadCounts)
+        {
+            auto freeList = std::make_shared<LockedFreeList<Lock>>();
+
+            runner.Add({
+                .name = "LockCompare/" + lockName + "/FreeList",
+                .threadCounts = threadCounts,
+                .iterations = 1'000'000,
+                .body = [freeList](Int32 threadIndex, Int64 iterations)
+                {
+                    Int64 sum = 0;
+                    for (Int64 i = 0; i < iterations; ++i)
+                    {
+                        freeList->lock.LockWrite(kLockName);
+                        const Int64 chunk = freeList->freeList.back();
+                        freeList->freeList.pop_back();
+                        freeList->freeList.push_back(chunk + 1);
+                        freeList->lock.UnlockWrite(kLockName);
+                        sum += chunk;
+                    }
+                    DoNotOptimize(&sum);
+                },
+                .measureCpu = true,
+            });
+
+            runner.Add({
+                .name = "LockCompare/" + lockName + "/ReadMostly",
+                .threadCounts = threadCounts,
+                .iterations = 1'000'000,
+                .body = [freeList](Int32 threadIndex, Int64 iterations)
+                {
+                    Int64 sum = 0;
+                    for (Int64 i = 0; i < iterations; ++i)
+                    {
+                        if (i % kReadsPerWrite == 0)
+                        {
+                            freeList->lock.LockWrite(kLockName);
+                            ++freeList->freeList.front();
+                            freeList->lock.UnlockWrite(kLockName);
+                        }
+                        else
+                        {
+                            freeList->lock.LockRead(kLockName);
+                            sum += freeList->freeList.front();
+                            freeList->lock.UnlockRead(kLockName);
+                        }
+                    }
+                    DoNotOptimize(&sum);
+                },
+                .measureCpu = true,
+            });
+        }
+
+        /**
+         * 조회 스레드가 Find를 반복하는 동안 쓰기 스레드가 다른 키 범위에 Insert/Erase를 계속합니다.
+         *
+         * 앞쪽 kChurnWriterCount개 스레드가 쓰기 스레드이며 모든 조회 스레드가 끝날 때까지 갱신합니다.
+         * 결과의 연산 시간은 조회 기준이고, 쓰기 처리량은 background_ops_per_sec로 기록합니다.
+         * RcuMap은 갱신마다 스냅샷 복사와 회수 예약(Retire/Reclaim)이 일어나므로 그 비용도 함께 측정됩니다.
+         */
+        template <typename Map>
+        void AddChurnLookup(BenchmarkRunner& runner, const String8& mapName, const Vector<Int32>& threadCounts)
+        {
+            auto state = std::make_shared<ChurnState<Map>>();
+            for (Int64 key = 0; key < kMapSize; ++key)
+            {
+                state->map.Insert(key, key);
+            }
+
+            runner.Add({
+                .name = mapName + "/FindWithChurn",
+                .threadCounts = threadCounts,
+                .iterations = 500'000,
+                .setUp = [state](Int32 threadCount)
+                {
+                    state->readerCount = threadCount - kChurnWriterCount;
+                    state->finishedReaderCount.store(0);
+                    state->writerOpCount.store(0);
+                },
+                .body = [state](Int32 threadIndex, Int64 iterations)
+                {
+                    if (threadIndex < kChurnWriterCount)
+                    {
+                        Int64 opCount = 0;
+                        while (state->finishedReaderCount.load() < state->readerCount)
+                        {
+                            const Int64 key = kMapSize + threadIndex * kChurnKeyCount + (opCount / 2) % kChurnKeyCount;
+                            state->map.Insert(key, key);
+                            state->map.Erase(key);
+                            opCount += 2;
+                        }
+                        state->writerOpCount.fetch_add(opCount);
+                        return;
+                    }
+
+                    Int64 sum = 0;
+                    for (Int64 i = 0; i < iterations; ++i)
+                    {
+                        sum += state->map.Find(i & (kMapSize - 1));
+                    }
+                    DoNotOptimize(&sum);
+                    state->finishedReaderCount.fetch_add(1);
+                },
+                .backgroundThreadCount = kChurnWriterCount,
+                .takeBackgroundOps = [state]
+                {
+                    return state->writerOpCount.load();
+                },
+            });
+        }
+    } // namespace
+
+    void RegisterConcurrencyBenchmarks(BenchmarkRunner& runner)
+    {
+        auto locked = std::make_shared<LockedValue>();
+
+        runner.Add({
+            .name = "RwSpinLock/Write",
+            .threadCounts = {1, 4, 16},
+            .iterations = 200'000,
+            .body = [locked](Int32 threadIndex, Int64 iterations)
+            {
+                for (Int64 i = 0; i < iterations; ++i)
+                {
+                    RwSpinLock::WriteGuard guard(locked->lock, kLockName);
+                    ++locked->value;
+                }
+            },
+        });
+
+        runner.Add({
+            .name = "RwSpinLock/Read",
+            .threadCounts = {1, 4, 16},
+            .iterations = 200'000,
+            .body = [locked](Int32 threadIndex, Int64 iterations)
+            {
+                Int64 sum = 0;
+                for (Int64 i = 0; i < iterations; ++i)
+                {
+                    RwSpinLock::ReadGuard guard(locked->lock, kLockName);
+                    sum += locked->value;
+                }
+                DoNotOptimize(&sum);
+            },
+        });
+
+        runner.Add({
+            .name = "RwSpinLock/ReadMostly",
+            .threadCounts = {4, 16},
+            .iterations = 200'000,
+            .body = [locked](Int32 threadIndex, Int64 iterations)
+            {
+                Int64 sum = 0;
+                for (Int64 i = 0; i < iterations; ++i)
+                {
+                    if (i % kReadsPerWrite == 0)
+                    {
+                        RwSpinLock::WriteGuard guard(locked->lock, kLockName);
+                        ++locked->value;
+                    }
+                    else
+                    {
+                        RwSpinLock::ReadGuard guard(locked->lock, kLockName);
+                        sum += locked->value;
+                    }
+                }
+                DoNotOptimize(&sum);
+            },
+        });
+
+        // 현재 락(스핀 후 파킹)과 이전 락(스핀 후 양보) 비교, 마지막 스레드 수는 논리 프로세서 수의 두 배
+        const Int32 oversubscribedCount = std::max(static_cast_32(std::thread::hardware_concurrency()) * 2, 2);
+        const Vector<Int32> lockThreadCounts = {1, 4, oversubscribedCount};
+        AddLockComparison<RwSpinLock>(runner, "RwSpinLock", lockThreadCounts);
+        AddLockComparison<LegacySpinLock>(runner, "LegacySpinLock", lockThreadCounts);
+
+        // 입장/퇴장 갱신이 계속되는 동안의 조회: RCU 스냅샷과 이전 방식(조회도 WRITE_GUARD) 비교
+        const Vector<Int32> churnThreadCounts = {kChurnWriterCount + 4, kChurnWriterCount + 16};
+        AddChurnLookup<RcuChurnMap>(runner, "RcuMap", churnThreadCounts);
+        AddChurnLookup<LockedChurnMap>(runner, "RwSpinLockMap", churnThreadCounts);
+    }
+} // namespace bench
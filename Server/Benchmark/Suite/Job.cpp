@@ -0,0 +1,86 @@
+﻿/*    Benchmark/Suite/Job.cpp    */
+
+#include "Benchmark/Pch.h"
+#include "Benchmark/Suite/Suite.h"
+#include "Benchmark/Harness/Runner.h"
+#include "Core/Job/Queue.h"
+#include "Core/Job/Timer.h"
+
+using namespace core;
+
+namespace bench
+{
+    namespace
+    {
+        // 첫 번째 측정 스레드가 이 횟수마다 큐를 비움
+        constexpr Int64     kDrainInterval = 64;
+
+        // 잡 워커 없이 측정 스레드가 직접 비우므로 실행 카운터는 한 스레드에서만 갱신
+        struct JobTarget
+        {
+            SharedPtr<JobQueue>     queue = std::make_shared<JobQueue>();
+            Int64                   executedCount = 0;
+        };
+
+        SharedPtr<Job> MakeCountJob(JobTarget& target)
+        {
+            return std::make_shared<Job>([&target]
+                                         {
+                                             ++target.executedCount;
+                                         });
+        }
+    } // namespace
+
+    /**
+     * 잡 워커 스레드를 실행하지 않으므로 JobQueueManager::DrainQueues()로 등록된 큐를 호출 스레드에서 비웁니다.
+     * 여러 스레드로 측정할 때는 첫 번째 스레드만 비우고 나머지 스레드는 생산만 합니다.
+     */
+    void RegisterJobBenchmarks(BenchmarkRunner& runner)
+    {
+        auto target = std::make_shared<JobTarget>();
+
+        runner.Add({
+            .name = "JobQueue/PushFlush",
+            .threadCounts = {1, 4},
+            .iterations = 200'000,
+            .body = [target](Int32 threadIndex, Int64 iterations)
+            {
+                for (Int64 i = 1; i <= iterations; ++i)
+                {
+                    target->queue->Push(MakeCountJob(*target));
+                    if ((threadIndex == 0) && (i % kDrainInterval == 0))
+                    {
+                        gJobQueueManager->DrainQueues();
+                    }
+                }
+            },
+            .tearDown = []
+            {
+                gJobQueueManager->DrainQueues();
+            },
+        });
+
+        runner.Add({
+            .name = "JobTimer/ScheduleDistribute",
+            .threadCounts = {1, 4},
+            .iterations = 200'000,
+            .body = [target](Int32 threadIndex, Int64 iterations)
+            {
+                for (Int64 i = 1; i <= iterations; ++i)
+                {
+                    gJobTimer->Schedule(MakeCountJob(*target), target->queue, 0);
+                    if ((threadIndex == 0) && (i % kDrainInterval == 0))
+                    {
+                        gJobTimer->Distribute();
+                        gJobQueueManager->DrainQueues();
+                    }
+                }
+            },
+            .tearDown = []
+            {
+                gJobTimer->Distribute();
+                gJobQueueManager->DrainQueues();
+            },
+        });
+    }
+} // namespace bench
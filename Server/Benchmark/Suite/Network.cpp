@@ -0,0 +1,273 @@
+﻿/*    Benchmark/Suite/Network.cpp    */
+
+#include "Benchmark/Pch.h"
+#include "Benchmark/Suite/Suite.h"
+#include "Benchmark/Harness/Runner.h"
+#include "Protocol/Packet/Type.h"
+
+using namespace core;
+
+namespace bench
+{
+    namespace
+    {
+        // 세션의 수신 버퍼와 같은 크기
+        constexpr Int64     kReceiveBufferSize = 4096;
+        // 수신 완료 하나로 들어오는 크기 (이더넷 MSS)
+        constexpr Int64     kSegmentSize = 1460;
+        // 세그먼트 경계에 패킷이 걸치도록 MSS의 약수가 아닌 크기 사용
+        constexpr Int32     kPacketSize = 48;
+        constexpr Int64     kStreamPacketCount = 1024;
+
+        Vector<Byte> MakePacketStream()
+        {
+            Vector<Byte> stream(kPacketSize * kStreamPacketCount);
+            for (Int64 i = 0; i < kStreamPacketCount; ++i)
+            {
+                proto::PacketHeader* header = reinterpret_cast<proto::PacketHeader*>(stream.data() + i * kPacketSize);
+                header->size = kPacketSize;
+                header->id = proto::PacketId::C2S_Chat;
+            }
+
+            return stream;
+        }
+
+        /**
+         * 수신 완료 처리와 같은 순서로 수신 버퍼를 채우고 패킷 단위로 자릅니다.
+         *
+         * 동작:
+         * 1. 스트림에서 세그먼트 하나를 쓰기 위치에 복사하고 OnWritten
+         * 2. 헤더를 따라가며 완성된 패킷만 소비 (일부만 받은 패킷은 다음 세그먼트까지 유지)
+         * 3. OnRead 후 Clear로 남은 데이터를 정리
+         */
+        void RunReceiveFraming(const Vector<Byte>& stream, Int64 iterations)
+        {
+            ReceiveBuffer buffer(kReceiveBufferSize);
+            const Int64 streamSize = static_cast_64(stream.size());
+            Int64 streamPos = 0;
+            Int64 packetCount = 0;
+
+            for (Int64 i = 0; i < iterations; ++i)
+            {
+                const Int64 segmentSize = std::min(kSegmentSize, buffer.GetFreeSize());
+                ::memcpy(buffer.AtWritePos(), stream.data() + streamPos, segmentSize);
+                buffer.OnWritten(segmentSize);
+
+                const Byte* data = buffer.AtReadPos();
+                const Int64 dataSize = buffer.GetDataSize();
+                Int64 offset = 0;
+                while (dataSize - offset >= sizeof_64(proto::PacketHeader))
+                {
+                    const proto::PacketHeader* header = reinterpret_cast<const proto::PacketHeader*>(data + offset);
+                    if (header->size > dataSize - offset)
+                    {
+                        break;
+                    }
+                    offset += header->size;
+                    ++packetCount;
+                }
+
+                buffer.OnRead(offset);
+                buffer.Clear();
+
+                // 스트림 끝에 닿으면 같은 패킷 경계 위치에서 다시 시작
+                streamPos += segmentSize;
+                if (streamPos + kSegmentSize > streamSize)
+                {
+                    streamPos %= kPacketSize;
+                }
+            }
+
+            DoNotOptimize(&packetCount);
+        }
+
+        // 송신 완료 하나가 꺼내가는 버퍼 수
+        constexpr Int64     kSendBatchSize = 16;
+
+        // SendQueue의 노드를 풀 없이 할당하던 방식 (비교 기준)
+        struct HeapSendNode
+        {
+            HeapSendNode*           next = nullptr;
+            SharedPtr<SendBuffer>   sendBuf;
+        };
+
+        /**
+         * 세션 송신 경로와 같은 순서로 버퍼를 추가하고 한 번에 꺼냅니다.
+         *
+         * 동작:
+         * 1. kSendBatchSize개의 버퍼를 Push (첫 Push만 송신 시작을 담당)
+         * 2. PopAll로 SendBufferManager에 등록하고 송신 완료처럼 Clear
+         * 3. TryFinish로 송신 상태를 해제
+         */
+        void RunSendQueue(const SharedPtr<SendBuffer>& buffer, Int64 iterations)
+        {
+            SendQueue queue;
+            SendBufferManager bufferMgr;
+
+            for (Int64 i = 0; i < iterations; i += kSendBatchSize)
+            {
+                for (Int64 j = 0; j < kSendBatchSize; ++j)
+                {
+                    queue.Push(buffer);
+                }
+
+                queue.PopAll(bufferMgr);
+                bufferMgr.Clear();
+                queue.TryFinish();
+            }
+        }
+
+        // RunSendQueue와 같은 순서로 노드를 new/delete (풀 도입 전 비용)
+        void RunHeapSendNodes(const SharedPtr<SendBuffer>& buffer, Int64 iterations)
+        {
+            SendBufferManager bufferMgr;
+
+            for (Int64 i = 0; i < iterations; i += kSendBatchSize)
+            {
+                HeapSendNode* head = nullptr;
+                for (Int64 j = 0; j < kSendBatchSize; ++j)
+                {
+                    HeapSendNode* node = new HeapSendNode();
+                    node->sendBuf = buffer;
+                    node->next = head;
+                    head = node;
+                }
+
+                while (head != nullptr)
+                {
+                    HeapSendNode* next = head->next;
+                    bufferMgr.Register(std::move(head->sendBuf));
+                    delete head;
+                    head = next;
+                }
+                bufferMgr.Clear();
+            }
+        }
+
+        // 캐시 라인 배치 전 Session처럼 송신 생산자 필드와 수신 필드가 한 캐시 라인에 있는 배치
+        struct PackedSessionFields
+        {
+            Atomic<Int64>       sendCount = 0;          // 송신 생산자 (SendAsync)
+            Atomic<Bool>        isSending = false;
+            Atomic<Int64>       receiveWritePos = 0;    // 수신 완료 (입출력 워커)
+            Atomic<Int64>       receiveReadPos = 0;
+        };
+
+        // 현재 Session처럼 쓰는 스레드별로 캐시 라인을 나눈 배치
+        struct SplitSessionFields
+        {
+            alignas(64) Atomic<Int64>   sendCount = 0;
+            Atomic<Bool>                isSending = false;
+            alignas(64) Atomic<Int64>   receiveWritePos = 0;
+            Atomic<Int64>               receiveReadPos = 0;
+        };
+
+        /**
+         * 짝수 스레드는 송신 생산자, 홀수 스레드는 수신 완료를 처리하는 입출력 워커 역할로 자기 필드만 씁니다.
+         * 같은 캐시 라인이면 메시지마다 상대가 쓴 라인을 다시 가져와야 하므로 메시지당 시간 차이가 곧 캐시 미스 비용입니다.
+         */
+        template <typename Fields>
+        void RunSessionFieldWrites(Fields& fields, Int32 threadIndex, Int64 iterations)
+        {
+            if (threadIndex % 2 == 0)
+            {
+                for (Int64 i = 0; i < iterations; ++i)
+                {
+                    fields.sendCount.fetch_add(1, std::memory_order_relaxed);
+                    fields.isSending.store((i & 1) != 0, std::memory_order_relaxed);
+                }
+            }
+            else
+            {
+                for (Int64 i = 0; i < iterations; ++i)
+                {
+                    fields.receiveWritePos.store(i * kPacketSize, std::memory_order_relaxed);
+                    fields.receiveReadPos.store(i * kPacketSize, std::memory_order_relaxed);
+                }
+            }
+        }
+    } // namespace
+
+    void RegisterNetworkBenchmarks(BenchmarkRunner& runner)
+    {
+        auto stream = std::make_shared<Vector<Byte>>(MakePacketStream());
+
+        runner.Add({
+            .name = "ReceiveBuffer/Framing",
+            .threadCounts = {1},
+            .iterations = 1'000'000,
+            .body = [stream](Int32 threadIndex, Int64 iterations)
+            {
+                RunReceiveFraming(*stream, iterations);
+            },
+        });
+
+        // 스레드별 청크에서 잘라 쓰고, 청크를 다 쓰면 풀 락을 잡고 교체
+        for (const Int64 allocSize : {64, 512})
+        {
+            runner.Add({
+                .name = fmt::format("SendChunkPool/Alloc{}", allocSize),
+                .threadCounts = {1, 4, 16},
+                .iterations = 200'000,
+                .body = [allocSize](Int32 threadIndex, Int64 iterations)
+                {
+                    for (Int64 i = 0; i < iterations; ++i)
+                    {
+                        SharedPtr<SendBuffer> buffer = gSendChunkPool->Alloc(allocSize);
+                        buffer->OnWritten(allocSize);
+                        DoNotOptimize(buffer.get());
+                    }
+                },
+            });
+        }
+
+        // 세션마다 큐 하나, 노드 재사용 목록은 모든 스레드가 공유
+        runner.Add({
+            .name = "SendQueue/PushPopAll",
+            .threadCounts = {1, 4, 16},
+            .iterations = 1'000'000,
+            .body = [](Int32 threadIndex, Int64 iterations)
+            {
+                SharedPtr<SendBuffer> buffer = gSendChunkPool->Alloc(64);
+                buffer->OnWritten(64);
+                RunSendQueue(buffer, iterations);
+            },
+        });
+
+        runner.Add({
+            .name = "SendQueue/HeapNodes",
+            .threadCounts = {1, 4, 16},
+            .iterations = 1'000'000,
+            .body = [](Int32 threadIndex, Int64 iterations)
+            {
+                SharedPtr<SendBuffer> buffer = gSendChunkPool->Alloc(64);
+                buffer->OnWritten(64);
+                RunHeapSendNodes(buffer, iterations);
+            },
+        });
+
+        // Session 필드 배치에 따른 거짓 공유 비용 (송신 생산자 1 + 입출력 워커 1)
+        auto packedFields = std::make_shared<PackedSessionFields>();
+        auto splitFields = std::make_shared<SplitSessionFields>();
+
+        runner.Add({
+            .name = "SessionLayout/Packed",
+            .threadCounts = {2},
+            .iterations = 5'000'000,
+            .body = [packedFields](Int32 threadIndex, Int64 iterations)
+            {
+                RunSessionFieldWrites(*packedFields, threadIndex, iterations);
+            },
+        });
+
+        runner.Add({
+            .name = "SessionLayout/Split",
+            .threadCounts = {2},
+            .iterations = 5'000'000,
+            .body = [splitFields](Int32 threadIndex, Int64 iterations)
+            {
+                RunSessionFieldWrites(*splitFields, threadIndex, iterations);
+            },
+        });
+    }
+} // namespace bench
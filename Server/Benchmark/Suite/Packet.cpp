@@ -0,0 +1,223 @@
+﻿/*    Benchmark/Suite/Packet.cpp    */
+
+#include "Benchmark/Pch.h"
+#include "Benchmark/Suite/Suite.h"
+#include "Benchmark/Harness/Runner.h"
+#include "Protocol/Packet/Dispatcher.h"
+#include "Protocol/Packet/Assembler.h"
+#include "Protocol/Packet/Utils.h"
+#include "Protocol/Packet/Compression.h"
+
+using namespace core;
+using namespace proto;
+
+namespace bench
+{
+    namespace
+    {
+        // 채팅 한 줄 정도의 페이로드
+        constexpr Int64     kMessageLength = 32;
+        // 여러 프레임으로 나뉘는 큰 페이로드
+        constexpr Int64     kLargeMessageLength = 64 * 1024;
+        // 압축 효과를 볼 수 있는 브로드캐스트 크기의 페이로드
+        constexpr Int64     kCompressMessageLength = 1024;
+        // 수신 완료 하나에 들어오는 패킷 수
+        constexpr Int64     kPacketsPerReceive = 16;
+
+        C2S_Chat MakeChatPayload(Int64 messageLength = kMessageLength)
+        {
+            C2S_Chat payload;
+            payload.set_id(1);
+            payload.set_message(String8(messageLength, 'a'));
+
+            return payload;
+        }
+
+        // 반복되는 필드가 섞인 채팅 로그 형태의 메시지 (같은 문자만 반복하면 압축률이 비현실적으로 높음)
+        C2S_Chat MakeChatLogPayload(Int64 messageLength)
+        {
+            String8 message;
+            for (Int64 i = 0; static_cast_64(message.size()) < messageLength; ++i)
+            {
+                message += fmt::format("[{}] Player{}: message {} in room {}\n", 1'700'000'000 + i * 37, i % 97, i * 7919, i % 5);
+            }
+            message.resize(messageLength);
+
+            C2S_Chat payload;
+            payload.set_id(1);
+            payload.set_message(std::move(message));
+
+            return payload;
+        }
+
+        SharedPtr<RawPacket> MakeChatPacket()
+        {
+            SharedPtr<SendBuffer> buffer = PacketUtils::MakeSendBuffer(MakeChatPayload(), PacketId::C2S_Chat);
+            return std::make_shared<RawPacket>(nullptr, buffer->GetBuffer());
+        }
+
+        // 채팅 패킷 하나만 처리하는 디스패처 (페이로드 역직렬화까지 측정)
+        class BenchmarkDispatcher
+            : public PacketDispatcher
+        {
+        public:
+                            BenchmarkDispatcher() { RegisterAllHandlers(); }
+
+        protected:
+            virtual void    RegisterAllHandlers() override
+            {
+                RegisterHandler<C2S_Chat>(&Handle_C2S_Chat, PacketId::C2S_Chat);
+            }
+
+        private:
+            static Bool     Handle_C2S_Chat(const SharedPtr<Session>& owner, const C2S_Chat& payload)
+            {
+                DoNotOptimize(&payload);
+                return true;
+            }
+        };
+    } // namespace
+
+    void RegisterPacketBenchmarks(BenchmarkRunner& runner)
+    {
+        runner.Add({
+            .name = "PacketUtils/MakeSendBuffer",
+            .threadCounts = {1, 4},
+            .iterations = 200'000,
+            .body = [](Int32 threadIndex, Int64 iterations)
+            {
+                const C2S_Chat payload = MakeChatPayload();
+                for (Int64 i = 0; i < iterations; ++i)
+                {
+                    SharedPtr<SendBuffer> buffer = PacketUtils::MakeSendBuffer(payload, PacketId::C2S_Chat);
+                    DoNotOptimize(buffer.get());
+                }
+            },
+        });
+
+        // 송신 청크의 프레임들에 바로 직렬화 (중간 버퍼 없음)
+        runner.Add({
+            .name = "PacketUtils/MakeSendBuffers64K",
+            .threadCounts = {1, 4},
+            .iterations = 5'000,
+            .body = [](Int32 threadIndex, Int64 iterations)
+            {
+                const C2S_Chat payload = MakeChatPayload(kLargeMessageLength);
+                for (Int64 i = 0; i < iterations; ++i)
+                {
+                    Vector<SharedPtr<SendBuffer>> buffers = PacketUtils::MakeSendBuffers(payload, PacketId::C2S_Chat);
+                    DoNotOptimize(buffers.data());
+                }
+            },
+        });
+
+        // 브로드캐스트 한 번의 압축 비용 (사전 없이 레벨 1)
+        runner.Add({
+            .name = "PacketCompressor/Compress1K",
+            .threadCounts = {1, 4},
+            .iterations = 20'000,
+            .body = [](Int32 threadIndex, Int64 iterations)
+            {
+                const SharedPtr<SendBuffer> frame = PacketUtils::MakeSendBuffer(MakeChatLogPayload(kCompressMessageLength), PacketId::C2S_Chat);
+                for (Int64 i = 0; i < iterations; ++i)
+                {
+                    Vector<SharedPtr<SendBuffer>> frames = PacketCompressor::GetInstance().Compress(frame);
+                    DoNotOptimize(frames.data());
+                }
+            },
+        });
+
+        // 수신 측의 재조립과 해제 비용
+        runner.Add({
+            .name = "PacketAssembler/Decompress1K",
+            .threadCounts = {1},
+            .iterations = 50'000,
+            .body = [](Int32 threadIndex, Int64 iterations)
+            {
+                const SharedPtr<SendBuffer> frame = PacketUtils::MakeSendBuffer(MakeChatLogPayload(kCompressMessageLength), PacketId::C2S_Chat);
+                const Vector<SharedPtr<SendBuffer>> frames = PacketCompressor::GetInstance().Compress(frame);
+                ASSERT_CRASH(frames.size() == 1, "COMPRESSION_NOT_EFFECTIVE");
+
+                PacketAssembler assembler;
+                assembler.SetCompressionAllowed(true);
+                SharedPtr<RawPacket> packet;
+                for (Int64 i = 0; i < iterations; ++i)
+                {
+                    assembler.Assemble(nullptr, frames[0]->GetBuffer(), OUT packet);
+                    DoNotOptimize(packet.get());
+                }
+            },
+        });
+
+        // 핸들러 테이블 크기가 크므로 힙에 생성
+        auto dispatcher = std::make_shared<BenchmarkDispatcher>();
+        runner.Add({
+            .name = "PacketDispatcher/DispatchPacket",
+            .threadCounts = {1},
+            .iterations = 500'000,
+            .body = [dispatcher](Int32 threadIndex, Int64 iterations)
+            {
+                const SharedPtr<RawPacket> packet = MakeChatPacket();
+                for (Int64 i = 0; i < iterations; ++i)
+                {
+                    const Bool result = dispatcher->DispatchPacket(packet);
+                    DoNotOptimize(&result);
+                }
+            },
+        });
+
+        // 입출력 워커(생산자)와 게임 루프(소비자)가 같은 큐를 공유하는 상황
+        auto queue = std::make_shared<PacketQueue>();
+        runner.Add({
+            .name = "PacketQueue/PushPop",
+            .threadCounts = {1, 4},
+            .iterations = 500'000,
+            .body = [queue](Int32 threadIndex, Int64 iterations)
+            {
+                const SharedPtr<RawPacket> packet = MakeChatPacket();
+                SharedPtr<RawPacket> popped;
+                for (Int64 i = 0; i < iterations; ++i)
+                {
+                    queue->Push(packet);
+                    queue->TryPop(OUT popped);
+                }
+                DoNotOptimize(popped.get());
+            },
+            .tearDown = [queue]
+            {
+                SharedPtr<RawPacket> popped;
+                while (queue->TryPop(OUT popped))
+                {
+                }
+            },
+        });
+
+        // 수신 완료 하나를 패킷으로 잘라 큐에 넣고 모두 꺼냄 (RawPacket 할당과 복사 포함)
+        runner.Add({
+            .name = fmt::format("PacketQueue/PushReceive{}", kPacketsPerReceive),
+            .threadCounts = {1},
+            .iterations = 100'000,
+            .body = [queue](Int32 threadIndex, Int64 iterations)
+            {
+                const SharedPtr<RawPacket> packet = MakeChatPacket();
+                const Byte* data = reinterpret_cast<const Byte*>(packet->GetHeader());
+                Vector<Byte> received;
+                for (Int64 i = 0; i < kPacketsPerReceive; ++i)
+                {
+                    received.insert(received.end(), data, data + packet->GetSize());
+                }
+
+                PacketAssembler assembler;
+                SharedPtr<RawPacket> popped;
+                for (Int64 i = 0; i < iterations; ++i)
+                {
+                    queue->Push(nullptr, assembler, received.data(), static_cast_64(received.size()));
+                    while (queue->TryPop(OUT popped))
+                    {
+                    }
+                }
+                DoNotOptimize(popped.get());
+            },
+        });
+    }
+} // namespace bench
@@ -0,0 +1,17 @@
+﻿/*    Benchmark/Suite/Suite.h    */
+
+#pragma once
+
+namespace bench
+{
+    class BenchmarkRunner;
+
+    // 수신 버퍼 프레이밍, 송신 청크 풀, 송신 큐, 세션 필드 배치(거짓 공유)
+    void RegisterNetworkBenchmarks(BenchmarkRunner& runner);
+    // 송신 버퍼 생성, 패킷 디스패치, 패킷 큐
+    void RegisterPacketBenchmarks(BenchmarkRunner& runner);
+    // 읽기/쓰기 스핀 락 (이전 락과 비교), 갱신 중 RCU 맵 조회 (이전 쓰기 락 맵과 비교)
+    void RegisterConcurrencyBenchmarks(BenchmarkRunner& runner);
+    // 잡 큐, 잡 타이머
+    void RegisterJobBenchmarks(BenchmarkRunner& runner);
+} // namespace bench
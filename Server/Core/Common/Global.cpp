@@ -4,7 +4,10 @@
 #include "Core/Log/Logger.h"
 #include "Core/Concurrency/Thread.h"
 #include "Core/Concurrency/Deadlock.h"
+#include "Core/Concurrency/Epoch.h"
+#include "Core/Concurrency/Profiler.h"
 #include "Core/Network/Socket.h"
+#include "Core/Metric/Metric.h"
 
 namespace core
 {
@@ -12,29 +15,46 @@ namespace core
     ThreadManager* gThreadManager = nullptr;
     DeadlockDetector* gDeadlockDetector = nullptr;
     SendChunkPool* gSendChunkPool = nullptr;
+    CoroutineFramePool* gCoroutineFramePool = nullptr;
     JobQueueManager* gJobQueueManager = nullptr;
     JobTimer* gJobTimer = nullptr;
+    EpochManager* gEpochManager = nullptr;
+    LockProfiler* gLockProfiler = nullptr;
+    LockOrderChecker* gLockOrderChecker = nullptr;
+    MetricRegistry* gMetricRegistry = nullptr;
 
     GlobalContext::GlobalContext()
     {
+        // 다른 전역 객체가 락을 사용하기 전에 생성
+        gLockProfiler = new LockProfiler();
+        gLockOrderChecker = new LockOrderChecker();
+        // 다른 전역 객체가 생성자에서 메트릭을 등록하므로 먼저 생성
+        gMetricRegistry = new MetricRegistry();
         gLogger = new Logger(TEXT_8("GlobalLogger"));
         gThreadManager = new ThreadManager();
         gDeadlockDetector = new DeadlockDetector();
         gSendChunkPool = new SendChunkPool();
         SocketUtils::Init();
+        gCoroutineFramePool = new CoroutineFramePool();
         gJobQueueManager = new JobQueueManager();
         gJobTimer = new JobTimer();
+        gEpochManager = new EpochManager();
     }
 
     GlobalContext::~GlobalContext()
     {
+        delete gEpochManager;
         delete gJobTimer;
         delete gJobQueueManager;
+        delete gCoroutineFramePool;
         SocketUtils::Cleanup();
         delete gSendChunkPool;
         delete gDeadlockDetector;
         delete gThreadManager;
         delete gLogger;
+        delete gMetricRegistry;
+        delete gLockOrderChecker;
+        delete gLockProfiler;
     }
 
     GlobalContext   gGlobalContext;
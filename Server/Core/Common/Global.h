@@ -8,8 +8,13 @@ namespace core
     extern class ThreadManager* gThreadManager;
     extern class DeadlockDetector* gDeadlockDetector;
     extern class SendChunkPool* gSendChunkPool;
+    extern class CoroutineFramePool* gCoroutineFramePool;
     extern class JobQueueManager* gJobQueueManager;
     extern class JobTimer* gJobTimer;
+    extern class EpochManager* gEpochManager;
+    extern class LockProfiler* gLockProfiler;
+    extern class LockOrderChecker* gLockOrderChecker;
+    extern class MetricRegistry* gMetricRegistry;
 
     class GlobalContext
     {
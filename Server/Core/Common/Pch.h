@@ -9,10 +9,13 @@
 #include <WinSock2.h>
 #include <MSWSock.h>
 #include <WS2tcpip.h>
+#include <intrin.h>
 #pragma comment(lib, "Ws2_32.lib")
 
 // STL
 #include <iostream>
+#include <fstream>
+#include <filesystem>
 #include <shared_mutex>
 #include <thread>
 #include <atomic>
@@ -26,8 +29,12 @@
 #include <set>
 #include <unordered_set>
 #include <chrono>
+#include <bit>
+#include <cmath>
 #include <string>
 #include <string_view>
+#include <variant>
+#include <coroutine>
 
 // moodycamel
 #include <concurrentqueue/concurrentqueue.h>
@@ -38,6 +45,7 @@
 #include "Core/Common/Global.h"
 #include "Core/Common/Tls.h"
 #include "Core/Log/Logger.h"
+#include "Core/Concurrency/Profiler.h"
 #include "Core/Concurrency/Lock.h"
 #include "Core/Network/Buffer.h"
 #include "Core/Job/Serializer.h"
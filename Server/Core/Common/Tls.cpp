@@ -1,10 +1,16 @@
 ﻿/*    Core/Common/Tls.cpp    */
 
 #include "Core/Pch.h"
+#include "Core/Concurrency/Thread.h"
 
 namespace core
 {
     thread_local Int32                      tThreadId = 0;
+    thread_local ThreadRole                 tThreadRole = ThreadRole::General;
+    thread_local ThreadArena*               tThreadArena = nullptr;
     thread_local Stack<Int32>               tLockStack;
     thread_local SharedPtr<SendChunk>       tSendChunk;
+    thread_local LockProfile*               tLockProfile = nullptr;
+    thread_local UInt64                     tHeldLockMask = 0;
+    thread_local LogRing*                   tLogRing = nullptr;
 } // namespace core
@@ -5,8 +5,17 @@
 namespace core
 {
     class SendChunk;
+    struct LockProfile;
+    class ThreadArena;
+    class LogRing;
+    enum class ThreadRole : Int32;
 
     extern thread_local Int32                       tThreadId;
+    extern thread_local ThreadRole                  tThreadRole;
+    extern thread_local ThreadArena*                tThreadArena;
     extern thread_local Stack<Int32>                tLockStack;
     extern thread_local SharedPtr<SendChunk>        tSendChunk;
+    extern thread_local LockProfile*                tLockProfile;
+    extern thread_local UInt64                      tHeldLockMask;
+    extern thread_local LogRing*                    tLogRing;
 } // namespace core
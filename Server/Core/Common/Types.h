@@ -60,6 +60,9 @@ using Stack             = std::stack<T, Container>;
 template<typename T, typename Container = Vector<T>, typename Pr = std::less<typename Container::value_type>>
 using PriorityQueue     = std::priority_queue<T, Container, Pr>;
 
+template<typename... Ts>
+using Variant           = std::variant<Ts...>;
+
 template<typename T>    
 using LockfreeQueue     = moodycamel::ConcurrentQueue<T>;
 
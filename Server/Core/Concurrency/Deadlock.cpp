@@ -165,4 +165,160 @@ namespace core
 
         mDfsFinished[current] = true;
     }
+
+    /*
+     * 락 이름을 정수 ID로 등록하는 메서드
+     *
+     * 락 객체가 처음 잠길 때 한 번만 호출되며, 반환된 ID는 락 객체에 캐시됩니다.
+     *
+     * @param name 락의 식별자 (보통 클래스 타입 이름)
+     * @return 락 ID, 등록 가능한 수를 넘으면 kInvalidLockId
+     */
+    Int32 LockOrderChecker::RegisterLock(const Char8* name)
+    {
+        SrwLockWriteGuard guard(mRegisterLock);
+
+        auto nameIter = mNameToId.find(name);
+        if (nameIter != mNameToId.end())
+        {
+            return nameIter->second;
+        }
+
+        const Int32 lockId = static_cast<Int32>(mNameToId.size());
+        if (lockId >= kMaxLockCount)
+        {
+            return kInvalidLockId;
+        }
+
+        mNameToId[name] = lockId;
+        mIdToName[lockId] = name;
+
+        return lockId;
+    }
+
+    /*
+     * 락 획득 시 호출되는 메서드
+     *
+     * 보유 중인 모든 락에서 새 락으로 향하는 간선을 확인합니다.
+     * 이미 기록된 간선이면 비트 연산만으로 끝나고, 새 간선일 때만 사이클을 검사합니다.
+     * 같은 이름의 락을 중복해서 획득하려는 시도를 감지하여 방지합니다.
+     *
+     * @param lockId 획득한 락의 ID
+     */
+    void LockOrderChecker::PushLock(Int32 lockId)
+    {
+        if (lockId == kInvalidLockId)
+        {
+            return;
+        }
+
+        const UInt64 lockBit = 1ULL << lockId;
+        if ((tHeldLockMask & lockBit) != 0)
+        {
+            mViolationCount.fetch_add(1, std::memory_order_relaxed);
+            gLogger->Error(TEXT_8("Lock order: {} locked again while held"), mIdToName[lockId]);
+            return;
+        }
+
+        UInt64 heldMask = tHeldLockMask;
+        while (heldMask != 0)
+        {
+            unsigned long heldId = 0;
+            ::_BitScanForward64(&heldId, heldMask);
+            heldMask &= (heldMask - 1);
+
+            // 새로 발견한 잠금 순서라면 데드락 여부 확인
+            if ((mEdges[heldId].load(std::memory_order_relaxed) & lockBit) == 0)
+            {
+                AddEdge(static_cast<Int32>(heldId), lockId);
+            }
+        }
+
+        tHeldLockMask |= lockBit;
+    }
+
+    /*
+     * 락 해제 시 호출되는 메서드
+     *
+     * @param lockId 해제한 락의 ID
+     */
+    void LockOrderChecker::PopLock(Int32 lockId)
+    {
+        if (lockId == kInvalidLockId)
+        {
+            return;
+        }
+
+        const UInt64 lockBit = 1ULL << lockId;
+        if ((tHeldLockMask & lockBit) == 0)
+        {
+            mViolationCount.fetch_add(1, std::memory_order_relaxed);
+            gLogger->Error(TEXT_8("Lock order: {} unlocked while not held"), mIdToName[lockId]);
+            return;
+        }
+
+        tHeldLockMask &= ~lockBit;
+    }
+
+    /*
+     * 간선을 추가하고 사이클을 검사하는 메서드
+     *
+     * 간선을 먼저 기록한 뒤 역방향 경로를 찾으므로, 두 스레드가 동시에 반대 방향의
+     * 간선을 추가하더라도 최소 한 스레드는 상대의 간선을 보고 사이클을 감지합니다.
+     *
+     * @param from 먼저 잠근 락 ID
+     * @param to 나중에 잠근 락 ID
+     */
+    void LockOrderChecker::AddEdge(Int32 from, Int32 to)
+    {
+        const UInt64 prevEdges = mEdges[from].fetch_or(1ULL << to);
+        if (prevEdges & (1ULL << to))
+        {
+            // 다른 스레드가 먼저 기록한 간선
+            return;
+        }
+
+        // 간선마다 한 번만 여기에 도달하므로 같은 위반을 반복해서 기록하지 않음
+        if (IsReachable(to, from))
+        {
+            mViolationCount.fetch_add(1, std::memory_order_relaxed);
+            gLogger->Error(TEXT_8("Lock order: {} -> {} conflicts with existing lock order"), mIdToName[from], mIdToName[to]);
+        }
+    }
+
+    /*
+     * 간선 행렬에서 from에서 to로 가는 경로가 있는지 확인하는 메서드
+     *
+     * 방문한 정점 집합을 비트마스크로 유지하며 너비 우선으로 확장합니다.
+     */
+    Bool LockOrderChecker::IsReachable(Int32 from, Int32 to) const
+    {
+        const UInt64 targetBit = 1ULL << to;
+        UInt64 visited = 0;
+        UInt64 frontier = 1ULL << from;
+
+        while (frontier != 0)
+        {
+            visited |= frontier;
+
+            UInt64 next = 0;
+            while (frontier != 0)
+            {
+                unsigned long current = 0;
+                ::_BitScanForward64(&current, frontier);
+                frontier &= (frontier - 1);
+
+                next |= mEdges[current].load();
+            }
+
+            if (next & targetBit)
+            {
+                return true;
+            }
+
+            frontier = next & ~visited;
+        }
+
+        return false;
+    }
 } // namespace core
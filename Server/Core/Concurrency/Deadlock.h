@@ -2,6 +2,17 @@
 
 #pragma once
 
+/*
+ * 릴리즈 빌드의 락 순서 검사 (0: 끔, 1: 켬)
+ *
+ * 켜면 모든 RwSpinLock 잠금/해제마다 LockOrderChecker를 거치므로 기본값은 끔이다.
+ * 부하 테스트 빌드는 전처리기 정의로 LOCK_ORDER_CHECK=1을 지정한다.
+ * 디버그 빌드는 이 값과 무관하게 DeadlockDetector를 사용한다.
+ */
+#ifndef LOCK_ORDER_CHECK
+#define LOCK_ORDER_CHECK                    0
+#endif // LOCK_ORDER_CHECK
+
 namespace core
 {
     /*
@@ -42,4 +53,47 @@ namespace core
         Vector<Bool>    mDfsFinished;
         Vector<Int32>   mParent;
     };
+
+    /*
+     * LockOrderChecker 클래스
+     *
+     * 목적:
+     * - 릴리즈 빌드(부하 테스트)에서도 켜 둘 수 있는 가벼운 락 순서 검사기
+     * - DeadlockDetector와 같은 잠금 순서 그래프를 전역 락 없이 유지
+     *
+     * 동작 방식:
+     * - 락 이름은 처음 사용될 때 정수 ID로 등록되고, ID는 락 객체에 캐시됨
+     * - 스레드가 보유한 락은 스레드 로컬 비트셋(tHeldLockMask)으로 관리
+     * - 간선은 ID별 원자적 비트마스크 행렬(mEdges)에 기록
+     * - 보유 중인 락 -> 새 락 간선이 처음 나타날 때만 도달 가능성 검사 수행
+     * - 위반(순서 사이클, 중복 잠금/해제)은 크래시 대신 로그로 남기고 횟수를 셈
+     *
+     * 제한:
+     * - 최대 kMaxLockCount개의 락 이름까지 추적하며, 초과한 이름은 검사하지 않음
+     */
+    class LockOrderChecker
+    {
+    public:
+        Int32           RegisterLock(const Char8* name);
+        void            PushLock(Int32 lockId);
+        void            PopLock(Int32 lockId);
+
+        Int64           GetViolationCount() const { return mViolationCount.load(std::memory_order_relaxed); }
+
+    public:
+        static constexpr Int32      kInvalidLockId = -1;
+        static constexpr Int32      kMaxLockCount = 64;
+
+    private:
+        void            AddEdge(Int32 from, Int32 to);
+        Bool            IsReachable(Int32 from, Int32 to) const;
+
+    private:
+        SRWLOCK                         mRegisterLock = SRWLOCK_INIT;
+        HashMap<const Char8*, Int32>    mNameToId;
+        const Char8*                    mIdToName[kMaxLockCount] = {};
+
+        Atomic<UInt64>                  mEdges[kMaxLockCount] = {};
+        Atomic<Int64>                   mViolationCount = 0;
+    };
 } // namespace core
@@ -0,0 +1,211 @@
+﻿/*    Core/Concurrency/Epoch.cpp    */
+
+#include "Core/Pch.h"
+#include "Core/Concurrency/Epoch.h"
+
+namespace core
+{
+    namespace
+    {
+        // 스레드가 점유한 슬롯 (스레드가 종료될 때 반납)
+        struct EpochSlotOwner
+        {
+            Int32   slotIndex = -1;
+
+            ~EpochSlotOwner()
+            {
+                if ((slotIndex >= 0) && (gEpochManager != nullptr))
+                {
+                    gEpochManager->ReleaseSlot(slotIndex);
+                }
+            }
+        };
+
+        thread_local EpochSlotOwner tEpochSlotOwner;
+    } // namespace
+
+    EpochManager::EpochManager()
+    {
+        for (Slot& slot : mSlots)
+        {
+            slot.epoch.store(kInactiveEpoch);
+        }
+    }
+
+    EpochManager::~EpochManager()
+    {
+        // 종료 시점에는 읽기 스레드가 없으므로 모두 해제
+        for (RetiredEntry& entry : mRetired)
+        {
+            entry.deleter();
+        }
+        mRetired.clear();
+    }
+
+    /**
+     * 에포크 임계 구역에 진입합니다.
+     *
+     * 동작:
+     * 1. 현재 스레드의 슬롯을 찾음 (처음 진입하는 스레드는 빈 슬롯을 점유)
+     * 2. 최초 진입이면 전역 에포크를 슬롯에 게시
+     * 3. 중첩 진입이면 깊이만 증가
+     */
+    void EpochManager::Enter()
+    {
+        Slot& slot = GetCurrentSlot();
+        if (slot.depth.fetch_add(1, std::memory_order_relaxed) == 0)
+        {
+            // 게시 이후의 포인터 읽기가 앞당겨지지 않도록 순차 일관성으로 저장
+            slot.epoch.store(mGlobalEpoch.load());
+        }
+    }
+
+    /**
+     * 에포크 임계 구역에서 이탈합니다.
+     *
+     * 동작:
+     * 1. 깊이를 감소
+     * 2. 가장 바깥 구역이면 슬롯을 비활성 상태로 변경
+     */
+    void EpochManager::Exit()
+    {
+        Slot& slot = GetCurrentSlot();
+        ASSERT_CRASH_DEBUG(slot.depth.load(std::memory_order_relaxed) > 0, "INVALID_EPOCH_EXIT");
+
+        if (slot.depth.fetch_sub(1, std::memory_order_relaxed) == 1)
+        {
+            slot.epoch.store(kInactiveEpoch, std::memory_order_release);
+        }
+    }
+
+    /**
+     * 더 이상 공유되지 않는 객체의 해제를 예약합니다.
+     *
+     * @param deleter 객체를 해제하는 함수
+     *
+     * 동작:
+     * 1. 전역 에포크를 증가시키고 이전 값을 회수 에포크로 기록
+     * 2. 회수 목록에 등록
+     * 3. 목록이 임계값 이상이면 회수 시도
+     */
+    void EpochManager::Retire(Function<void(void)> deleter)
+    {
+        const UInt64 epoch = mGlobalEpoch.fetch_add(1);
+
+        Int64 retiredCount = 0;
+        {
+            SrwLockWriteGuard guard(mRetireLock);
+            mRetired.push_back({epoch, std::move(deleter)});
+            retiredCount = static_cast_64(mRetired.size());
+        }
+
+        if (retiredCount >= kReclaimThreshold)
+        {
+            Reclaim();
+        }
+    }
+
+    /**
+     * 모든 활성 스레드가 지나간 객체를 해제합니다.
+     *
+     * 동작:
+     * 1. 활성 슬롯의 최소 에포크 계산
+     * 2. 최소 에포크보다 이전에 등록된 항목을 목록에서 분리
+     * 3. 락을 해제한 뒤 분리한 항목의 해제 함수 호출
+     */
+    void EpochManager::Reclaim()
+    {
+        const UInt64 minEpoch = GetMinActiveEpoch();
+
+        Vector<RetiredEntry> reclaimable;
+        {
+            SrwLockWriteGuard guard(mRetireLock);
+
+            auto it = std::partition(mRetired.begin(), mRetired.end(),
+                                     [minEpoch](const RetiredEntry& entry)
+                                     {
+                                         return entry.epoch >= minEpoch;
+                                     });
+
+            reclaimable.assign(std::make_move_iterator(it), std::make_move_iterator(mRetired.end()));
+            mRetired.erase(it, mRetired.end());
+        }
+
+        for (RetiredEntry& entry : reclaimable)
+        {
+            entry.deleter();
+        }
+    }
+
+    /**
+     * 현재 스레드가 사용할 빈 슬롯을 점유합니다.
+     *
+     * @return 점유한 슬롯 인덱스
+     *
+     * 동작:
+     * 1. 앞에서부터 사용 중이 아닌 슬롯을 찾아 원자적으로 사용 중으로 변경
+     * 2. 점유한 슬롯이 기존 범위 밖이면 최소 에포크 계산 범위를 넓힘
+     * 3. 동시에 살아 있는 스레드가 kMaxThreadCount를 넘으면 크래시 발생
+     */
+    Int32 EpochManager::AcquireSlot()
+    {
+        for (Int32 i = 0; i < kMaxThreadCount; ++i)
+        {
+            Bool expected = false;
+            if (mSlots[i].isUsed.load(std::memory_order_relaxed) ||
+                !mSlots[i].isUsed.compare_exchange_strong(OUT expected, true))
+            {
+                continue;
+            }
+
+            Int32 slotCount = mSlotCount.load();
+            while ((slotCount <= i) && !mSlotCount.compare_exchange_weak(OUT slotCount, i + 1))
+            {
+            }
+
+            return i;
+        }
+
+        CRASH("EPOCH_SLOT_OVERFLOW");
+        return -1;
+    }
+
+    /**
+     * 종료하는 스레드의 슬롯을 반납합니다.
+     *
+     * @param slotIndex 반납할 슬롯 인덱스
+     *
+     * 임계 구역 안에서 종료하는 경우는 없지만, 다음 스레드가 이어받지 않도록 비활성 상태로 되돌린 뒤 반납합니다.
+     */
+    void EpochManager::ReleaseSlot(Int32 slotIndex)
+    {
+        Slot& slot = mSlots[slotIndex];
+        ASSERT_CRASH_DEBUG(slot.depth.load(std::memory_order_relaxed) == 0, "EPOCH_SLOT_RELEASED_IN_CRITICAL_SECTION");
+
+        slot.depth.store(0, std::memory_order_relaxed);
+        slot.epoch.store(kInactiveEpoch, std::memory_order_release);
+        slot.isUsed.store(false, std::memory_order_release);
+    }
+
+    EpochManager::Slot& EpochManager::GetCurrentSlot()
+    {
+        if (tEpochSlotOwner.slotIndex < 0)
+        {
+            tEpochSlotOwner.slotIndex = AcquireSlot();
+        }
+
+        return mSlots[tEpochSlotOwner.slotIndex];
+    }
+
+    UInt64 EpochManager::GetMinActiveEpoch() const
+    {
+        UInt64 minEpoch = kInactiveEpoch;
+        const Int32 slotCount = mSlotCount.load();
+        for (Int32 i = 0; i < slotCount; ++i)
+        {
+            minEpoch = std::min(minEpoch, mSlots[i].epoch.load());
+        }
+
+        return minEpoch;
+    }
+} // namespace core
@@ -0,0 +1,93 @@
+﻿/*    Core/Concurrency/Epoch.h    */
+
+#pragma once
+
+namespace core
+{
+    /*
+     * EpochManager - 에포크 기반 메모리 회수(EBR)
+     *
+     * 주요 기능:
+     * - 읽기 스레드는 임계 구역 진입 시 현재 전역 에포크를 자신의 슬롯에 게시
+     * - 쓰기 스레드는 교체된 객체를 즉시 해제하지 않고 회수 목록에 등록
+     * - 활성 슬롯의 최소 에포크보다 이전에 등록된 객체만 해제
+     *
+     * 특징:
+     * - 읽기 경로는 락 없이 원자적 저장 1회로 동작 (대기 없음)
+     * - 스레드는 처음 진입할 때 빈 슬롯을 하나 점유하고, 종료할 때 반납 (스레드 ID와 무관)
+     * - 동시에 살아 있는 스레드 수가 kMaxThreadCount 이하이면 스레드가 몇 번 교체되어도 동작
+     * - 슬롯은 캐시 라인 단위로 정렬되고 모든 상태가 원자적
+     * - 같은 스레드의 중첩 진입 허용
+     */
+    class EpochManager
+    {
+    public:
+                        EpochManager();
+                        ~EpochManager();
+
+        void            Enter();
+        void            Exit();
+        void            Retire(Function<void(void)> deleter);
+        void            Reclaim();
+
+        Int32           AcquireSlot();
+        void            ReleaseSlot(Int32 slotIndex);
+
+    private:
+        struct alignas(64) Slot
+        {
+            Atomic<UInt64>      epoch;
+            Atomic<Int32>       depth = 0;
+            Atomic<Bool>        isUsed = false;
+        };
+
+        struct RetiredEntry
+        {
+            UInt64                  epoch;
+            Function<void(void)>    deleter;
+        };
+
+        UInt64          GetMinActiveEpoch() const;
+        Slot&           GetCurrentSlot();
+
+    private:
+        static constexpr Int32      kMaxThreadCount = 256;
+        static constexpr UInt64     kInactiveEpoch = ~0ULL;
+        static constexpr Int64      kReclaimThreshold = 64;
+
+    private:
+        alignas(64) Atomic<UInt64>  mGlobalEpoch = 1;
+        Slot                        mSlots[kMaxThreadCount];
+        Atomic<Int32>               mSlotCount = 0; // 한 번이라도 점유된 슬롯 범위 (최소 에포크 계산 범위)
+
+        SRWLOCK                     mRetireLock = SRWLOCK_INIT;
+        Vector<RetiredEntry>        mRetired;
+    };
+
+    /*
+     * EpochGuard - 에포크 임계 구역을 위한 RAII 래퍼
+     *
+     * 사용 예시:
+     * {
+     *     EpochGuard guard;
+     *     // 공유 스냅샷 읽기
+     * } // 스코프 종료 시 자동으로 임계 구역 이탈
+     */
+    class EpochGuard
+    {
+    public:
+        EpochGuard()
+        {
+            gEpochManager->Enter();
+        }
+
+        ~EpochGuard()
+        {
+            gEpochManager->Exit();
+        }
+
+        // 복사 금지
+        EpochGuard(const EpochGuard&) = delete;
+        EpochGuard& operator=(const EpochGuard&) = delete;
+    };
+} // namespace core
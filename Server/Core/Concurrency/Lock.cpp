@@ -3,53 +3,37 @@
 #include "Core/Pch.h"
 #include "Core/Concurrency/Deadlock.h"
 
+// WaitOnAddress, WakeByAddressAll
+#pragma comment(lib, "Synchronization.lib")
+
 namespace core
 {
     /**
      * 쓰기 잠금을 획득합니다.
      *
-     * @param name 락 식별자 (디버깅용)
+     * @param name 락 식별자 (디버깅, 통계용)
      *
      * 동작:
-     * 1. 디버그 모드에서 데드락 감지기에 락 획득 정보 기록
+     * 1. 디버그 모드에서 데드락 감지기, LOCK_ORDER_CHECK를 켠 릴리즈 모드에서 락 순서 검사기에 락 획득 정보 기록
      * 2. 원자적으로 플래그를 쓰기 상태로 변경 시도
-     * 3. 획득 실패 시 지수적 백오프로 재시도
-     * 4. 설정 시간 초과시 크래시 발생
+     * 3. 실패 시 경합 경로(LockWriteSlow)에서 대기
      */
     void RwSpinLock::LockWrite(const Char8* name)
     {
 #ifdef _DEBUG
         gDeadlockDetector->PushLock(name);
+#elif LOCK_ORDER_CHECK
+        gLockOrderChecker->PushLock(GetOrderId(name));
 #endif // _DEBUG
 
-        const UInt64 beginTick = ::GetTickCount64();
-        Int32 backoff = 1;
-        while (true)
+        UInt64 expected = kEmptyFlag;
+        if (mLockFlag.compare_exchange_strong(OUT expected, kWriteFlag))
         {
-            UInt64 expected = kEmptyFlag;
-            if (mLockFlag.compare_exchange_weak(OUT expected, kWriteFlag))
-            {
-                // 쓰기 잠금 성공
-                return;
-            }
-            // backoff만큼 대기
-            for (Int32 i = 0; i < backoff; ++i)
-            {
-                ::_mm_pause();
-            }
-
-            if (backoff < kMaxBackoff)
-            {
-                // 대기 시간 지수적으로 증가
-                backoff <<= 1;
-            }
-            else
-            {
-                // 대기 시간이 너무 길어지면 스레드를 양보
-                std::this_thread::yield();
-                ASSERT_CRASH(::GetTickCount64() - beginTick < kLockTimeoutMs, "LOCK_TIMEOUT");
-            }
+            // 쓰기 잠금 성공
+            return;
         }
+
+        LockWriteSlow(name);
     }
 
     /**
@@ -58,84 +42,228 @@ namespace core
      * @param name 락 식별자 (디버깅용)
      *
      * 동작:
-     * 1. 디버그 모드에서 데드락 감지기에서 락 해제 정보 기록
-     * 2. 원자적으로 플래그를 빈 상태로 변경
+     * 1. 디버그 모드에서 데드락 감지기, LOCK_ORDER_CHECK를 켠 릴리즈 모드에서 락 순서 검사기에 락 해제 정보 기록
+     * 2. 원자적으로 쓰기 플래그만 제거 (대기 중인 쓰기 스레드 수는 유지)
      * 3. 이전 상태가 쓰기 상태가 아니면 크래시 발생
+     * 4. 재워진 스레드가 있으면 깨움
      */
     void RwSpinLock::UnlockWrite(const Char8* name)
     {
 #ifdef _DEBUG
         gDeadlockDetector->PopLock(name);
+#elif LOCK_ORDER_CHECK
+        gLockOrderChecker->PopLock(GetOrderId(name));
 #endif // _DEBUG
 
-        const UInt64 prevFlag = mLockFlag.fetch_and(kEmptyFlag);
-        ASSERT_CRASH_DEBUG(prevFlag == kWriteFlag, "INVALID_UNLOCK");
+        const UInt64 prevFlag = mLockFlag.fetch_and(~kWriteFlag);
+        ASSERT_CRASH_DEBUG((prevFlag & (kWriteFlag | kReadCountMask)) == kWriteFlag, "INVALID_UNLOCK");
+
+        WakeParked();
     }
 
     /**
      * 읽기 잠금을 획득합니다.
      *
-     * @param name 락 식별자 (디버깅용)
+     * @param name 락 식별자 (디버깅, 통계용)
      *
      * 동작:
-     * 1. 디버그 모드에서 데드락 감지기에 락 획득 정보 기록
-     * 2. 원자적으로 읽기 카운트를 증가 시도
-     * 3. 획득 실패 시 지수적 백오프로 재시도
-     * 4. 설정 시간 초과시 크래시 발생
+     * 1. 디버그 모드에서 데드락 감지기, LOCK_ORDER_CHECK를 켠 릴리즈 모드에서 락 순서 검사기에 락 획득 정보 기록
+     * 2. 쓰기 잠금이 없으면 원자적으로 읽기 카운트를 증가 시도
+     *    (쓰기 우선 모드에서는 대기 중인 쓰기 스레드도 없어야 함)
+     * 3. 실패 시 경합 경로(LockReadSlow)에서 대기
      */
     void RwSpinLock::LockRead(const Char8* name)
     {
 #ifdef _DEBUG
         gDeadlockDetector->PushLock(name);
+#elif LOCK_ORDER_CHECK
+        gLockOrderChecker->PushLock(GetOrderId(name));
 #endif // _DEBUG
 
+        const UInt64 blockMask = mWriterPreferred ? (kWriteFlag | kWaitingWriterMask) : kWriteFlag;
+
+        UInt64 expected = mLockFlag.load();
+        if (((expected & blockMask) == 0) &&
+            mLockFlag.compare_exchange_strong(OUT expected, expected + 1))
+        {
+            // 읽기 잠금 성공
+            return;
+        }
+
+        LockReadSlow(name);
+    }
+
+    /**
+     * 읽기 잠금을 해제합니다.
+     *
+     * @param name 락 식별자 (디버깅용)
+     *
+     * 동작:
+     * 1. 디버그 모드에서 데드락 감지기, LOCK_ORDER_CHECK를 켠 릴리즈 모드에서 락 순서 검사기에 락 해제 정보 기록
+     * 2. 원자적으로 읽기 카운트를 감소
+     * 3. 이전 상태가 유효하지 않으면 크래시 발생
+     * 4. 마지막 읽기 잠금이었고 재워진 스레드가 있으면 깨움
+     */
+    void RwSpinLock::UnlockRead(const Char8* name)
+    {
+#ifdef _DEBUG
+        gDeadlockDetector->PopLock(name);
+#elif LOCK_ORDER_CHECK
+        gLockOrderChecker->PopLock(GetOrderId(name));
+#endif // _DEBUG
+
+        const UInt64 prevFlag = mLockFlag.fetch_sub(1);
+        ASSERT_CRASH_DEBUG((prevFlag & kReadCountMask) && !(prevFlag & kWriteFlag), "INVALID_UNLOCK");
+
+        if ((prevFlag & kReadCountMask) == 1)
+        {
+            WakeParked();
+        }
+    }
+
+    /**
+     * 경합 중인 쓰기 잠금을 획득합니다.
+     *
+     * 동작:
+     * 1. 락이 비어 있으면 쓰기 플래그 설정 시도 (대기 등록했으면 대기 수도 감소)
+     * 2. 비어 있지 않으면 지수적 백오프로 kMaxBackoff까지 스핀
+     * 3. 스핀 한도를 넘으면 쓰기 우선 모드에서 대기 수를 등록해 새 읽기 잠금을 막음
+     * 4. 현재 플래그 값이 바뀔 때까지 스레드를 재움
+     * 5. 획득 후 LockProfiler에 대기 시간 기록
+     */
+    void RwSpinLock::LockWriteSlow(const Char8* name)
+    {
         const UInt64 beginTick = ::GetTickCount64();
+        const Int64 waitBeginCycles = static_cast_64(__rdtsc());
+        Bool parked = false;
+        Bool waiting = false;
         Int32 backoff = 1;
         while (true)
         {
-            UInt64 expected = (mLockFlag.load() & kReadCountMask);
-            if (mLockFlag.compare_exchange_weak(OUT expected, expected + 1))
+            UInt64 flag = mLockFlag.load();
+            if ((flag & (kWriteFlag | kReadCountMask)) == 0)
             {
-                // 읽기 잠금 성공
-                return;
+                const UInt64 desired = (waiting ? (flag - kWaitingWriterUnit) : flag) | kWriteFlag;
+                if (mLockFlag.compare_exchange_weak(OUT flag, desired))
+                {
+                    // 쓰기 잠금 성공
+                    break;
+                }
+                continue;
             }
-            // backoff만큼 대기
-            for (Int32 i = 0; i < backoff; ++i)
+
+            if (backoff <= kMaxBackoff)
             {
-                ::_mm_pause();
+                // backoff만큼 대기 후 지수적으로 증가
+                for (Int32 i = 0; i < backoff; ++i)
+                {
+                    ::_mm_pause();
+                }
+                backoff <<= 1;
+                continue;
             }
 
-            if (backoff < kMaxBackoff)
+            if (mWriterPreferred && !waiting)
             {
-                // 대기 시간 지수적으로 증가
-                backoff <<= 1;
+                // 대기 중인 쓰기 스레드로 등록
+                mLockFlag.fetch_add(kWaitingWriterUnit);
+                waiting = true;
+                continue;
             }
-            else
+
+            Park(flag, beginTick);
+            parked = true;
+        }
+
+        gLockProfiler->RecordContention(name, parked, static_cast_64(__rdtsc()) - waitBeginCycles);
+    }
+
+    /**
+     * 경합 중인 읽기 잠금을 획득합니다.
+     *
+     * 동작:
+     * 1. 쓰기 잠금이 없으면 (쓰기 우선 모드에서는 대기 중인 쓰기 스레드도 없으면) 읽기 카운트 증가 시도
+     * 2. 실패하면 지수적 백오프로 kMaxBackoff까지 스핀
+     * 3. 스핀 한도를 넘으면 현재 플래그 값이 바뀔 때까지 스레드를 재움
+     * 4. 획득 후 LockProfiler에 대기 시간 기록
+     */
+    void RwSpinLock::LockReadSlow(const Char8* name)
+    {
+        const UInt64 blockMask = mWriterPreferred ? (kWriteFlag | kWaitingWriterMask) : kWriteFlag;
+        const UInt64 beginTick = ::GetTickCount64();
+        const Int64 waitBeginCycles = static_cast_64(__rdtsc());
+        Bool parked = false;
+        Int32 backoff = 1;
+        while (true)
+        {
+            UInt64 flag = mLockFlag.load();
+            if ((flag & blockMask) == 0)
+            {
+                if (mLockFlag.compare_exchange_weak(OUT flag, flag + 1))
+                {
+                    // 읽기 잠금 성공
+                    break;
+                }
+                continue;
+            }
+
+            if (backoff <= kMaxBackoff)
             {
-                // 대기 시간이 너무 길어지면 스레드를 양보
-                std::this_thread::yield();
-                ASSERT_CRASH(::GetTickCount64() - beginTick < kLockTimeoutMs, "LOCK_TIMEOUT");
+                // backoff만큼 대기 후 지수적으로 증가
+                for (Int32 i = 0; i < backoff; ++i)
+                {
+                    ::_mm_pause();
+                }
+                backoff <<= 1;
+                continue;
             }
+
+            Park(flag, beginTick);
+            parked = true;
         }
+
+        gLockProfiler->RecordContention(name, parked, static_cast_64(__rdtsc()) - waitBeginCycles);
     }
 
     /**
-     * 읽기 잠금을 해제합니다.
+     * 플래그 값이 관찰한 값에서 바뀔 때까지 스레드를 재웁니다.
      *
-     * @param name 락 식별자 (디버깅용)
+     * @param observedFlag 마지막으로 관찰한 플래그 값
+     * @param beginTick 잠금 시도를 시작한 시각
      *
      * 동작:
-     * 1. 디버그 모드에서 데드락 감지기에서 락 해제 정보 기록
-     * 2. 원자적으로 읽기 카운트를 감소
-     * 3. 이전 상태가 유효하지 않으면 크래시 발생
+     * 1. 설정 시간 초과시 크래시 발생
+     * 2. 재워진 스레드 수를 먼저 증가시켜 해제 스레드가 깨우기를 놓치지 않게 함
+     * 3. 플래그가 이미 바뀌었으면 WaitOnAddress가 즉시 반환
      */
-    void RwSpinLock::UnlockRead(const Char8* name)
+    void RwSpinLock::Park(UInt64 observedFlag, UInt64 beginTick)
     {
-#ifdef _DEBUG
-        gDeadlockDetector->PopLock(name);
-#endif // _DEBUG
+        const UInt64 elapsedMs = ::GetTickCount64() - beginTick;
+        ASSERT_CRASH(elapsedMs < kLockTimeoutMs, "LOCK_TIMEOUT");
 
-        const UInt64 prevFlag = mLockFlag.fetch_sub(1);
-        ASSERT_CRASH_DEBUG(prevFlag && (prevFlag < kWriteFlag), "INVALID_UNLOCK");
+        mParkedCount.fetch_add(1);
+        ::WaitOnAddress(&mLockFlag, &observedFlag, sizeof(observedFlag), static_cast<DWORD>(kLockTimeoutMs - elapsedMs));
+        mParkedCount.fetch_sub(1);
+    }
+
+    void RwSpinLock::WakeParked()
+    {
+        if (mParkedCount.load() > 0)
+        {
+            ::WakeByAddressAll(&mLockFlag);
+        }
+    }
+
+    // 락 이름의 순서 검사 ID (처음 잠글 때 등록 후 캐시)
+    Int32 RwSpinLock::GetOrderId(const Char8* name)
+    {
+        Int32 orderId = mOrderId.load(std::memory_order_relaxed);
+        if (orderId == kUnregisteredOrderId)
+        {
+            orderId = gLockOrderChecker->RegisterLock(name);
+            mOrderId.store(orderId, std::memory_order_relaxed);
+        }
+
+        return orderId;
     }
 } // namespace core
@@ -5,17 +5,21 @@
 namespace core
 {
     /*
-     * RwSpinLock - 읽기-쓰기 스핀 락 구현
+     * RwSpinLock - 읽기-쓰기 적응형 락 구현
      *
-     * 락 비트 플래그 구조: [WRRR'RRRR]
+     * 락 비트 플래그 구조: [0000'PPPP'WRRR'RRRR]
+     * P: 대기 중인 쓰기 스레드 수 (0x0000'FFFF'0000'0000, 쓰기 우선 모드에서만 사용)
      * W: 쓰기 잠금 플래그 (0xF000'0000)
      * R: 읽기 잠금 카운트 (0x0FFF'FFFF)
      *
      * 특징:
      * - 쓰기 작업 시 배타적 잠금, 읽기 작업 시 공유 잠금
-     * - 스핀 대기 방식으로 짧은 임계 구역에 적합
+     * - 지수적 백오프로 짧게 스핀한 뒤 WaitOnAddress로 스레드를 재움
+     * - 해제 시 재워진 스레드가 있을 때만 WakeByAddressAll 호출
+     * - 쓰기 우선 모드에서는 대기 중인 쓰기 스레드가 있으면 새 읽기 잠금을 막음
+     * - 가드로 획득한 락은 LockProfiler에 락 이름별 획득/경합/보유 시간 기록
      * - 재귀 잠금 금지(정의되지 않은 동작 발생)
-     * - 디버그 모드에서 데드락 감지 지원
+     * - 디버그 모드에서 데드락 감지, LOCK_ORDER_CHECK를 켠 릴리즈 모드에서 락 순서 검사 지원
      */
     class RwSpinLock
     {
@@ -25,6 +29,8 @@ namespace core
         void    LockRead(const Char8* name);
         void    UnlockRead(const Char8* name);
 
+        void    SetWriterPreferred(Bool writerPreferred) { mWriterPreferred = writerPreferred; }
+
     public:
         class WriteGuard
         {
@@ -34,11 +40,13 @@ namespace core
                 , mName(name)
             {
                 mLock.LockWrite(mName);
+                mAcquireCycles = static_cast_64(__rdtsc());
             }
 
             ~WriteGuard()
             {
                 mLock.UnlockWrite(mName);
+                gLockProfiler->RecordRelease(mName, static_cast_64(__rdtsc()) - mAcquireCycles);
             }
 
             // 복사 금지
@@ -48,6 +56,7 @@ namespace core
         private:
             RwSpinLock& mLock;
             const Char8* mName;
+            Int64 mAcquireCycles = 0;
         };
 
         class ReadGuard
@@ -58,11 +67,13 @@ namespace core
                 , mName(name)
             {
                 mLock.LockRead(mName);
+                mAcquireCycles = static_cast_64(__rdtsc());
             }
 
             ~ReadGuard()
             {
                 mLock.UnlockRead(mName);
+                gLockProfiler->RecordRelease(mName, static_cast_64(__rdtsc()) - mAcquireCycles);
             }
 
             // 복사 금지
@@ -72,17 +83,31 @@ namespace core
         private:
             RwSpinLock& mLock;
             const Char8* mName;
+            Int64 mAcquireCycles = 0;
         };
 
+    private:
+        void    LockWriteSlow(const Char8* name);
+        void    LockReadSlow(const Char8* name);
+        void    Park(UInt64 observedFlag, UInt64 beginTick);
+        void    WakeParked();
+        Int32   GetOrderId(const Char8* name);
+
     private:
         static constexpr UInt64     kWriteFlag = 0xF000'0000;
         static constexpr UInt64     kEmptyFlag = 0x0000'0000;
         static constexpr UInt64     kReadCountMask = 0x0FFF'FFFF;
+        static constexpr UInt64     kWaitingWriterUnit = 0x0000'0001'0000'0000;
+        static constexpr UInt64     kWaitingWriterMask = 0x0000'FFFF'0000'0000;
         static constexpr Int32      kLockTimeoutMs = 10'000;
         static constexpr Int32      kMaxBackoff = 1'024;
+        static constexpr Int32      kUnregisteredOrderId = -2;
 
     private:
         Atomic<UInt64>              mLockFlag = kEmptyFlag;
+        Atomic<Int32>               mParkedCount = 0;
+        Bool                        mWriterPreferred = false;
+        Atomic<Int32>               mOrderId = kUnregisteredOrderId;
     };
 
     /*
@@ -0,0 +1,251 @@
+﻿/*    Core/Concurrency/Profiler.cpp    */
+
+#include "Core/Pch.h"
+#include "Core/Concurrency/Profiler.h"
+
+namespace core
+{
+    namespace
+    {
+        // 소유 스레드만 쓰므로 원자적 RMW 대신 relaxed load/store로 누적
+        void Accumulate(Atomic<Int64>& counter, Int64 value)
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        void StoreMax(Atomic<Int64>& counter, Int64 value)
+        {
+            if (counter.load(std::memory_order_relaxed) < value)
+            {
+                counter.store(value, std::memory_order_relaxed);
+            }
+        }
+    } // namespace
+
+    LockProfiler::LockProfiler()
+    {
+        LARGE_INTEGER counter;
+        ::QueryPerformanceCounter(&counter);
+
+        mBeginCounter = counter.QuadPart;
+        mBeginCycles = static_cast_64(__rdtsc());
+    }
+
+    /**
+     * 락 해제 시 획득 횟수와 보유 시간을 기록합니다.
+     *
+     * @param name 락 이름
+     * @param holdCycles 락을 보유한 시간 (TSC 사이클)
+     */
+    void LockProfiler::RecordRelease(const Char8* name, Int64 holdCycles)
+    {
+        LockProfile::Counter* counter = FindCounter(name);
+        if (counter == nullptr)
+        {
+            return;
+        }
+
+        Accumulate(counter->acquireCount, 1);
+        Accumulate(counter->holdHistogram[GetHoldBucket(holdCycles)], 1);
+    }
+
+    /**
+     * 빠른 경로에 실패한 락 획득의 대기 시간을 기록합니다.
+     *
+     * @param name 락 이름
+     * @param parked 스핀 이후 스레드가 재워졌는지 여부
+     * @param waitCycles 획득까지 대기한 시간 (TSC 사이클)
+     */
+    void LockProfiler::RecordContention(const Char8* name, Bool parked, Int64 waitCycles)
+    {
+        LockProfile::Counter* counter = FindCounter(name);
+        if (counter == nullptr)
+        {
+            return;
+        }
+
+        Accumulate(counter->contendedCount, 1);
+        Accumulate(counter->parkCount, parked ? 1 : 0);
+        Accumulate(counter->totalWaitCycles, waitCycles);
+        StoreMax(counter->maxWaitCycles, waitCycles);
+    }
+
+    /**
+     * 모든 스레드의 기록을 락 이름별로 병합합니다.
+     *
+     * @return 락 이름별 누적 통계
+     *
+     * 동작:
+     * 1. 등록된 스레드 테이블 목록을 읽기 잠금으로 보호
+     * 2. 이름이 기록된 카운터만 relaxed 읽기로 합산
+     *    (기록 중인 스레드와 겹치면 한 번의 기록 차이만큼 오차가 생길 수 있음)
+     */
+    HashMap<const Char8*, LockProfiler::Stats> LockProfiler::Collect()
+    {
+        HashMap<const Char8*, Stats> merged;
+
+        SrwLockReadGuard guard(mProfilesLock);
+        for (const auto& profile : mProfiles)
+        {
+            for (const LockProfile::Counter& counter : profile->counters)
+            {
+                const Char8* name = counter.name.load(std::memory_order_acquire);
+                if (name == nullptr)
+                {
+                    continue;
+                }
+
+                Stats& stats = merged[name];
+                stats.acquireCount += counter.acquireCount.load(std::memory_order_relaxed);
+                stats.contendedCount += counter.contendedCount.load(std::memory_order_relaxed);
+                stats.parkCount += counter.parkCount.load(std::memory_order_relaxed);
+                stats.totalWaitCycles += counter.totalWaitCycles.load(std::memory_order_relaxed);
+                stats.maxWaitCycles = std::max(stats.maxWaitCycles, counter.maxWaitCycles.load(std::memory_order_relaxed));
+                for (Int32 i = 0; i < LockProfile::kHoldBucketCount; ++i)
+                {
+                    stats.holdHistogram[i] += counter.holdHistogram[i].load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        return merged;
+    }
+
+    /**
+     * 병합한 통계를 총 대기 시간이 긴 순서로 출력합니다.
+     */
+    void LockProfiler::LogStats()
+    {
+        HashMap<const Char8*, Stats> merged = Collect();
+
+        Vector<std::pair<const Char8*, Stats>> sorted(merged.begin(), merged.end());
+        std::sort(sorted.begin(), sorted.end(),
+                  [](const auto& lhs, const auto& rhs)
+                  {
+                      return lhs.second.totalWaitCycles > rhs.second.totalWaitCycles;
+                  });
+
+        const Float64 cyclesPerUs = GetCyclesPerUs();
+        for (const auto& [name, stats] : sorted)
+        {
+            gLogger->Info(TEXT_8("Lock[{}]: Acquired={}, Contended={}, Parked={}, TotalWait={:.1f} us, MaxWait={:.1f} us, HoldP50<={:.2f} us, HoldP99<={:.2f} us"),
+                          name, stats.acquireCount, stats.contendedCount, stats.parkCount,
+                          stats.totalWaitCycles / cyclesPerUs, stats.maxWaitCycles / cyclesPerUs,
+                          GetHoldPercentile(stats, 0.50) / cyclesPerUs, GetHoldPercentile(stats, 0.99) / cyclesPerUs);
+        }
+    }
+
+    /**
+     * 현재 스레드의 테이블에서 락 이름에 해당하는 카운터를 찾습니다.
+     *
+     * @param name 락 이름
+     * @return 카운터, 테이블이 가득 찼으면 nullptr
+     *
+     * 동작:
+     * 1. 스레드의 첫 기록이면 테이블을 생성해 프로파일러에 등록
+     * 2. 이름 포인터를 해시해 선형 탐사
+     * 3. 빈 칸을 만나면 이름을 기록하고 새 카운터로 사용
+     */
+    LockProfile::Counter* LockProfiler::FindCounter(const Char8* name)
+    {
+        LockProfile* profile = tLockProfile;
+        if (profile == nullptr)
+        {
+            profile = RegisterThread();
+            tLockProfile = profile;
+        }
+
+        constexpr UInt64 kMask = LockProfile::kMaxLockNameCount - 1;
+        const UInt64 hash = (reinterpret_cast<UInt64>(name) >> 3) * 0x9E37'79B9'7F4A'7C15ULL;
+        for (UInt64 i = 0; i < LockProfile::kMaxLockNameCount; ++i)
+        {
+            LockProfile::Counter& counter = profile->counters[((hash >> 32) + i) & kMask];
+
+            const Char8* current = counter.name.load(std::memory_order_relaxed);
+            if (current == name)
+            {
+                return &counter;
+            }
+
+            if (current == nullptr)
+            {
+                counter.name.store(name, std::memory_order_release);
+                return &counter;
+            }
+        }
+
+        return nullptr;
+    }
+
+    LockProfile* LockProfiler::RegisterThread()
+    {
+        auto profile = std::make_unique<LockProfile>();
+        LockProfile* result = profile.get();
+
+        SrwLockWriteGuard guard(mProfilesLock);
+        mProfiles.push_back(std::move(profile));
+
+        return result;
+    }
+
+    // 생성 시점부터 경과한 QPC 시간과 TSC 사이클로 주파수를 추정
+    Float64 LockProfiler::GetCyclesPerUs() const
+    {
+        LARGE_INTEGER counter;
+        LARGE_INTEGER frequency;
+        ::QueryPerformanceCounter(&counter);
+        ::QueryPerformanceFrequency(&frequency);
+
+        const Float64 elapsedUs = static_cast<Float64>(counter.QuadPart - mBeginCounter) * 1'000'000.0 / frequency.QuadPart;
+        const Float64 elapsedCycles = static_cast<Float64>(static_cast_64(__rdtsc()) - mBeginCycles);
+        if ((elapsedUs <= 0.0) || (elapsedCycles <= 0.0))
+        {
+            return 1.0;
+        }
+
+        return elapsedCycles / elapsedUs;
+    }
+
+    // 구간 0: [0, 2^8), 구간 i: [2^(i+7), 2^(i+8)), 마지막 구간은 그 이상 모두 포함
+    Int32 LockProfiler::GetHoldBucket(Int64 holdCycles)
+    {
+        const UInt64 shifted = static_cast<UInt64>(std::max<Int64>(holdCycles, 0)) >> kHoldBucketShift;
+        if (shifted == 0)
+        {
+            return 0;
+        }
+
+        unsigned long index = 0;
+        ::_BitScanReverse64(&index, shifted);
+
+        return std::min(static_cast_32(index) + 1, LockProfile::kHoldBucketCount - 1);
+    }
+
+    // 백분위수가 속한 구간의 상한 (사이클)
+    Int64 LockProfiler::GetHoldPercentile(const Stats& stats, Float64 percentile)
+    {
+        Int64 total = 0;
+        for (Int64 count : stats.holdHistogram)
+        {
+            total += count;
+        }
+
+        if (total == 0)
+        {
+            return 0;
+        }
+
+        const Int64 target = static_cast_64(total * percentile);
+        Int64 accumulated = 0;
+        for (Int32 i = 0; i < LockProfile::kHoldBucketCount; ++i)
+        {
+            accumulated += stats.holdHistogram[i];
+            if ((accumulated > target) || (i == LockProfile::kHoldBucketCount - 1))
+            {
+                return 1LL << (i + kHoldBucketShift);
+            }
+        }
+
+        return 0;
+    }
+} // namespace core
@@ -0,0 +1,90 @@
+﻿/*    Core/Concurrency/Profiler.h    */
+
+#pragma once
+
+namespace core
+{
+    /*
+     * LockProfile - 스레드 하나의 락 이름별 누적 카운터
+     *
+     * 특징:
+     * - 소유 스레드만 쓰고 LockProfiler::Collect()만 읽음
+     * - 쓰기는 relaxed load/store로만 수행 (원자적 RMW 없음)
+     * - 락 이름 포인터로 인덱싱하는 고정 크기 개방 주소 해시 테이블
+     */
+    struct LockProfile
+    {
+        static constexpr Int32      kMaxLockNameCount = 64;
+        static constexpr Int32      kHoldBucketCount = 16;
+
+        struct Counter
+        {
+            Atomic<const Char8*>    name = nullptr;
+            Atomic<Int64>           acquireCount = 0;
+            Atomic<Int64>           contendedCount = 0;
+            Atomic<Int64>           parkCount = 0;
+            Atomic<Int64>           totalWaitCycles = 0;
+            Atomic<Int64>           maxWaitCycles = 0;
+            Atomic<Int64>           holdHistogram[kHoldBucketCount] = {};
+        };
+
+        Counter                     counters[kMaxLockNameCount];
+    };
+
+    /*
+     * LockProfiler - 락 이름별 경합 프로파일러
+     *
+     * 수집 항목 (RW_LOCK 매크로가 넘기는 typeid 이름 단위):
+     * - 획득 횟수, 경합(빠른 경로 실패) 횟수, 재워진 횟수
+     * - 대기 시간 합계/최대값
+     * - 보유 시간 히스토그램 (TSC 사이클 기준 2의 거듭제곱 구간)
+     *
+     * 동작 방식:
+     * - 각 스레드는 자신의 LockProfile(tLockProfile)에만 기록하므로 락이나 공유 캐시 라인 경합이 없음
+     * - LockProfile은 프로파일러가 소유하므로 스레드가 종료되어도 기록이 남음
+     * - Collect()가 주기적으로 호출되어 모든 스레드의 기록을 병합
+     * - 시간은 __rdtsc()로 측정하고 출력할 때만 마이크로초로 변환
+     */
+    class LockProfiler
+    {
+    public:
+        struct Stats
+        {
+            Int64       acquireCount = 0;
+            Int64       contendedCount = 0;
+            Int64       parkCount = 0;
+            Int64       totalWaitCycles = 0;
+            Int64       maxWaitCycles = 0;
+            Int64       holdHistogram[LockProfile::kHoldBucketCount] = {};
+        };
+
+    public:
+                        LockProfiler();
+
+        void            RecordRelease(const Char8* name, Int64 holdCycles);
+        void            RecordContention(const Char8* name, Bool parked, Int64 waitCycles);
+
+        HashMap<const Char8*, Stats>    Collect();
+        void                            LogStats();
+
+    private:
+        LockProfile::Counter*   FindCounter(const Char8* name);
+        LockProfile*            RegisterThread();
+        Float64                 GetCyclesPerUs() const;
+
+        static Int32            GetHoldBucket(Int64 holdCycles);
+        static Int64            GetHoldPercentile(const Stats& stats, Float64 percentile);
+
+    private:
+        // 보유 시간 첫 구간의 상한 (2^kHoldBucketShift 사이클)
+        static constexpr Int32      kHoldBucketShift = 8;
+
+    private:
+        SRWLOCK                             mProfilesLock = SRWLOCK_INIT;
+        Vector<UniquePtr<LockProfile>>      mProfiles;
+
+        // TSC 주파수 환산 기준점
+        Int64                               mBeginCycles = 0;
+        Int64                               mBeginCounter = 0;
+    };
+} // namespace core
@@ -0,0 +1,131 @@
+﻿/*    Core/Concurrency/Rcu.h    */
+
+#pragma once
+
+#include "Core/Concurrency/Epoch.h"
+
+namespace core
+{
+    /*
+     * RcuMap - 읽기 위주 컨테이너를 위한 RCU(Copy-On-Write) 해시 맵
+     *
+     * 주요 기능:
+     * - 읽기는 불변 스냅샷 포인터를 원자적으로 읽어 락 없이 조회
+     * - 쓰기는 스냅샷을 복사해 수정한 뒤 포인터를 교체
+     * - 교체된 스냅샷은 EpochManager를 통해 안전한 시점에 해제
+     *
+     * 특징:
+     * - 쓰기 작업끼리는 SRWLOCK으로 직렬화
+     * - 쓰기 비용은 원소 수에 비례하므로 입장/퇴장처럼 드문 갱신에 적합
+     * - ForEach 콜백 안에서 같은 맵을 수정해도 현재 순회에는 영향 없음
+     */
+    template<typename K, typename V>
+    class RcuMap
+    {
+    public:
+        using Snapshot = HashMap<K, V>;
+
+    public:
+        RcuMap()
+            : mSnapshot(new Snapshot())
+        {}
+
+        ~RcuMap()
+        {
+            delete mSnapshot.load();
+        }
+
+        // 복사 금지
+        RcuMap(const RcuMap&) = delete;
+        RcuMap& operator=(const RcuMap&) = delete;
+
+        Bool Insert(const K& key, V value)
+        {
+            return Update([&key, &value](Snapshot& snapshot)
+                          {
+                              return snapshot.insert({key, std::move(value)}).second;
+                          });
+        }
+
+        Bool Erase(const K& key)
+        {
+            return Update([&key](Snapshot& snapshot)
+                          {
+                              return (snapshot.erase(key) > 0);
+                          });
+        }
+
+        // 없으면 기본값 반환
+        V Find(const K& key) const
+        {
+            EpochGuard guard;
+
+            const Snapshot* snapshot = mSnapshot.load(std::memory_order_acquire);
+            auto it = snapshot->find(key);
+            if (it != snapshot->end())
+            {
+                return it->second;
+            }
+
+            return V();
+        }
+
+        template<typename Func>
+        void ForEach(Func&& func) const
+        {
+            EpochGuard guard;
+
+            const Snapshot* snapshot = mSnapshot.load(std::memory_order_acquire);
+            for (const auto& [key, value] : *snapshot)
+            {
+                func(key, value);
+            }
+        }
+
+        Int64 Size() const
+        {
+            EpochGuard guard;
+            return static_cast_64(mSnapshot.load(std::memory_order_acquire)->size());
+        }
+
+    private:
+        /**
+         * 스냅샷을 복사해 수정하고 교체합니다.
+         *
+         * @param mutate 복사본을 수정하고 변경 여부를 반환하는 함수
+         * @return 변경이 발생하면 true
+         *
+         * 동작:
+         * 1. 쓰기 락 획득 후 현재 스냅샷 복사
+         * 2. 복사본 수정, 변경이 없으면 복사본 폐기
+         * 3. 포인터 교체 후 이전 스냅샷 회수 예약
+         */
+        template<typename Func>
+        Bool Update(Func&& mutate)
+        {
+            Snapshot* prevSnapshot = nullptr;
+            {
+                SrwLockWriteGuard guard(mWriteLock);
+
+                Snapshot* current = mSnapshot.load(std::memory_order_relaxed);
+                UniquePtr<Snapshot> next = std::make_unique<Snapshot>(*current);
+                if (mutate(*next) == false)
+                {
+                    return false;
+                }
+
+                prevSnapshot = mSnapshot.exchange(next.release());
+            }
+
+            gEpochManager->Retire([prevSnapshot]()
+                                  {
+                                      delete prevSnapshot;
+                                  });
+            return true;
+        }
+
+    private:
+        Atomic<Snapshot*>   mSnapshot;
+        SRWLOCK             mWriteLock = SRWLOCK_INIT;
+    };
+} // namespace core
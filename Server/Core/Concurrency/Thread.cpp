@@ -2,18 +2,180 @@
 
 #include "Core/Pch.h"
 #include "Core/Concurrency/Thread.h"
+#include <winternl.h>
 
 namespace core
 {
+    namespace
+    {
+        // 틱 단위 임시 데이터용 기본 아레나 크기
+        constexpr Int64     kDefaultArenaSize = 256 * 1024;
+
+        const Char8* const  kRoleNames[] =
+        {
+            TEXT_8("General"),
+            TEXT_8("Io"),
+            TEXT_8("Job"),
+            TEXT_8("Timer"),
+            TEXT_8("Loop"),
+            TEXT_8("Zone"),
+        };
+        static_assert(_countof(kRoleNames) == static_cast<Int32>(ThreadRole::Count), "ROLE_NAME_MISMATCH");
+
+        // NtQuerySystemInformation(SystemProcessInformation)이 프로세스 정보 뒤에 채우는 스레드 정보
+        struct SystemThreadInformation
+        {
+            LARGE_INTEGER   kernelTime;
+            LARGE_INTEGER   userTime;
+            LARGE_INTEGER   createTime;
+            ULONG           waitTime;
+            PVOID           startAddress;
+            HANDLE          uniqueProcess;
+            HANDLE          uniqueThread;
+            LONG            priority;
+            LONG            basePriority;
+            ULONG           contextSwitches;
+            ULONG           threadState;
+            ULONG           waitReason;
+        };
+
+        using NtQuerySystemInformationFunc = LONG(NTAPI*)(ULONG, PVOID, ULONG, PULONG);
+
+        constexpr ULONG     kSystemProcessInformation = 5;
+        constexpr LONG      kStatusInfoLengthMismatch = static_cast<LONG>(0xC000'0004);
+
+        /**
+         * 현재 프로세스의 스레드별 컨텍스트 스위치 횟수를 조회합니다.
+         *
+         * @return 스레드 ID별 컨텍스트 스위치 횟수 (조회 실패 시 빈 맵)
+         */
+        HashMap<DWORD, Int64> QueryContextSwitches()
+        {
+            HashMap<DWORD, Int64> result;
+
+            static const auto sNtQuerySystemInformation = reinterpret_cast<NtQuerySystemInformationFunc>(
+                ::GetProcAddress(::GetModuleHandleW(TEXT_16("ntdll.dll")), "NtQuerySystemInformation"));
+            if (sNtQuerySystemInformation == nullptr)
+            {
+                return result;
+            }
+
+            Vector<Byte> buffer(256 * 1024);
+            ULONG neededSize = 0;
+            LONG status = 0;
+            while ((status = sNtQuerySystemInformation(kSystemProcessInformation, buffer.data(), static_cast<ULONG>(buffer.size()), &neededSize)) == kStatusInfoLengthMismatch)
+            {
+                // 조회 사이에 프로세스/스레드가 늘어날 수 있으므로 여유를 둔다
+                buffer.resize(neededSize + 64 * 1024);
+            }
+
+            if (status < 0)
+            {
+                return result;
+            }
+
+            const DWORD processId = ::GetCurrentProcessId();
+            const Byte* entry = buffer.data();
+            while (true)
+            {
+                const auto* process = reinterpret_cast<const SYSTEM_PROCESS_INFORMATION*>(entry);
+                if (::HandleToULong(process->UniqueProcessId) == processId)
+                {
+                    const auto* threads = reinterpret_cast<const SystemThreadInformation*>(process + 1);
+                    for (ULONG i = 0; i < process->NumberOfThreads; ++i)
+                    {
+                        result[::HandleToULong(threads[i].uniqueThread)] = threads[i].contextSwitches;
+                    }
+                    break;
+                }
+
+                if (process->NextEntryOffset == 0)
+                {
+                    break;
+                }
+                entry += process->NextEntryOffset;
+            }
+
+            return result;
+        }
+
+        // FILETIME(100ns 단위)을 마이크로초로 변환
+        Int64 ToMicroSec(const FILETIME& time)
+        {
+            ULARGE_INTEGER value;
+            value.LowPart = time.dwLowDateTime;
+            value.HighPart = time.dwHighDateTime;
+
+            return static_cast_64(value.QuadPart / 10);
+        }
+    } // namespace
+
+    /**
+     * ThreadArena 생성자
+     *
+     * @param capacity 아레나 크기 (바이트)
+     * @param numaNode 메모리를 할당할 NUMA 노드 (kAnyNumaNode면 현재 스레드 기준)
+     */
+    ThreadArena::ThreadArena(Int64 capacity, Int32 numaNode)
+        : mCapacity(capacity)
+    {
+        if (numaNode == ThreadRoleConfig::kAnyNumaNode)
+        {
+            mBuffer = static_cast<Byte*>(::VirtualAlloc(nullptr, capacity, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+        }
+        else
+        {
+            mBuffer = static_cast<Byte*>(::VirtualAllocExNuma(::GetCurrentProcess(), nullptr, capacity, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE, numaNode));
+        }
+
+        ASSERT_CRASH(mBuffer != nullptr, "THREAD_ARENA_ALLOC_FAILED");
+    }
+
+    ThreadArena::~ThreadArena()
+    {
+        ::VirtualFree(mBuffer, 0, MEM_RELEASE);
+    }
+
+    /**
+     * 아레나에서 메모리를 할당합니다.
+     *
+     * @param size 할당할 크기 (바이트)
+     * @param alignment 정렬 단위 (2의 거듭제곱)
+     * @return 할당된 메모리, 남은 공간이 부족하면 nullptr
+     */
+    Byte* ThreadArena::Alloc(Int64 size, Int64 alignment)
+    {
+        const Int64 alignedPos = (mUsedSize + alignment - 1) & ~(alignment - 1);
+        if (alignedPos + size > mCapacity)
+        {
+            return nullptr;
+        }
+
+        mUsedSize = alignedPos + size;
+        return mBuffer + alignedPos;
+    }
+
     /**
      * ThreadManager 생성자
      *
      * 메인 스레드의 TLS를 초기화합니다.
      * 이를 통해 메인 스레드에 고유 ID를 할당합니다.
+     * 역할별 기본 스레드 수를 논리 프로세서 수로부터 계산합니다.
      */
     ThreadManager::ThreadManager()
     {
         InitTls();
+
+        const Int32 processorCount = std::max(static_cast_32(std::thread::hardware_concurrency()), 1);
+        const Int32 quarterCount = std::max(processorCount / 4, 1);
+
+        mRoleConfigs[static_cast<Int32>(ThreadRole::General)].count = 0;
+        mRoleConfigs[static_cast<Int32>(ThreadRole::Io)].count = quarterCount;
+        mRoleConfigs[static_cast<Int32>(ThreadRole::Job)].count = quarterCount;
+        mRoleConfigs[static_cast<Int32>(ThreadRole::Timer)].count = 1;
+        mRoleConfigs[static_cast<Int32>(ThreadRole::Loop)].count = 1;
+        mRoleConfigs[static_cast<Int32>(ThreadRole::Loop)].arenaSize = kDefaultArenaSize;
+        mRoleConfigs[static_cast<Int32>(ThreadRole::Zone)].count = quarterCount;
     }
 
     /**
@@ -31,21 +193,57 @@ namespace core
     /**
      * 새 스레드 생성 및 실행
      *
+     * 역할을 지정하지 않은(General) 스레드를 생성합니다.
+     *
+     * @param callback 스레드에서 실행할 작업 함수
+     */
+    void ThreadManager::Launch(Function<void(void)> callback)
+    {
+        Launch(ThreadRole::General, std::move(callback));
+    }
+
+    /**
+     * 역할을 지정한 새 스레드 생성 및 실행
+     *
      * 제공된 콜백 함수를 실행하는 새 스레드를 생성합니다.
      * 스레드 실행 전후로 TLS 초기화 및 정리 작업을 자동으로 수행합니다.
      *
+     * @param role 스레드 역할
      * @param callback 스레드에서 실행할 작업 함수
+     *
+     * 동작:
+     * 1. 역할 내 인덱스를 부여하고 현재 역할 설정을 복사
+     * 2. 스레드에서 TLS 초기화 후 CPU/NUMA 친화도 적용
+     * 3. 아레나 크기가 지정되었으면 스레드 로컬 아레나 생성
+     * 4. 콜백 실행 후 아레나와 TLS 정리
      */
-    void ThreadManager::Launch(Function<void(void)> callback)
+    void ThreadManager::Launch(ThreadRole role, Function<void(void)> callback)
     {
         SrwLockWriteGuard guard(mLock);
 
-        mThreads.emplace_back([callback]()
-                              {
-                                  InitTls();
-                                  callback();
-                                  DestroyTls();
-                              });
+        const Int32 roleIndex = mRoleLaunchCounts[static_cast<Int32>(role)]++;
+        const ThreadRoleConfig config = GetRoleConfig(role);
+
+        Thread thread([this, role, config, callback = std::move(callback)]()
+                      {
+                          InitTls();
+                          tThreadRole = role;
+                          ApplyAffinity(config);
+
+                          UniquePtr<ThreadArena> arena;
+                          if (config.arenaSize > 0)
+                          {
+                              arena = std::make_unique<ThreadArena>(config.arenaSize, config.numaNode);
+                              tThreadArena = arena.get();
+                          }
+
+                          callback();
+
+                          tThreadArena = nullptr;
+                          DestroyTls();
+                      });
+
+        mThreads.push_back({std::move(thread), role, roleIndex});
     }
 
     /**
@@ -58,15 +256,124 @@ namespace core
     {
         SrwLockWriteGuard guard(mLock);
 
-        for (Thread& thread : mThreads)
+        for (ThreadEntry& entry : mThreads)
         {
-            if (thread.joinable())
-                thread.join();
+            if (entry.thread.joinable())
+                entry.thread.join();
         }
 
         mThreads.clear();
     }
 
+    /**
+     * 역할별 스레드 조인
+     *
+     * 지정한 역할의 스레드만 목록에서 분리한 뒤 완료될 때까지 대기합니다.
+     * 조인 대상 스레드가 CollectStats() 등으로 락을 요청할 수 있으므로 락을 해제한 상태에서 조인합니다.
+     *
+     * @param role 조인할 스레드 역할
+     */
+    void ThreadManager::Join(ThreadRole role)
+    {
+        Vector<ThreadEntry> entries;
+        {
+            SrwLockWriteGuard guard(mLock);
+
+            auto it = std::stable_partition(mThreads.begin(), mThreads.end(),
+                                            [role](const ThreadEntry& entry)
+                                            {
+                                                return entry.role != role;
+                                            });
+
+            entries.assign(std::make_move_iterator(it), std::make_move_iterator(mThreads.end()));
+            mThreads.erase(it, mThreads.end());
+        }
+
+        for (ThreadEntry& entry : entries)
+        {
+            if (entry.thread.joinable())
+                entry.thread.join();
+        }
+    }
+
+    void ThreadManager::SetRoleConfig(ThreadRole role, const ThreadRoleConfig& config)
+    {
+        SrwLockWriteGuard guard(mLock);
+        mRoleConfigs[static_cast<Int32>(role)] = config;
+    }
+
+    /**
+     * 관리 중인 스레드별 CPU 시간과 컨텍스트 스위치 횟수를 수집합니다.
+     *
+     * @return 스레드별 통계
+     */
+    Vector<ThreadStats> ThreadManager::CollectStats()
+    {
+        const HashMap<DWORD, Int64> contextSwitches = QueryContextSwitches();
+
+        Vector<ThreadStats> result;
+
+        SrwLockReadGuard guard(mLock);
+        result.reserve(mThreads.size());
+        for (ThreadEntry& entry : mThreads)
+        {
+            ThreadStats stats;
+            stats.role = entry.role;
+            stats.roleIndex = entry.roleIndex;
+
+            const HANDLE handle = entry.thread.native_handle();
+            FILETIME creationTime, exitTime, kernelTime, userTime;
+            if (::GetThreadTimes(handle, &creationTime, &exitTime, &kernelTime, &userTime))
+            {
+                stats.kernelTimeUs = ToMicroSec(kernelTime);
+                stats.userTimeUs = ToMicroSec(userTime);
+            }
+
+            auto it = contextSwitches.find(::GetThreadId(handle));
+            if (it != contextSwitches.end())
+            {
+                stats.contextSwitchCount = it->second;
+            }
+
+            result.push_back(stats);
+        }
+
+        return result;
+    }
+
+    /**
+     * 스레드별, 역할별 CPU 시간과 컨텍스트 스위치 횟수를 출력합니다.
+     */
+    void ThreadManager::LogStats()
+    {
+        const Vector<ThreadStats> threadStats = CollectStats();
+
+        ThreadStats roleTotals[static_cast<Int32>(ThreadRole::Count)];
+        Int32 roleCounts[static_cast<Int32>(ThreadRole::Count)] = {};
+        for (const ThreadStats& stats : threadStats)
+        {
+            gLogger->Info(TEXT_8("Thread[{}#{}]: User={} ms, Kernel={} ms, ContextSwitches={}"),
+                          GetRoleName(stats.role), stats.roleIndex, stats.userTimeUs / 1000, stats.kernelTimeUs / 1000, stats.contextSwitchCount);
+
+            ThreadStats& total = roleTotals[static_cast<Int32>(stats.role)];
+            total.userTimeUs += stats.userTimeUs;
+            total.kernelTimeUs += stats.kernelTimeUs;
+            total.contextSwitchCount += stats.contextSwitchCount;
+            ++roleCounts[static_cast<Int32>(stats.role)];
+        }
+
+        for (Int32 i = 0; i < static_cast<Int32>(ThreadRole::Count); ++i)
+        {
+            if (roleCounts[i] == 0)
+            {
+                continue;
+            }
+
+            gLogger->Info(TEXT_8("ThreadRole[{}]: Threads={}, User={} ms, Kernel={} ms, ContextSwitches={}"),
+                          kRoleNames[i], roleCounts[i], roleTotals[i].userTimeUs / 1000, roleTotals[i].kernelTimeUs / 1000, roleTotals[i].contextSwitchCount);
+        }
+    }
+
     /**
      * 스레드 로컬 스토리지(TLS) 초기화
      *
@@ -89,7 +396,97 @@ namespace core
      */
     void ThreadManager::DestroyTls()
     {
+        // 로그 링 반납 (남은 레코드는 로거 스레드가 출력한 뒤 해제)
+        if (tLogRing != nullptr)
+        {
+            tLogRing->Retire();
+            tLogRing = nullptr;
+        }
+
         // 스레드 id 초기화
         tThreadId = 0;
     }
+
+    const Char8* ThreadManager::GetRoleName(ThreadRole role)
+    {
+        return kRoleNames[static_cast<Int32>(role)];
+    }
+
+    /**
+     * 이름(대소문자 무시)으로 역할을 찾습니다.
+     *
+     * @param name 역할 이름 (예: "io", "Job")
+     * @param role 찾은 역할
+     * @return 찾으면 true
+     */
+    Bool ThreadManager::FindRole(String8View name, OUT ThreadRole& role)
+    {
+        for (Int32 i = 0; i < static_cast<Int32>(ThreadRole::Count); ++i)
+        {
+            const String8View roleName = kRoleNames[i];
+            const Bool matched = std::equal(name.begin(), name.end(), roleName.begin(), roleName.end(),
+                                            [](Char8 lhs, Char8 rhs)
+                                            {
+                                                return std::tolower(static_cast<unsigned char>(lhs)) == std::tolower(static_cast<unsigned char>(rhs));
+                                            });
+            if (matched)
+            {
+                role = static_cast<ThreadRole>(i);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * 현재 스레드에 역할 설정의 CPU/NUMA 친화도를 적용합니다.
+     *
+     * 동작:
+     * 1. NUMA 노드가 지정되었으면 해당 노드의 프로세서 마스크, 아니면 0번 그룹의 모든 프로세서 사용
+     * 2. CPU 고정이 설정되었으면 마스크 안의 프로세서를 순서대로 하나씩 배정
+     * 3. SetThreadGroupAffinity로 적용 (실패하면 경고만 출력)
+     */
+    void ThreadManager::ApplyAffinity(const ThreadRoleConfig& config)
+    {
+        if (!config.pinned && (config.numaNode == ThreadRoleConfig::kAnyNumaNode))
+        {
+            return;
+        }
+
+        GROUP_AFFINITY affinity = {};
+        if (config.numaNode != ThreadRoleConfig::kAnyNumaNode)
+        {
+            if (!::GetNumaNodeProcessorMaskEx(static_cast<USHORT>(config.numaNode), &affinity))
+            {
+                gLogger->Warn(TEXT_8("ThreadManager: Invalid NUMA node {}"), config.numaNode);
+                return;
+            }
+        }
+        else
+        {
+            const DWORD processorCount = ::GetActiveProcessorCount(0);
+            affinity.Group = 0;
+            affinity.Mask = (processorCount >= 64) ? ~KAFFINITY(0) : ((KAFFINITY(1) << processorCount) - 1);
+        }
+
+        if (config.pinned && (affinity.Mask != 0))
+        {
+            // 마스크에서 target번째 프로세서 하나만 남긴다
+            const Int32 processorCount = static_cast_32(__popcnt64(affinity.Mask));
+            const Int32 target = mNextProcessor.fetch_add(1) % processorCount;
+
+            KAFFINITY mask = affinity.Mask;
+            for (Int32 i = 0; i < target; ++i)
+            {
+                mask &= (mask - 1);
+            }
+            affinity.Mask = mask & (~mask + 1);
+        }
+
+        if (!::SetThreadGroupAffinity(::GetCurrentThread(), &affinity, nullptr))
+        {
+            gLogger->Warn(TEXT_8("ThreadManager: Failed to set thread affinity: {}"), ::GetLastError());
+        }
+    }
 } // namespace core
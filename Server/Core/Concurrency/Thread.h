@@ -4,18 +4,105 @@
 
 namespace core
 {
+    // 스레드 역할
+    enum class ThreadRole : Int32
+    {
+        General = 0,    // 역할이 지정되지 않은 스레드
+        Io,             // 입출력 이벤트 디스패치
+        Job,            // 잡 큐 처리
+        Timer,          // 잡 타이머
+        Loop,           // 게임/클라이언트 루프
+        Zone,           // 월드 존 갱신
+        Count,
+    };
+
+    /**
+     * ThreadRoleConfig - 역할별 스레드 설정
+     *
+     * count: 실행할 스레드 수 (기본값은 코어 수로 계산)
+     * pinned: 스레드마다 논리 프로세서 하나에 고정할지 여부
+     * numaNode: 스레드를 묶을 NUMA 노드 (kAnyNumaNode면 제한 없음)
+     * arenaSize: 스레드 로컬 아레나 크기 (0이면 아레나 없음)
+     */
+    struct ThreadRoleConfig
+    {
+        static constexpr Int32      kAnyNumaNode = -1;
+
+        Int32       count = 1;
+        Bool        pinned = false;
+        Int32       numaNode = kAnyNumaNode;
+        Int64       arenaSize = 0;
+    };
+
+    /**
+     * ThreadArena - 스레드 로컬 선형 할당 아레나
+     *
+     * 주요 기능:
+     * - 포인터 증가만으로 할당하고 Reset()으로 한 번에 해제
+     * - NUMA 노드가 지정된 역할은 해당 노드의 메모리에서 할당
+     *
+     * 사용 패턴:
+     * - 틱 단위 임시 데이터처럼 수명이 짧은 데이터에 사용
+     * - 소유 스레드에서만 접근 (tThreadArena)
+     */
+    class ThreadArena
+    {
+    public:
+        ThreadArena(Int64 capacity, Int32 numaNode);
+        ~ThreadArena();
+
+        // 복사 금지
+        ThreadArena(const ThreadArena&) = delete;
+        ThreadArena& operator=(const ThreadArena&) = delete;
+
+        Byte*       Alloc(Int64 size, Int64 alignment = kDefaultAlignment);
+        void        Reset() { mUsedSize = 0; }
+
+        // Reset 시 소멸자를 호출하지 않으므로 소멸이 필요 없는 타입만 허용
+        template <typename T>
+        T*          AllocArray(Int64 count)
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "ARENA_TYPE_MUST_BE_TRIVIALLY_DESTRUCTIBLE");
+            return reinterpret_cast<T*>(Alloc(count * static_cast_64(sizeof(T)), alignof(T)));
+        }
+
+        Int64       GetCapacity() const { return mCapacity; }
+        Int64       GetUsedSize() const { return mUsedSize; }
+
+    private:
+        static constexpr Int64      kDefaultAlignment = 16;
+
+    private:
+        Byte*       mBuffer = nullptr;
+        Int64       mCapacity = 0;
+        Int64       mUsedSize = 0;
+    };
+
+    // 스레드별 CPU 사용량 통계
+    struct ThreadStats
+    {
+        ThreadRole  role = ThreadRole::General;
+        Int32       roleIndex = 0;
+        Int64       userTimeUs = 0;
+        Int64       kernelTimeUs = 0;
+        Int64       contextSwitchCount = 0;
+    };
+
     /**
      * ThreadManager - 서버의 스레드 생성 및 관리 클래스
      *
      * 주요 기능:
-     * - 콜백 함수를 사용한 비동기 스레드 생성 및 실행
+     * - 역할을 지정한 비동기 스레드 생성 및 실행
+     * - 역할별 스레드 수, CPU 고정, NUMA 노드, 아레나 크기 설정
      * - 생성된 모든 스레드의 수명 주기 관리
      * - 스레드 로컬 스토리지(TLS) 초기화
-     * - 스레드 안전한 작업을 위한 내부 동기화
+     * - 스레드별 CPU 시간과 컨텍스트 스위치 횟수 수집
      *
      * 사용 패턴:
-     * - Launch() 메서드로 작업 스레드 생성
+     * - SetRoleConfig()로 역할별 설정을 변경 (스레드 실행 전)
+     * - GetRoleConfig(role).count만큼 Launch(role, callback) 호출
      * - 소멸자에서 자동으로 모든 스레드 조인
+     * - 종료 단계별로 Join(role)을 호출해 역할 단위로 조인
      */
     class ThreadManager
     {
@@ -24,13 +111,38 @@ namespace core
         ~ThreadManager();
 
         void                Launch(Function<void(void)> callback);
+        void                Launch(ThreadRole role, Function<void(void)> callback);
         void                Join();
+        void                Join(ThreadRole role);
+
+        void                    SetRoleConfig(ThreadRole role, const ThreadRoleConfig& config);
+        const ThreadRoleConfig& GetRoleConfig(ThreadRole role) const { return mRoleConfigs[static_cast<Int32>(role)]; }
+
+        Vector<ThreadStats>     CollectStats();
+        void                    LogStats();
 
         static void         InitTls();
         static void         DestroyTls();
 
+        static const Char8* GetRoleName(ThreadRole role);
+        static Bool         FindRole(String8View name, OUT ThreadRole& role);
+
     private:
-        SRWLOCK             mLock;
-        Vector<Thread>      mThreads;
+        struct ThreadEntry
+        {
+            Thread          thread;
+            ThreadRole      role;
+            Int32           roleIndex;
+        };
+
+        void                ApplyAffinity(const ThreadRoleConfig& config);
+
+    private:
+        SRWLOCK             mLock = SRWLOCK_INIT;
+        Vector<ThreadEntry> mThreads;
+
+        ThreadRoleConfig    mRoleConfigs[static_cast<Int32>(ThreadRole::Count)];
+        Int32               mRoleLaunchCounts[static_cast<Int32>(ThreadRole::Count)] = {};
+        Atomic<Int32>       mNextProcessor = 0;
     };
 } // namespace core
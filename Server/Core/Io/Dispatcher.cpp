@@ -93,6 +93,13 @@ namespace core
             }
         }
 
+        // 종료 신호를 받으면 다음 워커도 깨어나도록 다시 게시
+        if ((event == nullptr) && (completionKey == kWakeKey))
+        {
+            ::PostQueuedCompletionStatus(mIocp, 0, kWakeKey, nullptr);
+            return SUCCESS;
+        }
+
         // 이벤트를 정상적으로 꺼냈으면
         if (event != nullptr)
         {
@@ -105,4 +112,20 @@ namespace core
 
         return SUCCESS;
     }
+
+    /**
+     * 디스패치 중지
+     *
+     * 실행 상태를 해제하고 종료 신호를 게시합니다.
+     * 신호를 꺼낸 워커가 다시 게시하므로 워커 수를 몰라도 대기 중인 모든 워커가 깨어납니다.
+     */
+    void IoEventDispatcher::Stop()
+    {
+        if (mRunning.exchange(false) == false)
+        {
+            return;
+        }
+
+        ::PostQueuedCompletionStatus(mIocp, 0, kWakeKey, nullptr);
+    }
 } // namespace core
@@ -43,8 +43,9 @@ namespace core
      * 사용 패턴:
      * 1. IoEventDispatcher 인스턴스 생성
      * 2. 다양한 IO 객체(Listener, Session) 등록
-     * 3. 워커 스레드에서 Dispatch 메서드 반복 호출
+     * 3. 워커 스레드에서 IsRunning()이 true인 동안 Dispatch 메서드 반복 호출
      * 4. 완료된 이벤트가 감지되면 해당 소유자의 DispatchIoEvent 메서드 호출
+     * 5. 종료 시 Stop() 호출로 대기 중인 모든 워커를 깨워 루프 종료
      */
     class IoEventDispatcher
     {
@@ -56,8 +57,15 @@ namespace core
 
         Int64           Register(SharedPtr<IIoObjectOwner> owner);
         Int64           Dispatch(UInt32 timeoutMs = INFINITE);
+        void            Stop();
+        Bool            IsRunning() const { return mRunning.load(); }
+
+    private:
+        // 워커를 깨우기 위해 게시하는 완료 통지의 키
+        static constexpr ULONG_PTR  kWakeKey = 1;
 
     private:
         HANDLE          mIocp = INVALID_HANDLE_VALUE;
+        Atomic<Bool>    mRunning = true;
     };
 } // namespace core
@@ -0,0 +1,161 @@
+﻿/*    Core/Job/Coroutine.cpp    */
+
+#include "Core/Pch.h"
+#include "Core/Job/Coroutine.h"
+
+namespace core
+{
+    CoroutineFramePool::CoroutineFramePool()
+    {
+        mFreeFrames.reserve(kClassCount);
+        for (Int64 i = 0; i < kClassCount; ++i)
+        {
+            mFreeFrames.push_back(std::make_unique<LockfreeQueue<void*>>(kInitQueueSize));
+        }
+    }
+
+    CoroutineFramePool::~CoroutineFramePool()
+    {
+        // 종료 시점에는 실행 중인 코루틴이 없으므로 보관 중인 프레임을 모두 해제
+        for (auto& freeFrames : mFreeFrames)
+        {
+            void* frame = nullptr;
+            while (freeFrames->try_dequeue(frame))
+            {
+                ::operator delete(frame);
+            }
+        }
+    }
+
+    /**
+     * 코루틴 프레임을 할당합니다.
+     *
+     * @param size 컴파일러가 요청한 프레임 크기
+     * @return 크기 등급만큼의 메모리
+     *
+     * 동작:
+     * 1. 최대 등급보다 크면 직접 할당
+     * 2. 같은 등급의 해제된 프레임이 있으면 재사용
+     * 3. 없으면 등급 크기로 새로 할당
+     */
+    void* CoroutineFramePool::Alloc(Int64 size)
+    {
+        const Int64 classIndex = GetClassIndex(size);
+        if (classIndex >= kClassCount)
+        {
+            return ::operator new(size);
+        }
+
+        void* frame = nullptr;
+        if (mFreeFrames[classIndex]->try_dequeue(frame))
+        {
+            return frame;
+        }
+
+        return ::operator new((classIndex + 1) * kClassSize);
+    }
+
+    void CoroutineFramePool::Free(void* frame, Int64 size)
+    {
+        const Int64 classIndex = GetClassIndex(size);
+        if (classIndex >= kClassCount)
+        {
+            ::operator delete(frame);
+            return;
+        }
+
+        Bool result = mFreeFrames[classIndex]->enqueue(frame);
+        ASSERT_CRASH_DEBUG(result == true, "ENQUEUE_FAILED");
+    }
+
+    /**
+     * 태스크 소멸자
+     *
+     * Spawn()으로 넘기지 않은 태스크는 시작되지 않았으므로 프레임을 직접 해제합니다.
+     */
+    Task::~Task()
+    {
+        if (mHandle)
+        {
+            mHandle.destroy();
+        }
+    }
+
+    /**
+     * 지정한 직렬화 객체의 JobQueue에서 코루틴을 재개하도록 예약합니다.
+     *
+     * @param target 재개할 직렬화 객체
+     *
+     * 동작:
+     * 1. 재개용 잡과 대상 큐를 미리 준비
+     * 2. 실행 중인 직렬화 객체를 대상으로 교체
+     * 3. 재개용 잡을 큐에 푸시 (푸시 이후에는 다른 워커가 재개할 수 있으므로 프레임에 접근하지 않음)
+     */
+    void Task::promise_type::Post(SharedPtr<JobSerializer> target)
+    {
+        SharedPtr<Job> job = GetResumeJob();
+        SharedPtr<JobQueue> queue = target->GetQueue();
+        serializer = std::move(target);
+
+        queue->Push(std::move(job));
+    }
+
+    /**
+     * 지정한 시간이 지난 뒤 현재 직렬화 객체의 JobQueue에서 코루틴을 재개하도록 예약합니다.
+     *
+     * @param delayMs 지연 시간(밀리초), 0 이하이면 바로 큐에 푸시
+     */
+    void Task::promise_type::PostAfter(Int64 delayMs)
+    {
+        if (delayMs <= 0)
+        {
+            Post(serializer);
+            return;
+        }
+
+        SharedPtr<Job> job = GetResumeJob();
+        WeakPtr<JobQueue> queue = serializer->GetQueue();
+
+        gJobTimer->Schedule(std::move(job), std::move(queue), delayMs);
+    }
+
+    /**
+     * 재개용 잡을 반환합니다.
+     * 코루틴은 한 번에 한 곳에서만 대기하므로 처음 만든 잡을 재개할 때마다 재사용합니다.
+     * 종료 중인 JobTimer가 예약을 폐기하면 재개되지 않을 프레임을 해제합니다.
+     * 프레임이 재개용 잡과 직렬화 객체를 소유하므로 해제하지 않으면 모두 누수됩니다.
+     */
+    SharedPtr<Job> Task::promise_type::GetResumeJob()
+    {
+        if (resumeJob == nullptr)
+        {
+            const Handle handle = Handle::from_promise(*this);
+            resumeJob = std::make_shared<Job>([handle]()
+                                              {
+                                                  handle.resume();
+                                              },
+                                              [handle]()
+                                              {
+                                                  handle.destroy();
+                                              });
+        }
+
+        return resumeJob;
+    }
+
+    /**
+     * 대상 큐로 이동합니다.
+     *
+     * @return 대기가 필요하면 true, 이미 대상 큐에서 실행 중이면 false
+     */
+    Bool ResumeOnAwaiter::await_suspend(Task::Handle handle)
+    {
+        if (handle.promise().serializer == target)
+        {
+            return false;
+        }
+
+        handle.promise().Post(std::move(target));
+        return true;
+    }
+} // namespace core
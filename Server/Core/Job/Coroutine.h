@@ -0,0 +1,139 @@
+﻿/*    Core/Job/Coroutine.h    */
+
+#pragma once
+
+namespace core
+{
+    class Job;
+    class JobSerializer;
+
+    /*
+     * CoroutineFramePool - 코루틴 프레임 메모리 풀
+     *
+     * 주요 기능:
+     * - 프레임 크기를 64바이트 단위 크기 등급으로 올림해서 등급별 락프리 큐에 보관
+     * - 해제된 프레임은 운영체제에 반환하지 않고 같은 등급의 다음 할당에 재사용
+     * - 최대 등급보다 큰 프레임은 풀을 거치지 않고 직접 할당
+     *
+     * 특징:
+     * - 코루틴은 잡 워커 사이를 옮겨 다니므로 스레드 로컬 캐시 대신 공유 큐 사용
+     * - 잡 한 번을 예약할 때마다 할당하던 Job/캡처 튜플을 프레임 할당이 대체하지 않도록 재사용
+     */
+    class CoroutineFramePool
+    {
+    public:
+                        CoroutineFramePool();
+                        ~CoroutineFramePool();
+
+        void*           Alloc(Int64 size);
+        void            Free(void* frame, Int64 size);
+
+    private:
+        static Int64    GetClassIndex(Int64 size) { return (size + kClassSize - 1) / kClassSize - 1; }
+
+    private:
+        static constexpr Int64      kClassSize = 64;
+        static constexpr Int64      kClassCount = 32;
+        static constexpr Int64      kInitQueueSize = 64;
+
+    private:
+        Vector<UniquePtr<LockfreeQueue<void*>>>     mFreeFrames;
+    };
+
+    /*
+     * Task - JobSerializer 위에서 실행되는 코루틴
+     *
+     * 주요 기능:
+     * - JobSerializer::Spawn()으로 시작하며 항상 직렬화 객체의 JobQueue에서 실행
+     * - co_await ResumeOn(serializer)로 다른 직렬화 객체의 큐로 이동
+     * - co_await SleepFor(ms)로 JobTimer를 통해 현재 큐에서 지연 재개
+     * - co_await session->SendAndWait(buffer)로 송신 완료 후 재개
+     *
+     * 특징:
+     * - 재개용 Job을 태스크마다 한 번만 할당하고 재개할 때마다 재사용
+     * - 프레임은 CoroutineFramePool에서 할당
+     * - 결과를 반환하지 않는 실행 후 잊는(fire-and-forget) 코루틴으로, 완료 시 프레임이 스스로 해제
+     * - 실행 중인 직렬화 객체를 소유하므로 대기 중에도 객체가 해제되지 않음
+     *
+     * 사용 예시:
+     * Task Room::RunBroadcastLoop(SharedPtr<SendBuffer> buffer, Int64 loopMs)
+     * {
+     *     while (true)
+     *     {
+     *         Broadcast(buffer);
+     *         co_await SleepFor(loopMs);
+     *     }
+     * }
+     * room->Spawn(room->RunBroadcastLoop(buffer, 100));
+     */
+    class Task
+    {
+    public:
+        struct promise_type;
+        using Handle = std::coroutine_handle<promise_type>;
+
+        struct promise_type
+        {
+            SharedPtr<JobSerializer>    serializer;     // 현재 실행 중인 직렬화 객체
+            SharedPtr<Job>              resumeJob;      // 재개용 잡
+
+            Task                    get_return_object() { return Task(Handle::from_promise(*this)); }
+            std::suspend_always     initial_suspend() noexcept { return {}; }
+            std::suspend_never      final_suspend() noexcept { return {}; }
+            void                    return_void() {}
+            void                    unhandled_exception() { CRASH("UNHANDLED_COROUTINE_EXCEPTION"); }
+
+            void                    Post(SharedPtr<JobSerializer> target);
+            void                    PostAfter(Int64 delayMs);
+            void                    Resume() { Post(serializer); }
+            SharedPtr<Job>          GetResumeJob();
+
+            static void*            operator new(size_t size) { return gCoroutineFramePool->Alloc(static_cast_64(size)); }
+            static void             operator delete(void* frame, size_t size) { gCoroutineFramePool->Free(frame, static_cast_64(size)); }
+        };
+
+    public:
+        explicit Task(Handle handle) : mHandle(handle) {}
+        Task(Task&& other) noexcept : mHandle(std::exchange(other.mHandle, nullptr)) {}
+        ~Task();
+
+        // 복사 금지
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+        Task& operator=(Task&&) = delete;
+
+        Handle      Release() { return std::exchange(mHandle, nullptr); }
+
+    private:
+        Handle      mHandle;
+    };
+
+    /*
+     * 재개 대기 객체
+     *
+     * await_suspend에서 재개용 잡을 다른 스레드에 넘긴 뒤에는 프레임이 먼저 재개되거나
+     * 해제될 수 있으므로, 넘긴 이후에는 대기 객체와 프레임에 접근하지 않는다.
+     */
+    struct ResumeOnAwaiter
+    {
+        SharedPtr<JobSerializer>    target;
+
+        Bool    await_ready() const noexcept { return false; }
+        Bool    await_suspend(Task::Handle handle);
+        void    await_resume() const noexcept {}
+    };
+
+    struct SleepAwaiter
+    {
+        Int64       delayMs;
+
+        Bool    await_ready() const noexcept { return false; }
+        void    await_suspend(Task::Handle handle) { handle.promise().PostAfter(delayMs); }
+        void    await_resume() const noexcept {}
+    };
+
+    // 지정한 직렬화 객체의 JobQueue에서 재개 (이미 그 큐에서 실행 중이면 대기 없이 진행)
+    inline ResumeOnAwaiter  ResumeOn(SharedPtr<JobSerializer> target) { return ResumeOnAwaiter{std::move(target)}; }
+    // 지정한 시간이 지난 뒤 현재 직렬화 객체의 JobQueue에서 재개
+    inline SleepAwaiter     SleepFor(Int64 delayMs) { return SleepAwaiter{delayMs}; }
+} // namespace core
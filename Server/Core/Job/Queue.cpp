@@ -2,6 +2,8 @@
 
 #include "Core/Pch.h"
 #include "Core/Job/Queue.h"
+#include "Core/Metric/Metric.h"
+#include "Core/Network/Batch.h"
 
 namespace core
 {
@@ -84,16 +86,33 @@ namespace core
     /**
      * JobQueueManager 생성자
      *
-     * 동기화 객체를 초기화합니다.
-     * - SRWLOCK(mLock)을 통해 스레드 간 동기화 보장
-     * - CONDITION_VARIABLE(mCondVar)을 통해 효율적인 스레드 대기/깨우기 구현
-     * - 큐를 지정된 초기 크기로 초기화
+     * 공유 큐와 워커별 전용 슬롯을 초기화합니다.
+     * - 워커 슬롯은 최대 개수만큼 미리 생성하여 등록 시점의 경합을 없앰
+     * - 각 워커는 SRWLOCK과 CONDITION_VARIABLE을 개별로 소유하여 필요한 워커만 깨움
      */
     JobQueueManager::JobQueueManager()
         : mQueues(kInitQueueSize)
     {
-        ::InitializeSRWLock(&mLock);
-        ::InitializeConditionVariable(&mCondVar);
+        mWorkers.reserve(kMaxWorkerCount);
+        for (Int32 i = 0; i < kMaxWorkerCount; ++i)
+        {
+            mWorkers.push_back(std::make_unique<Worker>());
+        }
+
+        mFlushTime = &gMetricRegistry->AddHistogram(TEXT_8("core_job_flush_duration_microseconds"), TEXT_8("Time spent flushing one job queue"));
+        mDepthGauge = gMetricRegistry->AddGauge(TEXT_8("core_job_queue_depth"), TEXT_8("Job queues waiting for a job worker"),
+                                                [this]()
+                                                {
+                                                    return GetPendingQueueCount();
+                                                });
+    }
+
+    JobQueueManager::~JobQueueManager()
+    {
+        if (mDepthGauge != nullptr)
+        {
+            mDepthGauge->ClearSampler();
+        }
     }
 
     /**
@@ -102,65 +121,204 @@ namespace core
      * @param queue 등록할 작업 큐
      *
      * 동작:
-     * 1. 락프리 큐(mQueues)에 작업 큐를 안전하게 추가합니다.
-     * 2. SRWLOCK을 사용한 배타적 락을 획득하여 스레드 안전성을 보장합니다.
-     * 3. mWaked 플래그를 true로 설정하여 새 큐가 추가되었음을 표시합니다.
-     * 4. 락을 해제한 후 WakeConditionVariable을 호출하여 대기 중인 스레드를 깨웁니다.
+     * 1. 큐의 친화도에 따라 처리할 워커를 선택합니다.
+     * 2. 친화도가 있으면 워커 전용 큐에, 없으면 공유 큐에 추가합니다.
+     * 3. 선택한 워커의 신호를 설정하고 깨웁니다.
+     * 4. 아직 실행 중인 워커가 없으면 첫 워커가 시작할 때 공유 큐를 처리합니다.
      */
     void JobQueueManager::RegisterQueue(SharedPtr<JobQueue> queue)
     {
-        // 큐를 등록한다
-        Bool result = mQueues.enqueue(std::move(queue));
-        ASSERT_CRASH_DEBUG(result == true, "ENQUEUE_FAILED");
+        const Int32 workerCount = mWorkerCount.load();
+        if (workerCount == 0)
+        {
+            Bool result = mQueues.enqueue(std::move(queue));
+            ASSERT_CRASH_DEBUG(result == true, "ENQUEUE_FAILED");
+            return;
+        }
 
+        Worker& worker = SelectWorker(queue);
+        if (queue->GetAffinity() == JobQueue::kNoAffinity)
         {
-            SrwLockWriteGuard gaurd(mLock);
-            mWaked = true;
+            // 공유 큐에 등록한다
+            Bool result = mQueues.enqueue(std::move(queue));
+            ASSERT_CRASH_DEBUG(result == true, "ENQUEUE_FAILED");
         }
-        // 대기 스레드를 깨운다 
-        ::WakeConditionVariable(&mCondVar);
+        else
+        {
+            // 워커 전용 큐에 등록한다
+            Bool result = worker.queues.enqueue(std::move(queue));
+            ASSERT_CRASH_DEBUG(result == true, "ENQUEUE_FAILED");
+        }
+
+        WakeWorker(worker);
     }
 
     /**
      * 등록된 큐들의 작업을 처리합니다.
      *
      * 동작:
-     * 1. mRunning이 true인 동안 계속 실행합니다.
-     * 2. 락프리 큐에서 작업 큐를 하나씩 꺼내어 처리합니다.
+     * 1. 호출한 스레드에 워커 인덱스를 부여합니다.
+     * 2. mRunning이 true인 동안 전용 큐를 우선으로, 비어 있으면 공유 큐에서 작업 큐를 꺼냅니다.
      * 3. 각 작업 큐의 작업을 지정된 시간(kFlushTimeoutMs) 동안 실행합니다.
-     * 4. 모든 작업을 완료하지 못한 큐는 다시 등록하여 나중에 처리합니다.
-     * 5. 모든 큐를 처리한 후 SRWLOCK을 사용하여 신호 상태를 확인합니다.
-     * 6. 신호가 없으면(mWaked가 false) SleepConditionVariableSRW로 대기합니다.
-     * 7. 깨어난 후에는 mWaked를 false로 초기화합니다.
+     * 4. 모든 작업을 완료하지 못한 큐는 꺼냈던 큐에 다시 추가하여 나중에 처리합니다.
+     *    처리하는 동안의 송신은 묶어 두었다가 처리할 큐가 없어지면 세션마다 한 번에 송신합니다.
+     * 5. 처리할 큐가 없으면 자신의 신호 상태를 확인합니다.
+     * 6. 신호가 없으면(waked가 false) SleepConditionVariableSRW로 대기합니다.
+     * 7. 깨어난 후에는 waked를 false로 초기화합니다.
+     * 8. 중지된 뒤에는 남은 큐를 모두 비우고 대기 없이 종료합니다.
      */
     void JobQueueManager::FlushQueues()
     {
-        while (mRunning)
+        const Int32 workerIndex = mWorkerCount.fetch_add(1);
+        ASSERT_CRASH(workerIndex < kMaxWorkerCount, "TOO_MANY_JOB_WORKERS");
+
+        Worker& worker = *mWorkers[workerIndex];
+
+        while (true)
         {
-            // 모든 큐를 비운다.
-            SharedPtr<JobQueue> queue;
-            while (mQueues.try_dequeue(queue))
+            // 처리할 큐가 없을 때까지 비운다. (대기하기 전에 묶어 둔 송신을 내보냄)
             {
-                // 큐의 작업을 지정된 시간 동안 처리한다.
-                Bool completed = queue->TryFlush(kFlushTimeoutMs);
-                if (!completed)
+                SendBatchScope batch;
+                while (true)
                 {
-                    // 모든 작업을 처리하지 못한 경우 다시 등록한다.
-                    Bool result = mQueues.enqueue(std::move(queue));
-                    ASSERT_CRASH_DEBUG(result == true, "ENQUEUE_FAILED");
+                    SharedPtr<JobQueue> queue;
+                    LockfreeQueue<SharedPtr<JobQueue>>* source = &worker.queues;
+                    if (!worker.queues.try_dequeue(queue))
+                    {
+                        source = &mQueues;
+                        if (!mQueues.try_dequeue(queue))
+                        {
+                            break;
+                        }
+                    }
+
+                    // 큐의 작업을 지정된 시간 동안 처리한다.
+                    const auto flushStart = std::chrono::steady_clock::now();
+                    Bool completed = queue->TryFlush(kFlushTimeoutMs);
+                    mFlushTime->Record(std::chrono::duration_cast<MicroSec>(std::chrono::steady_clock::now() - flushStart).count());
+                    if (!completed)
+                    {
+                        // 모든 작업을 처리하지 못한 경우 다시 등록한다.
+                        Bool result = source->enqueue(std::move(queue));
+                        ASSERT_CRASH_DEBUG(result == true, "ENQUEUE_FAILED");
+                    }
+
+                    SendBatch::FlushIfDue();
                 }
             }
 
+            // 중지되었으면 큐를 비운 상태로 종료
+            if (!mRunning.load())
+            {
+                break;
+            }
+
             // 배타적 잠금
-            SrwLockWriteGuard guard(mLock);
+            SrwLockWriteGuard guard(worker.lock);
 
-            // 깨웠던 신호가 없으면 대기
-            if (!mWaked)
+            // 깨웠던 신호가 없고 중지되지 않았으면 대기
+            if (!worker.waked && mRunning.load())
             {
-                BOOL result = ::SleepConditionVariableSRW(&mCondVar, &mLock, INFINITE, 0);
+                BOOL result = ::SleepConditionVariableSRW(&worker.condVar, &worker.lock, INFINITE, 0);
             }
             // 신호 초기화
-            mWaked = false;
+            worker.waked = false;
         }
     }
+
+    /**
+     * 워커 없이 호출한 스레드에서 등록된 큐를 모두 처리합니다.
+     * 잡 워커가 실행되지 않아 모든 큐가 공유 큐에 등록되는 경우(틱 재생 등)에만 사용합니다.
+     *
+     * @return 처리한 큐의 수
+     *
+     * 동작:
+     * 1. 공유 큐가 빌 때까지 큐를 꺼내 작업 실행
+     * 2. 모든 작업을 완료하지 못한 큐는 다시 공유 큐에 추가
+     */
+    Int64 JobQueueManager::DrainQueues()
+    {
+        ASSERT_CRASH(mWorkerCount.load() == 0, "JOB_WORKERS_RUNNING");
+
+        Int64 queueCount = 0;
+        SharedPtr<JobQueue> queue;
+        while (mQueues.try_dequeue(queue))
+        {
+            Bool completed = queue->TryFlush(kFlushTimeoutMs);
+            if (!completed)
+            {
+                Bool result = mQueues.enqueue(std::move(queue));
+                ASSERT_CRASH_DEBUG(result == true, "ENQUEUE_FAILED");
+            }
+            ++queueCount;
+        }
+
+        return queueCount;
+    }
+
+    /**
+     * 잡 워커를 중지합니다.
+     *
+     * 동작:
+     * 1. 실행 상태를 해제합니다.
+     * 2. 대기 중인 워커를 모두 깨워 남은 큐를 비운 뒤 종료하도록 합니다.
+     */
+    void JobQueueManager::Stop()
+    {
+        mRunning.store(false);
+
+        const Int32 workerCount = std::min(mWorkerCount.load(), kMaxWorkerCount);
+        for (Int32 i = 0; i < workerCount; ++i)
+        {
+            WakeWorker(*mWorkers[i]);
+        }
+    }
+
+    /**
+     * 큐를 처리할 워커를 선택합니다.
+     *
+     * @param queue 등록할 작업 큐
+     * @return 선택된 워커
+     *
+     * 동작:
+     * 1. 친화도가 있으면 실행 중인 워커 수로 나눈 나머지 인덱스의 워커를 선택합니다.
+     * 2. 친화도가 없으면 워커를 순서대로 돌아가며 선택합니다.
+     */
+    JobQueueManager::Worker& JobQueueManager::SelectWorker(const SharedPtr<JobQueue>& queue)
+    {
+        const Int32 workerCount = std::min(mWorkerCount.load(), kMaxWorkerCount);
+        const Int32 affinity = queue->GetAffinity();
+        if (affinity != JobQueue::kNoAffinity)
+        {
+            return *mWorkers[affinity % workerCount];
+        }
+
+        return *mWorkers[static_cast<UInt32>(mNextWakeIndex.fetch_add(1)) % workerCount];
+    }
+
+    void JobQueueManager::WakeWorker(Worker& worker)
+    {
+        {
+            SrwLockWriteGuard gaurd(worker.lock);
+            worker.waked = true;
+        }
+        // 대기 스레드를 깨운다 
+        ::WakeConditionVariable(&worker.condVar);
+    }
+
+    /**
+     * 잡 워커의 처리를 기다리는 큐 수의 근삿값 (메트릭 샘플링용)
+     *
+     * @return 공유 큐와 모든 워커 전용 큐에 등록된 큐 수의 합
+     */
+    Int64 JobQueueManager::GetPendingQueueCount() const
+    {
+        Int64 count = static_cast_64(mQueues.size_approx());
+        for (const UniquePtr<Worker>& worker : mWorkers)
+        {
+            count += static_cast_64(worker->queues.size_approx());
+        }
+
+        return count;
+    }
 } // namespace core
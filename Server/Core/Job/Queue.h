@@ -4,6 +4,9 @@
 
 namespace core
 {
+    class Histogram;
+    class Gauge;
+
     /*
      * Job 클래스는 비동기 작업을 실행 가능한 객체로 캡슐화합니다.
      * 일반 함수, 람다 또는 클래스 메서드를 저장하고 나중에 실행할 수 있습니다.
@@ -13,6 +16,7 @@ namespace core
      * - 특정 객체의 메서드를 인자와 함께 호출할 수 있는 템플릿 기반 생성자 지원
      * - std::tuple과 std::apply를 활용한 임의 개수의 인자 완벽 전달
      * - Execute() 메서드를 통한 저장된 작업의 실행
+     * - 실행되지 못하고 버려질 때 호출할 콜백 지정 가능 (Discard)
      */
     class Job
     {
@@ -25,6 +29,12 @@ namespace core
             : mCallback(std::move(callback))
         {}
 
+        // 실행되지 못하고 버려질 때 onDiscard를 호출하는 Job을 생성
+        Job(CallbackType&& callback, CallbackType&& onDiscard)
+            : mCallback(std::move(callback))
+            , mOnDiscard(std::move(onDiscard))
+        {}
+
         // 특정 객체의 메서드를 호출하는 Job을 생성
         template<typename T, typename Ret, typename... Args>
         Job(SharedPtr<T> owner, Ret(T::* method)(Args...), Args&&... args)
@@ -47,8 +57,18 @@ namespace core
             mCallback();
         }
 
+        // 실행하지 않고 버릴 때 호출 (호출하는 쪽이 Job의 참조를 유지해야 함)
+        void Discard()
+        {
+            if (mOnDiscard)
+            {
+                mOnDiscard();
+            }
+        }
+
     private:
         CallbackType    mCallback;
+        CallbackType    mOnDiscard;
     };
 
     /*
@@ -60,6 +80,7 @@ namespace core
      * - 여러 스레드에서 동시에 Job을 Push 가능
      * - 큐가 빈 상태에서 첫 작업 추가 시 자동으로 JobQueueManager에 등록
      * - TryFlush 메서드로 큐의 작업을 지정된 시간 내에 실행하고 완료 여부 반환
+     * - 워커 친화도를 지정하면 항상 같은 잡 워커에서 처리
      * - std::enable_shared_from_this를 통한 안전한 self-reference 제공
      */
     class JobQueue
@@ -71,9 +92,16 @@ namespace core
         void                        Push(SharedPtr<Job> job);
         Bool                        TryFlush(Int64 timeoutMs);
 
+        void                        SetAffinity(Int32 affinity) { mAffinity.store(affinity); }
+        Int32                       GetAffinity() const { return mAffinity.load(); }
+
+    public:
+        static constexpr Int32      kNoAffinity = -1;
+
     private:
         LockfreeQueue<SharedPtr<Job>>       mQueue;
         Atomic<Int64>                       mJobCount;
+        Atomic<Int32>                       mAffinity = kNoAffinity;
 
         static constexpr Int64      kInitQueueSize = 64;
     };
@@ -88,23 +116,47 @@ namespace core
      * - 여러 스레드 간의 작업 분배
      * - 미완료 작업이 있는 큐의 자동 재등록으로 모든 작업 완료 보장
      * - 대기 중인 스레드의 효율적인 깨우기를 통한 성능 최적화
+     * - 친화도가 지정된 큐는 해당 워커 전용 큐로, 나머지는 공유 큐로 분배
+     * - Stop() 호출 시 워커는 남은 큐를 모두 비운 뒤 종료
      */
     class JobQueueManager
     {
     public:
         JobQueueManager();
+        ~JobQueueManager();
 
         void                        RegisterQueue(SharedPtr<JobQueue> queue);
         void                        FlushQueues();
+        Int64                       DrainQueues();
+        void                        Stop();
+        Int32                       GetWorkerCount() const { return mWorkerCount.load(); }
+
+    private:
+        struct alignas(64) Worker
+        {
+            SRWLOCK                                 lock = SRWLOCK_INIT;
+            CONDITION_VARIABLE                      condVar = CONDITION_VARIABLE_INIT;
+            Bool                                    waked = false;
+            LockfreeQueue<SharedPtr<JobQueue>>      queues;
+
+            Worker() : queues(kInitQueueSize) {}
+        };
+
+        Worker&                     SelectWorker(const SharedPtr<JobQueue>& queue);
+        void                        WakeWorker(Worker& worker);
+        Int64                       GetPendingQueueCount() const;
 
     private:
-        SRWLOCK                                 mLock;
-        CONDITION_VARIABLE                      mCondVar;
-        Bool                                    mWaked = false;
         LockfreeQueue<SharedPtr<JobQueue>>      mQueues;
-        Bool                                    mRunning = true;
+        Vector<UniquePtr<Worker>>               mWorkers;
+        Atomic<Int32>                           mWorkerCount = 0;
+        Atomic<Int32>                           mNextWakeIndex = 0;
+        Atomic<Bool>                            mRunning = true;
+        Histogram*                              mFlushTime = nullptr;
+        Gauge*                                  mDepthGauge = nullptr;
 
         static constexpr Int64      kFlushTimeoutMs = 100;
         static constexpr Int64      kInitQueueSize = 128;
+        static constexpr Int32      kMaxWorkerCount = 64;
     };
 } // namespace core
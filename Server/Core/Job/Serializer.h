@@ -4,12 +4,15 @@
 
 #include "Core/Job/Queue.h"
 #include "Core/Job/Timer.h"
+#include "Core/Job/Coroutine.h"
 
 namespace core
 {
     /*
      * JobSerializer를 상속받은 클래스의 인스턴스는 자신만의 JobQueue를 소유한다.
      * 바로 JobQueue에 Push할 수 있으며, 일정 시간 후에 JobQueue에 Push할 수도 있다.
+     * 친화도를 지정하면 JobQueue가 항상 같은 잡 워커에서 처리된다.
+     * Spawn()으로 시작한 코루틴(Task)은 JobQueue에서 재개되므로 다른 잡과 직렬화된다.
      */
     class JobSerializer
         : public std::enable_shared_from_this<JobSerializer>
@@ -53,6 +56,22 @@ namespace core
             gJobTimer->Schedule(std::move(job), mQueue, delayMs);
         }
 
+        void Spawn(Task task)
+        {
+            Task::Handle handle = task.Release();
+            handle.promise().Post(shared_from_this());
+        }
+
+        void SetAffinity(Int32 affinity)
+        {
+            mQueue->SetAffinity(affinity);
+        }
+
+        const SharedPtr<JobQueue>& GetQueue() const
+        {
+            return mQueue;
+        }
+
     protected:
         SharedPtr<JobQueue>     mQueue = std::make_shared<JobQueue>();
     };
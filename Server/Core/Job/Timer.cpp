@@ -2,6 +2,7 @@
 
 #include "Core/Pch.h"
 #include "Core/Job/Timer.h"
+#include "Core/Metric/Metric.h"
 
 namespace core
 {
@@ -18,6 +19,13 @@ namespace core
     {
         ::InitializeSRWLock(&mLock);
         ::InitializeConditionVariable(&mCondVar);
+
+        mLateness = &gMetricRegistry->AddHistogram(TEXT_8("core_job_timer_lateness_milliseconds"), TEXT_8("Delay between a timer job's due tick and its distribution"));
+        mBacklogGauge = gMetricRegistry->AddGauge(TEXT_8("core_job_timer_backlog"), TEXT_8("Timer jobs scheduled but not yet due"),
+                                                  [this]()
+                                                  {
+                                                      return GetBacklogCount();
+                                                  });
     }
 
     /**
@@ -26,7 +34,12 @@ namespace core
      * Windows 네이티브 동기화 객체는 명시적 해제가 필요 없으므로 추가 정리 작업이 없습니다.
      */
     JobTimer::~JobTimer()
-    {}
+    {
+        if (mBacklogGauge != nullptr)
+        {
+            mBacklogGauge->ClearSampler();
+        }
+    }
 
     /**
      * 작업을 일정 시간 후에 실행되도록 스케줄링합니다.
@@ -90,6 +103,7 @@ namespace core
                     break;
                 }
 
+                mLateness->Record(nowTick - item.execTick);
                 mExecItems.emplace_back(item);
                 mScheduledItems.pop();
             }
@@ -97,10 +111,17 @@ namespace core
 
         const Int64 startTick = ::GetTickCount64();
 
-        // 꺼낸 모든 아이템의 job을 큐에 넣음
+        // 꺼낸 모든 아이템의 job을 큐에 넣음 (큐가 해제되었으면 폐기)
         for (Item& item : mExecItems)
         {
-            item.queue.lock()->Push(std::move(item.job));
+            if (SharedPtr<JobQueue> queue = item.queue.lock())
+            {
+                queue->Push(std::move(item.job));
+            }
+            else
+            {
+                item.job->Discard();
+            }
         }
         mExecItems.clear();
 
@@ -127,13 +148,13 @@ namespace core
      * 4. 신호가 없으면(mWaked가 false) SleepConditionVariableSRW로 대기합니다.
      * 5. 신호 도착 또는 타임아웃으로 깨어나면 mWaked를 false로 리셋합니다.
      * 6. mRunning이 false가 될 때까지 이 과정을 반복합니다.
+     * 7. 중지되면 실행 시간이 된 작업까지 분배하고 남은 예약은 락 밖에서 Discard()를 호출해 폐기합니다.
      */
     void JobTimer::Run()
     {
-        ASSERT_CRASH(mRunning == false, "ALREADY_RUNNING");
-        mRunning = true;
+        ASSERT_CRASH(mRunning.exchange(true) == false, "ALREADY_RUNNING");
 
-        while (mRunning)
+        while (mRunning.load())
         {
             // 타이머 설정 시간이 지난 잡을 큐에 분배
             Int64 waitMs = Distribute();
@@ -142,7 +163,7 @@ namespace core
             SrwLockWriteGuard guard(mLock);
 
             // 이미 신호를 처리했거나 신호가 아직 없는 경우
-            if (!mWaked)
+            if (!mWaked && mRunning.load())
             {
                 // 신호 도착 또는 타임아웃까지 대기
                 BOOL result = ::SleepConditionVariableSRW(
@@ -155,5 +176,48 @@ namespace core
             // 신호를 처리했으므로 플래그 리셋
             mWaked = false;
         }
+
+        // 중지 직전에 실행 시간이 된 잡까지 분배
+        Distribute();
+
+        PriorityQueue<Item> discardedItems;
+        {
+            SrwLockWriteGuard guard(mLock);
+            discardedItems.swap(mScheduledItems);
+        }
+
+        // 폐기 콜백이 코루틴 프레임을 해제하면서 잡의 다른 참조가 사라질 수 있으므로 아이템이 참조를 유지한 채 호출
+        const Int64 discardedCount = static_cast_64(discardedItems.size());
+        while (!discardedItems.empty())
+        {
+            discardedItems.top().job->Discard();
+            discardedItems.pop();
+        }
+
+        LOG_INFO(Job, TEXT_8("JobTimer: Stopped, discarded {} scheduled jobs"), discardedCount);
+    }
+
+    /**
+     * 타이머 쓰레드를 중지합니다.
+     *
+     * 동작:
+     * 1. 락을 획득한 상태에서 실행 상태를 해제하고 신호를 설정합니다.
+     * 2. 대기 중인 타이머 쓰레드를 깨워 Run()이 반환되도록 합니다.
+     */
+    void JobTimer::Stop()
+    {
+        {
+            SrwLockWriteGuard guard(mLock);
+            mRunning.store(false);
+            mWaked = true;
+        }
+        ::WakeConditionVariable(&mCondVar);
+    }
+
+    // 메트릭 샘플링용 예약 대기 수
+    Int64 JobTimer::GetBacklogCount()
+    {
+        SrwLockReadGuard guard(mLock);
+        return static_cast_64(mScheduledItems.size());
     }
 } // namespace core
@@ -13,9 +13,15 @@ namespace core
      * - Schedule() 메서드로 작업을 예약할 수 있습니다.
      * - Distribute()는 실행 시간에 도달한 작업들을 해당 JobQueue로 분배합니다.
      * - Run() 메서드로 타이머 스레드를 시작하여 지속적으로 작업을 분배합니다.
+     * - Stop() 호출 시 실행 시간이 된 작업까지 분배하고 남은 예약은 Job::Discard()를 호출해 폐기합니다.
+     * - 대상 JobQueue가 이미 해제된 작업도 Job::Discard()를 호출해 폐기합니다.
+     * - 예약 대기 수와 분배 지연(실행 시간을 넘긴 정도)을 메트릭으로 기록합니다.
      * - SRWLOCK을 사용한 통합된 동기화 방식 제공
      * - 조건 변수를 활용한 효율적인 스레드 동기화를 구현합니다.
      */
+    class Histogram;
+    class Gauge;
+
     class JobTimer
     {
     public:
@@ -35,6 +41,10 @@ namespace core
         void        Schedule(SharedPtr<Job> job, WeakPtr<JobQueue> queue, Int64 delayMs);
         Int64       Distribute();
         void        Run();
+        void        Stop();
+
+    private:
+        Int64       GetBacklogCount();
 
     private:
         SRWLOCK                 mLock;
@@ -42,8 +52,10 @@ namespace core
         Bool                    mWaked = false;
 
         PriorityQueue<Item>     mScheduledItems;
-        Bool                    mRunning = false;
+        Atomic<Bool>            mRunning = false;
         Vector<Item>            mExecItems;
+        Histogram*              mLateness = nullptr;
+        Gauge*                  mBacklogGauge = nullptr;
 
         static constexpr Int64  kMaxWaitMs = 100;
     };
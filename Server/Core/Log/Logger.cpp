@@ -61,16 +61,28 @@ namespace core
         // 로거 포맷 설정
         mLogger->set_pattern("[%H:%M:%S] [%^%l%$] %v");
 
-        // 로거 레벨 설정
+        // 로거 레벨 설정 (모듈별 레벨의 최솟값을 spdlog 레벨로 사용)
 #ifdef _DEBUG
-        mLogger->set_level(spdlog::level::debug);
+        const LogLevel defaultLevel = LogLevel::Debug;
 #else
-        mLogger->set_level(spdlog::level::info);
+        const LogLevel defaultLevel = LogLevel::Info;
 #endif // _DEBUG
+        for (Atomic<Int32>& moduleLevel : mModuleLevels)
+        {
+            moduleLevel.store(static_cast<Int32>(defaultLevel));
+        }
+        UpdateFloorLevel();
 
         // warn 이상일 때 즉시 버퍼를 비우고 기록
         mLogger->flush_on(spdlog::level::warn);
 
+        // 바이너리 경로 로거 스레드 시작
+        mWriterRunning.store(true);
+        mWriterThread = Thread([this]()
+                               {
+                                   RunWriter();
+                               });
+
         // 콘솔을 UTF-8 모드로 설정
         ::SetConsoleOutputCP(CP_UTF8);
         ::SetConsoleCP(CP_UTF8);
@@ -88,6 +100,339 @@ namespace core
      */
     void Logger::Shutdown()
     {
+        // 남은 바이너리 레코드를 모두 출력한 뒤 종료
+        mWriterRunning.store(false);
+        if (mWriterThread.joinable())
+        {
+            mWriterThread.join();
+        }
+
         spdlog::shutdown();
     }
+
+    /**
+     * 현재 스레드의 로그 링 생성
+     *
+     * 스레드가 처음 LOG_* 매크로를 호출할 때 한 번만 할당합니다.
+     * 스레드가 종료되어도 남은 레코드를 출력할 수 있도록 링은 로거가 소유하며,
+     * 스레드가 종료되면(DestroyTls) 로거 스레드가 남은 레코드를 출력한 뒤 해제합니다.
+     *
+     * @return 생성된 링
+     */
+    LogRing* Logger::CreateRing()
+    {
+        auto ring = std::make_unique<LogRing>(tThreadId);
+        LogRing* result = ring.get();
+
+        SrwLockWriteGuard guard(mRingLock);
+        mRings.push_back(std::move(ring));
+
+        return result;
+    }
+
+    /**
+     * 로거 스레드의 메인 루프
+     *
+     * 동작:
+     * 1. 모든 링의 레코드를 서식화해서 출력
+     * 2. 출력한 레코드가 없으면 잠시 대기
+     * 3. 주기적으로 링별 버린 레코드 수를 경고
+     * 4. 중지되면 남은 레코드를 마지막으로 출력
+     */
+    void Logger::RunWriter()
+    {
+        Int64 nextReportTick = ::GetTickCount64() + kDropReportIntervalMs;
+        Int64 nextLevelCheckTick = ::GetTickCount64() + kLevelFileCheckIntervalMs;
+
+        while (mWriterRunning.load())
+        {
+            if (DrainRings() == 0)
+            {
+                ::Sleep(static_cast<DWORD>(kWriterIdleMs));
+            }
+
+            const Int64 nowTick = ::GetTickCount64();
+            if (nowTick >= nextReportTick)
+            {
+                nextReportTick = nowTick + kDropReportIntervalMs;
+                ReportDrops();
+            }
+
+            if (nowTick >= nextLevelCheckTick)
+            {
+                nextLevelCheckTick = nowTick + kLevelFileCheckIntervalMs;
+                ReloadLevelFile();
+            }
+        }
+
+        DrainRings();
+    }
+
+    void Logger::ReportDrops()
+    {
+        // DrainRings가 직전에 채운 스냅숏을 사용하며 링은 로거 스레드만 해제하므로 락 없이 접근
+        for (LogRing* ring : mRingSnapshot)
+        {
+            const Int64 droppedCount = ring->TakeDroppedCount();
+            if (droppedCount > 0)
+            {
+                mLogger->warn("Logger: Dropped {} records on thread {}", droppedCount, ring->GetThreadId());
+            }
+        }
+    }
+
+    /**
+     * 모든 링의 레코드를 서식화해서 출력합니다.
+     *
+     * 서식화하는 동안 새 스레드의 링 등록을 막지 않도록 링 목록을 복사한 뒤 락 밖에서 비웁니다.
+     * 비우기 전에 반납된 링은 남은 레코드를 모두 출력했으므로 마지막에 해제합니다.
+     *
+     * @return 출력한 레코드 수
+     */
+    Int64 Logger::DrainRings()
+    {
+        {
+            SrwLockReadGuard guard(mRingLock);
+            mRingSnapshot.clear();
+            for (const auto& ring : mRings)
+            {
+                mRingSnapshot.push_back(ring.get());
+            }
+        }
+
+        fmt::memory_buffer buffer;
+        Int64 recordCount = 0;
+
+        for (LogRing* ring : mRingSnapshot)
+        {
+            // 반납 표시를 비우기 전에 읽어야 반납 전에 기록된 레코드가 모두 보임
+            if (ring->IsRetired())
+            {
+                mRetiredRings.push_back(ring);
+            }
+
+            recordCount += ring->Drain([this, &buffer](const LogRecord& record)
+                                       {
+                                           buffer.clear();
+                                           fmt::format_to(std::back_inserter(buffer), "[{}] ", GetModuleName(record.site->module));
+                                           try
+                                           {
+                                               record.format(record, buffer);
+                                           }
+                                           catch (const fmt::format_error& error)
+                                           {
+                                               fmt::format_to(std::back_inserter(buffer), "Invalid log format: {} ({})", record.site->format, error.what());
+                                           }
+
+                                           // 초당 제한으로 생략된 호출 수를 덧붙임
+                                           const Int64 suppressedCount = record.site->suppressedCount.exchange(0, std::memory_order_relaxed);
+                                           if (suppressedCount > 0)
+                                           {
+                                               fmt::format_to(std::back_inserter(buffer), " (+{} suppressed)", suppressedCount);
+                                           }
+
+                                           mLogger->log(record.time, spdlog::source_loc{}, static_cast<spdlog::level::level_enum>(record.site->level),
+                                                        spdlog::string_view_t(buffer.data(), buffer.size()));
+                                       });
+        }
+
+        if (mRetiredRings.empty() == false)
+        {
+            ReleaseRetiredRings();
+        }
+
+        return recordCount;
+    }
+
+    /**
+     * 종료된 스레드의 링 해제
+     *
+     * 남은 버린 개수를 경고한 뒤 목록에서 제거합니다.
+     * 스냅숏에서도 제거해서 이어지는 ReportDrops가 해제된 링에 접근하지 않도록 합니다.
+     */
+    void Logger::ReleaseRetiredRings()
+    {
+        for (LogRing* ring : mRetiredRings)
+        {
+            const Int64 droppedCount = ring->TakeDroppedCount();
+            if (droppedCount > 0)
+            {
+                mLogger->warn("Logger: Dropped {} records on thread {}", droppedCount, ring->GetThreadId());
+            }
+
+            mRingSnapshot.erase(std::find(mRingSnapshot.begin(), mRingSnapshot.end(), ring));
+        }
+
+        {
+            SrwLockWriteGuard guard(mRingLock);
+            std::erase_if(mRings, [this](const UniquePtr<LogRing>& ring)
+                                  {
+                                      return std::find(mRetiredRings.begin(), mRetiredRings.end(), ring.get()) != mRetiredRings.end();
+                                  });
+        }
+
+        mRetiredRings.clear();
+    }
+
+    /**
+     * 모듈의 런타임 레벨 변경
+     *
+     * 다음 LOG_* 호출부터 적용됩니다. 바이너리 경로 레코드가 spdlog에서 걸러지지 않도록 spdlog 레벨을 모듈 레벨의 최솟값으로 맞춥니다.
+     * 기존 gLogger 호출은 Core 모듈 레벨로 따로 거릅니다.
+     *
+     * @param module 대상 모듈
+     * @param level 새 레벨 (LOG_COMPILE_LEVEL 미만의 호출은 이미 컴파일에서 제거됨)
+     */
+    void Logger::SetModuleLevel(LogModule module, LogLevel level)
+    {
+        const LogLevel prevLevel = static_cast<LogLevel>(mModuleLevels[static_cast<Int32>(module)].exchange(static_cast<Int32>(level)));
+        UpdateFloorLevel();
+
+        if (prevLevel != level)
+        {
+            mLogger->info("Logger: Level of {} changed to {}", GetModuleName(module),
+                          spdlog::level::to_string_view(static_cast<spdlog::level::level_enum>(level)));
+        }
+    }
+
+    /**
+     * "모듈=레벨" 형식의 설정 적용 (예: network=debug)
+     *
+     * 모듈 이름으로 all을 지정하면 모든 모듈에 적용합니다.
+     *
+     * @param option 설정 문자열
+     * @return 형식이 올바르면 true
+     */
+    Bool Logger::ApplyLevelOption(String8View option)
+    {
+        const auto separator = option.find('=');
+        if (separator == String8View::npos)
+        {
+            return false;
+        }
+
+        const String8View moduleName = option.substr(0, separator);
+        const String8 levelName(option.substr(separator + 1));
+        const spdlog::level::level_enum spdLevel = spdlog::level::from_str(levelName);
+        // from_str은 알 수 없는 이름을 off로 변환하므로 off는 명시한 경우만 허용
+        if ((spdLevel == spdlog::level::off) && (levelName != "off"))
+        {
+            return false;
+        }
+
+        const LogLevel level = static_cast<LogLevel>(spdLevel);
+        if (moduleName == "all")
+        {
+            for (Int32 i = 0; i < static_cast<Int32>(LogModule::Count); ++i)
+            {
+                SetModuleLevel(static_cast<LogModule>(i), level);
+            }
+            return true;
+        }
+
+        LogModule module;
+        if (!FindModule(moduleName, OUT module))
+        {
+            return false;
+        }
+
+        SetModuleLevel(module, level);
+        return true;
+    }
+
+    /**
+     * 레벨 파일 감시 시작
+     *
+     * 파일의 각 줄은 "모듈=레벨" 형식이며 #으로 시작하는 줄은 무시합니다.
+     * 로거 스레드가 주기적으로 수정 시각을 확인해 변경되면 다시 적용합니다.
+     *
+     * @param path 레벨 파일 경로
+     */
+    void Logger::WatchLevelFile(const String8& path)
+    {
+        {
+            SrwLockWriteGuard guard(mLevelFileLock);
+            mLevelFilePath = path;
+            mLevelFileTime = {};
+        }
+
+        ReloadLevelFile();
+    }
+
+    void Logger::ReloadLevelFile()
+    {
+        SrwLockWriteGuard guard(mLevelFileLock);
+        if (mLevelFilePath.empty())
+        {
+            return;
+        }
+
+        std::error_code error;
+        const auto fileTime = std::filesystem::last_write_time(mLevelFilePath, error);
+        if (error || (fileTime == mLevelFileTime))
+        {
+            return;
+        }
+        mLevelFileTime = fileTime;
+
+        std::ifstream file(mLevelFilePath);
+        String8 line;
+        while (std::getline(file, line))
+        {
+            // 공백 제거
+            line.erase(std::remove_if(line.begin(), line.end(), [](Char8 c) { return std::isspace(static_cast<UInt8>(c)); }), line.end());
+            if (line.empty() || (line[0] == '#'))
+            {
+                continue;
+            }
+
+            if (!ApplyLevelOption(line))
+            {
+                mLogger->warn("Logger: Invalid level option in {}: {}", mLevelFilePath, line);
+            }
+        }
+    }
+
+    void Logger::UpdateFloorLevel()
+    {
+        Int32 floorLevel = static_cast<Int32>(LogLevel::Off);
+        for (const Atomic<Int32>& moduleLevel : mModuleLevels)
+        {
+            floorLevel = std::min(floorLevel, moduleLevel.load());
+        }
+
+        mLogger->set_level(static_cast<spdlog::level::level_enum>(floorLevel));
+    }
+
+    const Char8* Logger::GetModuleName(LogModule module)
+    {
+        switch (module)
+        {
+        case LogModule::Core:       return "Core";
+        case LogModule::Network:    return "Network";
+        case LogModule::Job:        return "Job";
+        case LogModule::Game:       return "Game";
+        default:                    return "Unknown";
+        }
+    }
+
+    Bool Logger::FindModule(String8View name, OUT LogModule& module)
+    {
+        for (Int32 i = 0; i < static_cast<Int32>(LogModule::Count); ++i)
+        {
+            const String8View moduleName = GetModuleName(static_cast<LogModule>(i));
+            const Bool matched = std::equal(name.begin(), name.end(), moduleName.begin(), moduleName.end(),
+                                            [](Char8 lhs, Char8 rhs)
+                                            {
+                                                return std::tolower(static_cast<UInt8>(lhs)) == std::tolower(static_cast<UInt8>(rhs));
+                                            });
+            if (matched)
+            {
+                module = static_cast<LogModule>(i);
+                return true;
+            }
+        }
+
+        return false;
+    }
 } // namespace core
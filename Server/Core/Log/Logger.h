@@ -7,6 +7,8 @@
 
 #include <spdlog/spdlog.h>
 
+#include "Core/Log/Record.h"
+
 namespace core
 {
     /**
@@ -22,6 +24,18 @@ namespace core
      * - 서식화된 문자열(fmt 라이브러리 사용)
      * - UTF-8 및 UTF-16 문자열 지원
      * - 디버그/릴리스 모드에 따른 자동 로그 레벨 조정
+     * - 핫 패스용 바이너리 경로 (LOG_* 매크로)
+     *
+     * 바이너리 경로:
+     * - 호출한 스레드는 인자를 값으로 스레드별 LogRing에 복사만 하고 반환 (서식화, 할당, 대기 없음)
+     * - 로거 스레드가 모든 링을 비우면서 서식화한 뒤 spdlog로 출력
+     * - 링이 가득 차면 버리고 버린 개수를 주기적으로 경고
+     * - 호출 위치별 초당 최대 기록 수 제한
+     *
+     * 로그 레벨:
+     * - 빌드 시점: LOG_COMPILE_LEVEL 미만의 LOG_* 호출은 인자와 함께 컴파일에서 제거
+     * - 실행 시점: 모듈(Core, Network, Job, Game)별 레벨 미만의 호출은 인자를 평가하지 않음
+     * - 레벨 파일을 지정하면 로거 스레드가 변경을 감지해 재시작 없이 적용
      */
     class Logger
     {
@@ -29,60 +43,177 @@ namespace core
         Logger(String8View name);
         ~Logger();
 
+        /*
+         * 기존 gLogger 호출은 모듈을 지정하지 않으므로 Core 모듈 레벨로 거른다.
+         * spdlog 레벨은 모든 모듈 레벨의 최솟값이라 이 검사가 없으면 다른 모듈을 낮출 때 함께 출력된다.
+         */
+
         /* 인자가 없는 로그 메시지 */
 
         template <typename T>
-        void Trace(const T& msg) { mLogger->trace(msg); }
+        void Trace(const T& msg) { if (ShouldLog(kLegacyModule, LogLevel::Trace)) { mLogger->trace(msg); } }
         template <typename T>
-        void Debug(const T& msg) { mLogger->debug(msg); }
+        void Debug(const T& msg) { if (ShouldLog(kLegacyModule, LogLevel::Debug)) { mLogger->debug(msg); } }
         template <typename T>
-        void Info(const T& msg) { mLogger->info(msg); }
+        void Info(const T& msg) { if (ShouldLog(kLegacyModule, LogLevel::Info)) { mLogger->info(msg); } }
         template <typename T>
-        void Warn(const T& msg) { mLogger->warn(msg); }
+        void Warn(const T& msg) { if (ShouldLog(kLegacyModule, LogLevel::Warn)) { mLogger->warn(msg); } }
         template <typename T>
-        void Error(const T& msg) { mLogger->error(msg); }
+        void Error(const T& msg) { if (ShouldLog(kLegacyModule, LogLevel::Error)) { mLogger->error(msg); } }
         template <typename T>
-        void Critical(const T& msg) { mLogger->critical(msg); }
+        void Critical(const T& msg) { if (ShouldLog(kLegacyModule, LogLevel::Critical)) { mLogger->critical(msg); } }
 
         /* TEXT_8 로그 메시지 */
 
         template <typename... Args>
-        void Trace(fmt::format_string<Args...> fmt, Args&&... args) { mLogger->trace(fmt, std::forward<Args>(args)...); }
+        void Trace(fmt::format_string<Args...> fmt, Args&&... args) { if (ShouldLog(kLegacyModule, LogLevel::Trace)) { mLogger->trace(fmt, std::forward<Args>(args)...); } }
         template <typename... Args>
-        void Debug(fmt::format_string<Args...> fmt, Args&&... args) { mLogger->debug(fmt, std::forward<Args>(args)...); }
+        void Debug(fmt::format_string<Args...> fmt, Args&&... args) { if (ShouldLog(kLegacyModule, LogLevel::Debug)) { mLogger->debug(fmt, std::forward<Args>(args)...); } }
         template <typename... Args>
-        void Info(fmt::format_string<Args...> fmt, Args&&... args) { mLogger->info(fmt, std::forward<Args>(args)...); }
+        void Info(fmt::format_string<Args...> fmt, Args&&... args) { if (ShouldLog(kLegacyModule, LogLevel::Info)) { mLogger->info(fmt, std::forward<Args>(args)...); } }
         template <typename... Args>
-        void Warn(fmt::format_string<Args...> fmt, Args&&... args) { mLogger->warn(fmt, std::forward<Args>(args)...); }
+        void Warn(fmt::format_string<Args...> fmt, Args&&... args) { if (ShouldLog(kLegacyModule, LogLevel::Warn)) { mLogger->warn(fmt, std::forward<Args>(args)...); } }
         template <typename... Args>
-        void Error(fmt::format_string<Args...> fmt, Args&&... args) { mLogger->error(fmt, std::forward<Args>(args)...); }
+        void Error(fmt::format_string<Args...> fmt, Args&&... args) { if (ShouldLog(kLegacyModule, LogLevel::Error)) { mLogger->error(fmt, std::forward<Args>(args)...); } }
         template <typename... Args>
-        void Critical(fmt::format_string<Args...> fmt, Args&&... args) { mLogger->critical(fmt, std::forward<Args>(args)...); }
+        void Critical(fmt::format_string<Args...> fmt, Args&&... args) { if (ShouldLog(kLegacyModule, LogLevel::Critical)) { mLogger->critical(fmt, std::forward<Args>(args)...); } }
 
         /* TEXT_16 로그 메시지 */
 
         template <typename... Args>
-        void Trace(fmt::wformat_string<Args...> fmt, Args&&... args) { mLogger->trace(fmt, std::forward<Args>(args)...); }
+        void Trace(fmt::wformat_string<Args...> fmt, Args&&... args) { if (ShouldLog(kLegacyModule, LogLevel::Trace)) { mLogger->trace(fmt, std::forward<Args>(args)...); } }
         template <typename... Args>
-        void Debug(fmt::wformat_string<Args...> fmt, Args&&... args) { mLogger->debug(fmt, std::forward<Args>(args)...); }
+        void Debug(fmt::wformat_string<Args...> fmt, Args&&... args) { if (ShouldLog(kLegacyModule, LogLevel::Debug)) { mLogger->debug(fmt, std::forward<Args>(args)...); } }
         template <typename... Args>
-        void Info(fmt::wformat_string<Args...> fmt, Args&&... args) { mLogger->info(fmt, std::forward<Args>(args)...); }
+        void Info(fmt::wformat_string<Args...> fmt, Args&&... args) { if (ShouldLog(kLegacyModule, LogLevel::Info)) { mLogger->info(fmt, std::forward<Args>(args)...); } }
         template <typename... Args>
-        void Warn(fmt::wformat_string<Args...> fmt, Args&&... args) { mLogger->warn(fmt, std::forward<Args>(args)...); }
+        void Warn(fmt::wformat_string<Args...> fmt, Args&&... args) { if (ShouldLog(kLegacyModule, LogLevel::Warn)) { mLogger->warn(fmt, std::forward<Args>(args)...); } }
         template <typename... Args>
-        void Error(fmt::wformat_string<Args...> fmt, Args&&... args) { mLogger->error(fmt, std::forward<Args>(args)...); }
+        void Error(fmt::wformat_string<Args...> fmt, Args&&... args) { if (ShouldLog(kLegacyModule, LogLevel::Error)) { mLogger->error(fmt, std::forward<Args>(args)...); } }
         template <typename... Args>
-        void Critical(fmt::wformat_string<Args...> fmt, Args&&... args) { mLogger->critical(fmt, std::forward<Args>(args)...); }
+        void Critical(fmt::wformat_string<Args...> fmt, Args&&... args) { if (ShouldLog(kLegacyModule, LogLevel::Critical)) { mLogger->critical(fmt, std::forward<Args>(args)...); } }
+
+        /* 바이너리 경로 (LOG_* 매크로에서 호출) */
+
+        Bool ShouldLog(LogModule module, LogLevel level) const
+        {
+            return static_cast<Int32>(level) >= mModuleLevels[static_cast<Int32>(module)].load(std::memory_order_relaxed);
+        }
+
+        template <typename... Args>
+        void Write(LogSite& site, Args&&... args)
+        {
+            if (!site.TryAcquire())
+            {
+                return;
+            }
+
+            GetRing().Push(site, std::forward<Args>(args)...);
+        }
+
+        /* 모듈별 런타임 레벨 */
+
+        void        SetModuleLevel(LogModule module, LogLevel level);
+        LogLevel    GetModuleLevel(LogModule module) const { return static_cast<LogLevel>(mModuleLevels[static_cast<Int32>(module)].load()); }
+        Bool        ApplyLevelOption(String8View option);
+        void        WatchLevelFile(const String8& path);
+
+        static const Char8*     GetModuleName(LogModule module);
+        static Bool             FindModule(String8View name, OUT LogModule& module);
 
     private:
         void Init(String8View name);
         void Shutdown();
 
+        LogRing& GetRing()
+        {
+            if (tLogRing == nullptr)
+            {
+                tLogRing = CreateRing();
+            }
+            return *tLogRing;
+        }
+
+        LogRing*    CreateRing();
+        void        RunWriter();
+        Int64       DrainRings();
+        void        ReleaseRetiredRings();
+        void        ReportDrops();
+        void        ReloadLevelFile();
+        void        UpdateFloorLevel();
+
     private:
+        static constexpr LogModule  kLegacyModule = LogModule::Core;
         static constexpr Int64      kQueueSize = 8192;
         static constexpr Int64      kThreadCount = 1;
+        static constexpr Int64      kWriterIdleMs = 1;
+        static constexpr Int64      kDropReportIntervalMs = 1'000;
+        static constexpr Int64      kLevelFileCheckIntervalMs = 1'000;
 
     private:
         SharedPtr<spdlog::logger>   mLogger;
+
+        SRWLOCK                     mRingLock = SRWLOCK_INIT;
+        Vector<UniquePtr<LogRing>>  mRings;
+        Vector<LogRing*>            mRingSnapshot;      // 로거 스레드 전용
+        Vector<LogRing*>            mRetiredRings;      // 로거 스레드 전용
+        Thread                      mWriterThread;
+        Atomic<Bool>                mWriterRunning = false;
+
+        Atomic<Int32>               mModuleLevels[static_cast<Int32>(LogModule::Count)];
+
+        SRWLOCK                     mLevelFileLock = SRWLOCK_INIT;
+        String8                     mLevelFilePath;
+        std::filesystem::file_time_type     mLevelFileTime;
     };
 } // namespace core
+
+/*
+ * 빌드 시점 로그 레벨 (LogLevel 값)
+ *
+ * 이 값 미만의 LOG_* 호출은 인자와 함께 컴파일에서 제거된다.
+ * 기본값은 디버그 빌드 Trace, 릴리스 빌드 Debug이며 (스테이징에서 런타임에 켤 수 있도록 유지)
+ * 운영 빌드는 전처리기 정의로 LOG_COMPILE_LEVEL=2(Info)를 지정한다.
+ */
+#ifndef LOG_COMPILE_LEVEL
+#ifdef _DEBUG
+#define LOG_COMPILE_LEVEL                   0
+#else
+#define LOG_COMPILE_LEVEL                   1
+#endif // _DEBUG
+#endif // LOG_COMPILE_LEVEL
+
+/*
+ * 바이너리 경로 로그 매크로
+ *
+ * 사용 예시:
+ * LOG_INFO(Network, TEXT_8("Session[{}]: Connected"), GetId());
+ * LOG_INFO_RATE(Game, 10, TEXT_8("Player[{}]: Broadcasted"), playerId);   // 초당 최대 10회
+ *
+ * 첫 번째 인자는 LogModule의 열거자 이름이다.
+ * 인자는 값으로 복사되며 문자열은 LogText::kMaxSize까지 잘려서 복사된다.
+ * 빌드 시점 레벨 미만이면 컴파일에서 제거되고, 모듈 레벨 미만이면 인자를 평가하지 않는다.
+ */
+#define LOG_DEFAULT_RATE                    1'000
+
+#define LOG_WRITE(module, level, rate, format, ...)                                 \
+    do                                                                              \
+    {                                                                               \
+        if constexpr (static_cast<Int32>(level) >= LOG_COMPILE_LEVEL)               \
+        {                                                                           \
+            if (::core::gLogger->ShouldLog(::core::LogModule::module, level))       \
+            {                                                                       \
+                static ::core::LogSite sLogSite(::core::LogModule::module, level, format, rate);\
+                ::core::gLogger->Write(sLogSite, ##__VA_ARGS__);                    \
+            }                                                                       \
+        }                                                                           \
+    }                                                                               \
+    while (false)
+
+#define LOG_TRACE(module, format, ...)              LOG_WRITE(module, ::core::LogLevel::Trace, LOG_DEFAULT_RATE, format, ##__VA_ARGS__)
+#define LOG_DEBUG(module, format, ...)              LOG_WRITE(module, ::core::LogLevel::Debug, LOG_DEFAULT_RATE, format, ##__VA_ARGS__)
+#define LOG_INFO(module, format, ...)               LOG_WRITE(module, ::core::LogLevel::Info, LOG_DEFAULT_RATE, format, ##__VA_ARGS__)
+#define LOG_WARN(module, format, ...)               LOG_WRITE(module, ::core::LogLevel::Warn, LOG_DEFAULT_RATE, format, ##__VA_ARGS__)
+#define LOG_ERROR(module, format, ...)              LOG_WRITE(module, ::core::LogLevel::Error, LOG_DEFAULT_RATE, format, ##__VA_ARGS__)
+#define LOG_DEBUG_RATE(module, rate, format, ...)   LOG_WRITE(module, ::core::LogLevel::Debug, rate, format, ##__VA_ARGS__)
+#define LOG_INFO_RATE(module, rate, format, ...)    LOG_WRITE(module, ::core::LogLevel::Info, rate, format, ##__VA_ARGS__)
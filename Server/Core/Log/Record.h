@@ -0,0 +1,241 @@
+﻿/*    Core/Log/Record.h    */
+
+#pragma once
+
+namespace core
+{
+    // spdlog::level::level_enum과 같은 순서
+    enum class LogLevel : Int32
+    {
+        Trace,
+        Debug,
+        Info,
+        Warn,
+        Error,
+        Critical,
+        Off,
+    };
+
+    // 모듈별 런타임 로그 레벨의 단위
+    enum class LogModule : Int32
+    {
+        Core,
+        Network,
+        Job,
+        Game,
+        Count,
+    };
+
+    /*
+     * LogSite - 로그 호출 위치별 정적 정보
+     *
+     * LOG_* 매크로가 호출 위치마다 정적 객체로 하나씩 생성합니다.
+     * 레코드에는 서식 문자열 대신 호출 위치의 포인터만 기록합니다.
+     *
+     * 특징:
+     * - 1초 단위 창에서 maxPerSecond를 넘는 호출은 기록하지 않고 개수만 센다
+     * - 생략된 개수는 다음으로 기록되는 같은 위치의 로그 뒤에 덧붙인다
+     */
+    struct LogSite
+    {
+        LogModule           module;
+        LogLevel            level;
+        const Char8*        format;
+        Int32               maxPerSecond;
+
+        Atomic<Int64>       windowSec = 0;
+        Atomic<Int32>       windowCount = 0;
+        Atomic<Int64>       suppressedCount = 0;
+
+        LogSite(LogModule module, LogLevel level, const Char8* format, Int32 maxPerSecond)
+            : module(module)
+            , level(level)
+            , format(format)
+            , maxPerSecond(maxPerSecond)
+        {}
+
+        Bool TryAcquire()
+        {
+            const Int64 nowSec = static_cast_64(::GetTickCount64() / 1000);
+            if (windowSec.load(std::memory_order_relaxed) != nowSec)
+            {
+                // 새 창 시작 (경합 시 한 스레드만 초기화)
+                Int64 expected = windowSec.load(std::memory_order_relaxed);
+                if ((expected != nowSec) &&
+                    windowSec.compare_exchange_strong(OUT expected, nowSec, std::memory_order_relaxed))
+                {
+                    windowCount.store(0, std::memory_order_relaxed);
+                }
+            }
+
+            if (windowCount.fetch_add(1, std::memory_order_relaxed) < maxPerSecond)
+            {
+                return true;
+            }
+
+            suppressedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    };
+
+    /*
+     * 로그 인자로 전달된 문자열의 값 복사본
+     * 레코드가 호출한 스레드의 버퍼를 가리키지 않도록 고정 크기로 잘라서 복사한다.
+     */
+    struct LogText
+    {
+        static constexpr Int32  kMaxSize = 60;
+
+        Char8       data[kMaxSize];
+        Int32       size;
+
+        explicit LogText(String8View text)
+            : size(static_cast_32(std::min<Int64>(static_cast_64(text.size()), kMaxSize)))
+        {
+            ::memcpy(data, text.data(), size);
+        }
+
+        String8View View() const { return String8View(data, size); }
+    };
+
+    namespace detail
+    {
+        // 문자열은 LogText로, 나머지는 값 그대로 캡처
+        template<typename T>
+        decltype(auto) CaptureLogArg(T&& arg)
+        {
+            using Decayed = std::decay_t<T>;
+            if constexpr (std::is_convertible_v<const Decayed&, String8View>)
+            {
+                return LogText(String8View(arg));
+            }
+            else
+            {
+                static_assert(std::is_trivially_copyable_v<Decayed>, "LOG_ARGUMENT_MUST_BE_TRIVIALLY_COPYABLE");
+                return Decayed(arg);
+            }
+        }
+
+        template<typename T>
+        decltype(auto) UnwrapLogArg(const T& arg)
+        {
+            if constexpr (std::is_same_v<T, LogText>)
+            {
+                return arg.View();
+            }
+            else
+            {
+                return (arg);
+            }
+        }
+    } // namespace detail
+
+    /*
+     * LogRecord - 링 버퍼의 고정 크기 슬롯
+     *
+     * 서식화하지 않은 인자를 값으로 복사해 두고, 백그라운드 스레드가
+     * format 함수 포인터로 인자 타입을 복원해 서식화한다.
+     */
+    struct alignas(64) LogRecord
+    {
+        using FormatFunc = void(*)(const LogRecord& record, fmt::memory_buffer& out);
+
+        static constexpr Int64  kSize = 256;
+
+        LogSite*                                site;
+        FormatFunc                              format;
+        std::chrono::system_clock::time_point   time;
+        alignas(8) Byte                         args[kSize - 24];
+
+        template<typename Tuple>
+        static void FormatArgs(const LogRecord& record, fmt::memory_buffer& out)
+        {
+            const Tuple& captured = *reinterpret_cast<const Tuple*>(record.args);
+            std::apply([&record, &out](const auto&... args)
+                       {
+                           auto unwrapped = std::make_tuple(detail::UnwrapLogArg(args)...);
+                           std::apply([&record, &out](const auto&... values)
+                                      {
+                                          fmt::vformat_to(std::back_inserter(out), fmt::string_view(record.site->format), fmt::make_format_args(values...));
+                                      },
+                                      unwrapped);
+                       },
+                       captured);
+        }
+    };
+
+    static_assert(sizeof(LogRecord) == LogRecord::kSize, "INVALID_LOG_RECORD_SIZE");
+
+    /*
+     * LogRing - 스레드별 단일 생산자/단일 소비자 로그 링 버퍼
+     *
+     * 주요 기능:
+     * - 로그를 남기는 스레드(생산자)는 슬롯에 인자를 복사하고 헤드를 증가
+     * - 로거의 백그라운드 스레드(소비자)만 테일을 증가시키며 레코드를 서식화
+     * - 가득 차면 기다리지 않고 버린 뒤 버린 개수만 증가
+     * - 스레드가 종료되면 반납 표시만 하고, 로거 스레드가 남은 레코드를 비운 뒤 해제
+     *
+     * 특징:
+     * - 생산 경로는 락, 할당, 시스템 호출이 없음
+     * - 헤드와 테일은 서로 다른 캐시 라인에 배치
+     */
+    class LogRing
+    {
+    public:
+        explicit LogRing(Int32 threadId) : mThreadId(threadId) {}
+
+        template<typename... Args>
+        void Push(LogSite& site, Args&&... args)
+        {
+            using Tuple = std::tuple<std::decay_t<decltype(detail::CaptureLogArg(std::forward<Args>(args)))>...>;
+            static_assert(sizeof(Tuple) <= sizeof(LogRecord::args), "TOO_MANY_LOG_ARGUMENTS");
+            static_assert(std::is_trivially_destructible_v<Tuple>, "LOG_ARGUMENT_MUST_BE_TRIVIALLY_DESTRUCTIBLE");
+
+            const Int64 head = mHead.load(std::memory_order_relaxed);
+            if (head - mTail.load(std::memory_order_acquire) >= kSlotCount)
+            {
+                mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            LogRecord& record = mRecords[head & kSlotMask];
+            record.site = &site;
+            record.format = &LogRecord::FormatArgs<Tuple>;
+            record.time = std::chrono::system_clock::now();
+            new (record.args) Tuple(detail::CaptureLogArg(std::forward<Args>(args))...);
+
+            mHead.store(head + 1, std::memory_order_release);
+        }
+
+        template<typename Func>
+        Int64 Drain(Func&& func)
+        {
+            const Int64 tail = mTail.load(std::memory_order_relaxed);
+            const Int64 head = mHead.load(std::memory_order_acquire);
+            for (Int64 i = tail; i < head; ++i)
+            {
+                func(mRecords[i & kSlotMask]);
+            }
+            mTail.store(head, std::memory_order_release);
+
+            return head - tail;
+        }
+
+        Int64       TakeDroppedCount() { return mDroppedCount.exchange(0, std::memory_order_relaxed); }
+        Int32       GetThreadId() const { return mThreadId; }
+        void        Retire() { mIsRetired.store(true, std::memory_order_release); }
+        Bool        IsRetired() const { return mIsRetired.load(std::memory_order_acquire); }
+
+    private:
+        static constexpr Int64      kSlotCount = 512;
+        static constexpr Int64      kSlotMask = kSlotCount - 1;
+
+    private:
+        alignas(64) Atomic<Int64>   mHead = 0;
+        Atomic<Int64>               mDroppedCount = 0;
+        Atomic<Bool>                mIsRetired = false;
+        alignas(64) Atomic<Int64>   mTail = 0;
+        Int32                       mThreadId;
+        LogRecord                   mRecords[kSlotCount];
+    };
+} // namespace core
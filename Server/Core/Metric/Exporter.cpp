@@ -0,0 +1,136 @@
+﻿/*    Core/Metric/Exporter.cpp    */
+
+#include "Core/Pch.h"
+#include "Core/Metric/Exporter.h"
+#include "Core/Metric/Metric.h"
+#include "Core/Network/Address.h"
+#include "Core/Network/Socket.h"
+
+namespace core
+{
+    MetricExporter::~MetricExporter()
+    {
+        Stop();
+    }
+
+    /**
+     * 관리 포트를 열고 익스포터 스레드를 시작합니다.
+     *
+     * @param port 바인딩할 루프백 포트
+     * @return 성공 시 SUCCESS, 실패 시 소켓 에러 코드
+     */
+    Int64 MetricExporter::Start(UInt16 port)
+    {
+        ASSERT_CRASH(mRunning.load() == false, "ALREADY_RUNNING");
+
+        Int64 result = SocketUtils::CreateSocket(mSocket);
+        if (result != SUCCESS)
+        {
+            return result;
+        }
+
+        // 다른 프로세스가 같은 관리 포트에 바인딩해 메트릭 요청을 가로채지 못하게 함
+        result = SocketUtils::SetExclusiveAddressUse(mSocket, true);
+        if (result == SUCCESS)
+        {
+            result = SocketUtils::BindAddress(mSocket, NetAddress(TEXT_16("127.0.0.1"), port));
+        }
+        if (result == SUCCESS)
+        {
+            result = SocketUtils::Listen(mSocket);
+        }
+        if (result != SUCCESS)
+        {
+            SocketUtils::CloseSocket(mSocket);
+            return result;
+        }
+
+        mRunning.store(true);
+        mThread = Thread([this]()
+                         {
+                             Run();
+                         });
+
+        gLogger->Info(TEXT_8("MetricExporter: Listening on 127.0.0.1:{}"), port);
+
+        return SUCCESS;
+    }
+
+    void MetricExporter::Stop()
+    {
+        if (mRunning.exchange(false) == false)
+        {
+            return;
+        }
+
+        // 수신 소켓을 닫아 블로킹된 accept를 반환시킴
+        SocketUtils::CloseSocket(mSocket);
+        if (mThread.joinable())
+        {
+            mThread.join();
+        }
+
+        gLogger->Info(TEXT_8("MetricExporter: Stopped"));
+    }
+
+    void MetricExporter::Run()
+    {
+        while (mRunning.load())
+        {
+            SOCKET client = ::accept(mSocket, nullptr, nullptr);
+            if (client == INVALID_SOCKET)
+            {
+                continue;
+            }
+
+            HandleClient(client);
+            SocketUtils::CloseSocket(client);
+        }
+    }
+
+    /**
+     * 요청 한 건을 처리합니다.
+     *
+     * @param client 연결된 클라이언트 소켓
+     *
+     * 동작:
+     * 1. 요청 줄을 수신 (시간 초과 시 종료)
+     * 2. GET /metrics이면 레지스트리를 텍스트로 출력해 응답, 아니면 404
+     * 3. 응답 후 연결을 닫음 (Connection: close)
+     */
+    void MetricExporter::HandleClient(SOCKET client)
+    {
+        SetSocketOpt(client, SOL_SOCKET, SO_RCVTIMEO, static_cast<DWORD>(kReceiveTimeoutMs));
+
+        Char8 request[kRequestBufferSize] = {};
+        const Int32 received = ::recv(client, request, static_cast<Int32>(kRequestBufferSize - 1), 0);
+        if (received <= 0)
+        {
+            return;
+        }
+
+        const String8View requestLine(request, static_cast<size_t>(received));
+        const Bool isMetrics = requestLine.starts_with("GET /metrics ") || requestLine.starts_with("GET /metrics?");
+
+        const String8 body = isMetrics ? gMetricRegistry->Export() : String8("Not Found\n");
+
+        String8 response = fmt::format("HTTP/1.0 {}\r\n"
+                                       "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+                                       "Content-Length: {}\r\n"
+                                       "Connection: close\r\n"
+                                       "\r\n",
+                                       isMetrics ? "200 OK" : "404 Not Found", body.size());
+        response += body;
+
+        Int64 sentSize = 0;
+        while (sentSize < static_cast_64(response.size()))
+        {
+            const Int32 sent = ::send(client, response.data() + sentSize, static_cast<Int32>(response.size() - sentSize), 0);
+            if (sent <= 0)
+            {
+                return;
+            }
+            sentSize += sent;
+        }
+    }
+} // namespace core
@@ -0,0 +1,41 @@
+﻿/*    Core/Metric/Exporter.h    */
+
+#pragma once
+
+namespace core
+{
+    /*
+     * MetricExporter - 로컬 관리 포트에서 메트릭을 제공하는 HTTP 엔드포인트
+     *
+     * 주요 기능:
+     * - 127.0.0.1의 지정된 포트에서 GET /metrics 요청에 Prometheus 텍스트 응답
+     * - 전용 스레드에서 블로킹 소켓으로 한 번에 한 요청씩 처리
+     *
+     * 특징:
+     * - 루프백 주소에만 바인딩하므로 외부에서 접근 불가
+     * - 스크레이프 주기(수 초)에 한 번 동작하므로 입출력 워커와 잡 워커를 사용하지 않음
+     * - Stop()은 수신 소켓을 닫아 대기 중인 accept를 깨운 뒤 스레드를 합류
+     */
+    class MetricExporter
+    {
+    public:
+                        MetricExporter() = default;
+                        ~MetricExporter();
+
+        Int64           Start(UInt16 port);
+        void            Stop();
+
+    private:
+        void            Run();
+        void            HandleClient(SOCKET client);
+
+    private:
+        static constexpr Int64      kRequestBufferSize = 1024;
+        static constexpr Int32      kReceiveTimeoutMs = 1'000;
+
+    private:
+        SOCKET                      mSocket = INVALID_SOCKET;
+        Thread                      mThread;
+        Atomic<Bool>                mRunning = false;
+    };
+} // namespace core
@@ -0,0 +1,309 @@
+﻿/*    Core/Metric/Metric.cpp    */
+
+#include "Core/Pch.h"
+#include "Core/Metric/Metric.h"
+
+namespace core
+{
+    namespace
+    {
+        const Char8* GetTypeName(MetricType type)
+        {
+            switch (type)
+            {
+            case MetricType::Counter:   return TEXT_8("counter");
+            case MetricType::Gauge:     return TEXT_8("gauge");
+            case MetricType::Histogram: return TEXT_8("histogram");
+            default:                    return TEXT_8("untyped");
+            }
+        }
+    } // namespace
+
+    Metric::Metric(String8View name, String8View help)
+        : mName(name)
+        , mHelp(help)
+    {}
+
+    Int64 Counter::GetValue() const
+    {
+        Int64 value = 0;
+        for (const Shard& shard : mShards)
+        {
+            value += shard.value.load(std::memory_order_relaxed);
+        }
+
+        return value;
+    }
+
+    void Counter::Export(String8& out) const
+    {
+        fmt::format_to(std::back_inserter(out), "{} {}\n", GetName(), GetValue());
+    }
+
+    /**
+     * 스크레이프 시점에 값을 읽을 샘플러를 지정합니다.
+     *
+     * @param sampler 현재 값을 반환하는 함수
+     * @return 지정했으면 true, 이미 다른 샘플러가 있으면 false (기존 샘플러 유지)
+     */
+    Bool Gauge::SetSampler(Function<Int64(void)> sampler)
+    {
+        SrwLockWriteGuard guard(mSamplerLock);
+        if (mSampler)
+        {
+            return false;
+        }
+
+        mSampler = std::move(sampler);
+        return true;
+    }
+
+    void Gauge::ClearSampler()
+    {
+        SrwLockWriteGuard guard(mSamplerLock);
+        mSampler = nullptr;
+    }
+
+    Int64 Gauge::GetValue() const
+    {
+        SrwLockReadGuard guard(mSamplerLock);
+        if (mSampler)
+        {
+            return mSampler();
+        }
+
+        return mValue.load(std::memory_order_relaxed);
+    }
+
+    void Gauge::Export(String8& out) const
+    {
+        fmt::format_to(std::back_inserter(out), "{} {}\n", GetName(), GetValue());
+    }
+
+    /**
+     * 값이 속한 버킷 인덱스를 계산합니다.
+     *
+     * @param value 기록할 값 (음수는 0, 범위를 넘는 값은 마지막 버킷)
+     * @return 버킷 인덱스
+     *
+     * 동작:
+     * 1. kSubBucketCount 미만의 값은 값 자체가 인덱스 (정확한 값)
+     * 2. 그 이상은 최상위 비트 위치로 구간을 정하고, 그 아래 kSubBucketBits 비트로 하위 버킷을 정함
+     */
+    Int32 Histogram::GetBucketIndex(Int64 value)
+    {
+        if (value < kSubBucketCount)
+        {
+            return static_cast<Int32>(std::max<Int64>(value, 0));
+        }
+
+        const UInt64 clamped = std::min<UInt64>(static_cast<UInt64>(value), (1ULL << kMaxExponent) - 1);
+        const Int32 exponent = static_cast<Int32>(std::bit_width(clamped)) - 1;
+        const Int32 shift = exponent - kSubBucketBits;
+        const Int32 subIndex = static_cast<Int32>((clamped >> shift) & (kSubBucketCount - 1));
+
+        return (shift + 1) * kSubBucketCount + subIndex;
+    }
+
+    Int64 Histogram::GetBucketLowerBound(Int32 index)
+    {
+        if (index < kSubBucketCount)
+        {
+            return index;
+        }
+
+        const Int32 shift = index / kSubBucketCount - 1;
+        const Int64 subIndex = index % kSubBucketCount;
+
+        return (kSubBucketCount + subIndex) << shift;
+    }
+
+    /**
+     * 값을 현재 스레드의 샤드에 기록합니다.
+     *
+     * 핫 경로 비용은 버킷 계산(비트 연산 몇 개)과 relaxed fetch_add 2회입니다.
+     * 최댓값은 기존 값보다 클 때만 갱신하므로 대부분 읽기 1회로 끝납니다.
+     */
+    void Histogram::Record(Int64 value)
+    {
+        Shard& shard = mShards[GetShardIndex<kShardCount>()];
+        shard.counts[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+        shard.sum.fetch_add(value, std::memory_order_relaxed);
+
+        Int64 max = shard.max.load(std::memory_order_relaxed);
+        while ((value > max) && !shard.max.compare_exchange_weak(OUT max, value, std::memory_order_relaxed))
+        {}
+    }
+
+    void Histogram::TakeSnapshot(OUT Snapshot& snapshot) const
+    {
+        snapshot = Snapshot();
+        for (const Shard& shard : mShards)
+        {
+            for (Int32 i = 0; i < kBucketCount; ++i)
+            {
+                const Int64 count = shard.counts[i].load(std::memory_order_relaxed);
+                snapshot.counts[i] += count;
+                snapshot.totalCount += count;
+            }
+            snapshot.sum += shard.sum.load(std::memory_order_relaxed);
+            snapshot.max = std::max(snapshot.max, shard.max.load(std::memory_order_relaxed));
+        }
+    }
+
+    /**
+     * 2의 거듭제곱 경계마다 누적 버킷을 출력합니다.
+     *
+     * 하위 버킷 전체를 출력하면 시계열이 너무 많아지므로 경계 le=2^k-1 (k = 0..kMaxExponent)만 출력합니다.
+     * 하위 버킷은 2의 거듭제곱 구간 안에 포함되므로 경계별 누적 값은 정확합니다.
+     */
+    void Histogram::Export(String8& out) const
+    {
+        auto snapshot = std::make_unique<Snapshot>();
+        TakeSnapshot(OUT *snapshot);
+
+        auto inserter = std::back_inserter(out);
+
+        Int64 cumulative = 0;
+        Int32 bucketIndex = 0;
+        for (Int32 exponent = 0; exponent <= kMaxExponent; ++exponent)
+        {
+            const Int64 bound = (1LL << exponent) - 1;
+            while ((bucketIndex < kBucketCount) && (GetBucketUpperBound(bucketIndex) <= bound))
+            {
+                cumulative += snapshot->counts[bucketIndex++];
+            }
+            fmt::format_to(inserter, "{}_bucket{{le=\"{}\"}} {}\n", GetName(), bound, cumulative);
+        }
+
+        fmt::format_to(inserter, "{}_bucket{{le=\"+Inf\"}} {}\n", GetName(), snapshot->totalCount);
+        fmt::format_to(inserter, "{}_sum {}\n", GetName(), snapshot->sum);
+        fmt::format_to(inserter, "{}_count {}\n", GetName(), snapshot->totalCount);
+    }
+
+    /**
+     * 백분위수 값을 계산합니다.
+     *
+     * @param percentile 0 ~ 100 사이의 백분위
+     * @return 해당 순위가 속한 버킷의 상한 (최댓값을 넘지 않음), 기록이 없으면 0
+     */
+    Int64 Histogram::Snapshot::GetPercentile(Float64 percentile) const
+    {
+        if (totalCount == 0)
+        {
+            return 0;
+        }
+
+        const Int64 rank = std::max<Int64>(static_cast<Int64>(std::ceil(totalCount * percentile / 100.0)), 1);
+
+        Int64 cumulative = 0;
+        for (Int32 i = 0; i < kBucketCount; ++i)
+        {
+            cumulative += counts[i];
+            if (cumulative >= rank)
+            {
+                return std::min(GetBucketUpperBound(i), max);
+            }
+        }
+
+        return max;
+    }
+
+    void Histogram::Snapshot::Merge(const Snapshot& other)
+    {
+        for (Int32 i = 0; i < kBucketCount; ++i)
+        {
+            counts[i] += other.counts[i];
+        }
+        totalCount += other.totalCount;
+        sum += other.sum;
+        max = std::max(max, other.max);
+    }
+
+    Counter& MetricRegistry::AddCounter(String8View name, String8View help)
+    {
+        return Add<Counter>(name, help);
+    }
+
+    Gauge& MetricRegistry::AddGauge(String8View name, String8View help)
+    {
+        return Add<Gauge>(name, help);
+    }
+
+    /**
+     * 샘플러로 값을 읽는 게이지를 등록합니다.
+     *
+     * @param name 메트릭 이름
+     * @param help 메트릭 설명
+     * @param sampler 스크레이프 시점에 현재 값을 반환하는 함수
+     * @return 샘플러를 지정한 게이지, 같은 이름의 게이지에 이미 샘플러가 있으면 nullptr
+     *
+     * 샘플러가 캡처한 객체의 소유자는 반환된 게이지를 보관했다가 파괴될 때 ClearSampler를 호출합니다.
+     */
+    Gauge* MetricRegistry::AddGauge(String8View name, String8View help, Function<Int64(void)> sampler)
+    {
+        Gauge& gauge = Add<Gauge>(name, help);
+        if (!gauge.SetSampler(std::move(sampler)))
+        {
+            gLogger->Error(TEXT_8("Gauge[{}]: Sampler already registered"), name);
+            return nullptr;
+        }
+
+        return &gauge;
+    }
+
+    Histogram& MetricRegistry::AddHistogram(String8View name, String8View help)
+    {
+        return Add<Histogram>(name, help);
+    }
+
+    /**
+     * 메트릭을 등록합니다.
+     *
+     * @param name 메트릭 이름 (Prometheus 이름 규칙을 따름)
+     * @param help 메트릭 설명
+     * @return 등록된 메트릭, 같은 이름의 메트릭이 있으면 기존 메트릭
+     */
+    template<typename T>
+    T& MetricRegistry::Add(String8View name, String8View help)
+    {
+        SrwLockWriteGuard guard(mLock);
+
+        for (const UniquePtr<Metric>& metric : mMetrics)
+        {
+            if (metric->GetName() == name)
+            {
+                T* existing = dynamic_cast<T*>(metric.get());
+                ASSERT_CRASH(existing != nullptr, "METRIC_TYPE_MISMATCH");
+                return *existing;
+            }
+        }
+
+        auto metric = std::make_unique<T>(name, help);
+        T& result = *metric;
+        mMetrics.push_back(std::move(metric));
+
+        return result;
+    }
+
+    /**
+     * 등록된 모든 메트릭을 Prometheus 텍스트 형식으로 출력합니다.
+     *
+     * @return # HELP, # TYPE 줄과 샘플 줄로 구성된 텍스트
+     */
+    String8 MetricRegistry::Export() const
+    {
+        String8 out;
+        out.reserve(kExportReserveSize);
+
+        SrwLockReadGuard guard(mLock);
+        for (const UniquePtr<Metric>& metric : mMetrics)
+        {
+            fmt::format_to(std::back_inserter(out), "# HELP {} {}\n# TYPE {} {}\n",
+                           metric->GetName(), metric->GetHelp(), metric->GetName(), GetTypeName(metric->GetType()));
+            metric->Export(out);
+        }
+
+        return out;
+    }
+} // namespace core
@@ -0,0 +1,209 @@
+﻿/*    Core/Metric/Metric.h    */
+
+#pragma once
+
+namespace core
+{
+    enum class MetricType : Int32
+    {
+        Counter = 0,
+        Gauge,
+        Histogram,
+    };
+
+    // 지연 시간 측정용 단조 시계 (마이크로초), 프로세스 안의 스탬프끼리만 비교
+    inline Int64 GetSteadyNowUs()
+    {
+        return std::chrono::duration_cast<MicroSec>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /*
+     * Metric - 메트릭 공통 기반 클래스
+     *
+     * 이름과 설명을 보관하고 Prometheus 텍스트 형식으로 현재 값을 출력합니다.
+     * 메트릭은 MetricRegistry가 소유하며 프로그램이 끝날 때까지 해제되지 않습니다.
+     */
+    class Metric
+    {
+    public:
+                            Metric(String8View name, String8View help);
+        virtual             ~Metric() = default;
+
+        // 복사 금지
+                            Metric(const Metric&) = delete;
+        Metric&             operator=(const Metric&) = delete;
+
+        virtual MetricType  GetType() const = 0;
+        virtual void        Export(String8& out) const = 0;
+
+        const String8&      GetName() const { return mName; }
+        const String8&      GetHelp() const { return mHelp; }
+
+    protected:
+        // 쓰레드 ID로 샤드를 선택 (샤드 수는 2의 거듭제곱)
+        template<Int32 ShardCount>
+        static Int32        GetShardIndex() { return tThreadId & (ShardCount - 1); }
+
+    private:
+        String8             mName;
+        String8             mHelp;
+    };
+
+    /*
+     * Counter - 단조 증가 카운터
+     *
+     * 특징:
+     * - 스레드별 캐시 라인 샤드에 relaxed fetch_add 1회로 누적 (경합 없음)
+     * - 읽기는 모든 샤드를 합산하므로 스크레이프처럼 드문 호출에만 사용
+     */
+    class Counter
+        : public Metric
+    {
+    public:
+        using Metric::Metric;
+
+        void                Add(Int64 value = 1) { mShards[GetShardIndex<kShardCount>()].value.fetch_add(value, std::memory_order_relaxed); }
+        Int64               GetValue() const;
+
+        MetricType          GetType() const override { return MetricType::Counter; }
+        void                Export(String8& out) const override;
+
+    private:
+        struct alignas(64) Shard
+        {
+            Atomic<Int64>   value = 0;
+        };
+
+    private:
+        static constexpr Int32      kShardCount = 64;
+
+    private:
+        Shard               mShards[kShardCount];
+    };
+
+    /*
+     * Gauge - 증감하거나 샘플링되는 현재 값
+     *
+     * 특징:
+     * - Set/Add로 값을 직접 갱신하거나
+     * - 샘플러 함수를 지정하면 스크레이프 시점에 값을 읽음 (핫 경로 비용 없음)
+     * - 샘플러는 하나만 지정할 수 있고, 샘플러가 참조하는 객체는 파괴되기 전에 ClearSampler 호출
+     */
+    class Gauge
+        : public Metric
+    {
+    public:
+        using Metric::Metric;
+
+        void                Set(Int64 value) { mValue.store(value, std::memory_order_relaxed); }
+        void                Add(Int64 value) { mValue.fetch_add(value, std::memory_order_relaxed); }
+        Bool                SetSampler(Function<Int64(void)> sampler);
+        void                ClearSampler();
+        Int64               GetValue() const;
+
+        MetricType          GetType() const override { return MetricType::Gauge; }
+        void                Export(String8& out) const override;
+
+    private:
+        alignas(64) Atomic<Int64>   mValue = 0;
+
+        mutable SRWLOCK             mSamplerLock = SRWLOCK_INIT;
+        Function<Int64(void)>       mSampler;
+    };
+
+    /*
+     * Histogram - HDR 방식의 로그-선형 히스토그램
+     *
+     * 주요 기능:
+     * - 2의 거듭제곱 구간마다 16개의 선형 하위 버킷으로 나눠 상대 오차 약 6% 이내로 기록
+     * - 0 ~ 2^40 범위의 값을 고정 크기 배열에 기록 (범위를 넘으면 마지막 버킷)
+     * - 스레드별 샤드에 relaxed fetch_add로 기록
+     * - 스냅샷에서 백분위수 계산, 익스포트는 2의 거듭제곱 경계로 누적
+     *
+     * 값의 단위는 메트릭 이름으로 표기합니다. (예: *_microseconds)
+     */
+    class Histogram
+        : public Metric
+    {
+    public:
+        static constexpr Int32      kSubBucketBits = 4;
+        static constexpr Int32      kSubBucketCount = 1 << kSubBucketBits;
+        static constexpr Int32      kMaxExponent = 40;
+        static constexpr Int32      kBucketCount = (kMaxExponent - kSubBucketBits + 1) * kSubBucketCount;
+
+        struct Snapshot
+        {
+            Int64           counts[kBucketCount] = {};
+            Int64           totalCount = 0;
+            Int64           sum = 0;
+            Int64           max = 0;
+
+            Int64           GetPercentile(Float64 percentile) const;
+            Float64         GetMean() const { return (totalCount > 0) ? static_cast<Float64>(sum) / totalCount : 0.0; }
+            void            Merge(const Snapshot& other);
+        };
+
+    public:
+        using Metric::Metric;
+
+        void                Record(Int64 value);
+        void                TakeSnapshot(OUT Snapshot& snapshot) const;
+
+        MetricType          GetType() const override { return MetricType::Histogram; }
+        void                Export(String8& out) const override;
+
+    public:
+        static Int32        GetBucketIndex(Int64 value);
+        static Int64        GetBucketLowerBound(Int32 index);
+        static Int64        GetBucketUpperBound(Int32 index) { return GetBucketLowerBound(index + 1) - 1; }
+
+    private:
+        struct alignas(64) Shard
+        {
+            Atomic<Int64>   counts[kBucketCount] = {};
+            Atomic<Int64>   sum = 0;
+            Atomic<Int64>   max = 0;
+        };
+
+    private:
+        static constexpr Int32      kShardCount = 16;
+
+    private:
+        Shard               mShards[kShardCount];
+    };
+
+    /*
+     * MetricRegistry - 메트릭 등록 및 Prometheus 텍스트 출력
+     *
+     * 주요 기능:
+     * - 이름으로 메트릭을 등록하고 같은 이름이면 기존 메트릭 반환
+     * - 등록된 모든 메트릭을 Prometheus 텍스트 형식(0.0.4)으로 출력
+     *
+     * 사용 예시:
+     * static Counter& sCounter = gMetricRegistry->AddCounter(TEXT_8("core_example_total"), TEXT_8("Example"));
+     * sCounter.Add();
+     *
+     * 등록은 락으로 보호되므로 핫 경로에서는 반환된 참조를 정적 변수에 보관해 사용합니다.
+     */
+    class MetricRegistry
+    {
+    public:
+        Counter&            AddCounter(String8View name, String8View help);
+        Gauge&              AddGauge(String8View name, String8View help);
+        Gauge*              AddGauge(String8View name, String8View help, Function<Int64(void)> sampler);
+        Histogram&          AddHistogram(String8View name, String8View help);
+
+        String8             Export() const;
+
+    private:
+        template<typename T>
+        T&                  Add(String8View name, String8View help);
+
+    private:
+        static constexpr Int64      kExportReserveSize = 16 * 1024;
+
+    private:
+        mutable SRWLOCK                 mLock = SRWLOCK_INIT;
+        Vector<UniquePtr<Metric>>       mMetrics;
+    };
+} // namespace core
@@ -0,0 +1,126 @@
+﻿/*    Core/Network/Batch.cpp    */
+
+#include "Core/Pch.h"
+#include "Core/Network/Batch.h"
+#include "Core/Network/Session.h"
+#include "Core/Metric/Metric.h"
+
+namespace core
+{
+    namespace
+    {
+        // 스레드별 묶음 상태
+        struct BatchState
+        {
+            Int32                       depth = 0;
+            Int64                       startUs = 0; // 첫 세션을 미룬 시각
+            Vector<SharedPtr<Session>>  sessions;
+        };
+
+        thread_local BatchState tBatchState;
+
+        // 묶음 메트릭 (처음 사용할 때 등록)
+        struct BatchMetrics
+        {
+            Counter&    flushes = gMetricRegistry->AddCounter(TEXT_8("net_send_batch_flushes_total"), TEXT_8("Send batches flushed"));
+            Counter&    deferredSessions = gMetricRegistry->AddCounter(TEXT_8("net_send_batch_sessions_total"), TEXT_8("Session sends deferred to a batch flush"));
+            Counter&    capFlushes = gMetricRegistry->AddCounter(TEXT_8("net_send_batch_cap_flushes_total"), TEXT_8("Send batches flushed early by the latency cap"));
+        };
+
+        BatchMetrics& GetMetrics()
+        {
+            static BatchMetrics sMetrics;
+            return sMetrics;
+        }
+    } // namespace
+
+    Atomic<Int64> SendBatch::sLatencyCapUs = 0;
+
+    /**
+     * 동작:
+     * 1. 묶음이 꺼져 있거나 범위 밖이면 실패
+     * 2. 묶음의 첫 세션이면 지연 상한의 기준 시각 기록
+     * 3. 세션을 목록에 추가하고, 기준 시각부터 지연 상한이 지났으면 바로 모두 송신
+     */
+    Bool SendBatch::TryDefer(const SharedPtr<Session>& session)
+    {
+        BatchState& state = tBatchState;
+        if ((state.depth == 0) || !IsEnabled())
+        {
+            return false;
+        }
+
+        const Int64 nowUs = GetSteadyNowUs();
+        if (state.sessions.empty())
+        {
+            state.startUs = nowUs;
+        }
+
+        state.sessions.push_back(session);
+        GetMetrics().deferredSessions.Add();
+
+        if (nowUs - state.startUs >= GetLatencyCapUs())
+        {
+            GetMetrics().capFlushes.Add();
+            Flush();
+        }
+
+        return true;
+    }
+
+    /**
+     * 동작:
+     * 1. 목록을 통째로 가져와 비움 (송신 실패 통지에서 다시 송신해도 새 목록에 들어감)
+     * 2. 세션마다 송신 등록 (연결이 끊긴 세션은 대기 중인 버퍼를 버림)
+     */
+    void SendBatch::Flush()
+    {
+        BatchState& state = tBatchState;
+        if (state.sessions.empty())
+        {
+            return;
+        }
+
+        Vector<SharedPtr<Session>> sessions;
+        sessions.swap(state.sessions);
+
+        for (const auto& session : sessions)
+        {
+            session->RegisterSend();
+        }
+
+        GetMetrics().flushes.Add();
+
+        // 목록의 용량을 재사용
+        sessions.clear();
+        if (state.sessions.empty())
+        {
+            state.sessions.swap(sessions);
+        }
+    }
+
+    void SendBatch::FlushIfDue()
+    {
+        const BatchState& state = tBatchState;
+        if (!state.sessions.empty() && (GetSteadyNowUs() - state.startUs >= GetLatencyCapUs()))
+        {
+            GetMetrics().capFlushes.Add();
+            Flush();
+        }
+    }
+
+    void SendBatch::Enter()
+    {
+        ++tBatchState.depth;
+    }
+
+    void SendBatch::Leave()
+    {
+        ASSERT_CRASH_DEBUG(tBatchState.depth > 0, "SEND_BATCH_NOT_ENTERED");
+
+        if (--tBatchState.depth == 0)
+        {
+            Flush();
+        }
+    }
+} // namespace core
@@ -0,0 +1,71 @@
+﻿/*    Core/Network/Batch.h    */
+
+#pragma once
+
+namespace core
+{
+    class Session;
+
+    /*
+     * SendBatch - 스레드별 송신 묶음 (틱/잡 처리 단위의 송신 합치기)
+     *
+     * 묶음 범위(SendBatchScope) 안에서 송신 중이 아닌 세션에 SendAsync를 호출하면 송신 등록을 미루고,
+     * 범위가 끝날 때 세션마다 한 번만 송신을 등록합니다. 미루는 동안 추가된 버퍼는 송신 큐에 쌓이므로
+     * 한 틱에 같은 세션으로 보낸 여러 메시지가 WSASend 한 번으로 나갑니다.
+     *
+     * 송신 등록 책임:
+     * - 비어 있던 송신 큐에 추가한 스레드가 송신 시작을 담당하는 SendQueue 규칙은 그대로 유지
+     * - 묶음 안에서는 그 책임을 현재 스레드의 묶음 목록으로 넘기므로 세션은 목록에 한 번만 들어감
+     * - 송신 중인 세션에 추가한 버퍼는 송신 완료 처리에서 이어서 보내므로 묶음과 관계없음
+     *
+     * 지연 상한:
+     * - 첫 세션을 미룬 시각부터 지연 상한이 지나면 범위가 끝나기 전이라도 모두 송신 (긴 틱이나 잡 처리 대비)
+     * - 상한 확인은 송신을 미룰 때와 FlushIfDue() 호출 지점에서만 수행
+     * - 지연 상한이 0이면 묶지 않고 즉시 송신 (기본값)
+     *
+     * 스레드 규칙:
+     * - Configure는 서비스 시작 전에 호출
+     * - 묶음 범위를 연 스레드는 범위 안에서 무기한 대기하면 안 됨 (미룬 송신이 나가지 않음)
+     */
+    class SendBatch
+    {
+    public:
+        static void     Configure(Int64 latencyCapUs) { sLatencyCapUs.store(std::max<Int64>(latencyCapUs, 0)); }
+        static Bool     IsEnabled() { return sLatencyCapUs.load(std::memory_order_relaxed) > 0; }
+        static Int64    GetLatencyCapUs() { return sLatencyCapUs.load(std::memory_order_relaxed); }
+
+        /**
+         * 현재 스레드가 묶음 범위 안이면 세션의 송신 등록을 미룹니다.
+         *
+         * @param session 비어 있던 송신 큐에 버퍼를 추가한 세션
+         * @return 미뤘으면 true, 묶음 범위 밖이거나 묶음이 꺼져 있으면 false (호출한 스레드가 바로 송신)
+         */
+        static Bool     TryDefer(const SharedPtr<Session>& session);
+
+        // 미룬 세션을 모두 송신 등록
+        static void     Flush();
+        // 지연 상한이 지났으면 미룬 세션을 모두 송신 등록
+        static void     FlushIfDue();
+
+    private:
+        friend class SendBatchScope;
+
+        static void     Enter();
+        static void     Leave();
+
+    private:
+        static Atomic<Int64>    sLatencyCapUs;
+    };
+
+    // 생성부터 소멸까지 현재 스레드의 송신을 묶는 범위 (중첩 가능, 가장 바깥 범위가 끝날 때 송신)
+    class SendBatchScope
+    {
+    public:
+        SendBatchScope() { SendBatch::Enter(); }
+        ~SendBatchScope() { SendBatch::Leave(); }
+
+        // 복사 금지
+        SendBatchScope(const SendBatchScope&) = delete;
+        SendBatchScope& operator=(const SendBatchScope&) = delete;
+    };
+} // namespace core
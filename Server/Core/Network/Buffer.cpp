@@ -2,6 +2,7 @@
 
 #include "Core/Pch.h"
 #include "Core/Network/Buffer.h"
+#include "Core/Metric/Metric.h"
 
 namespace core
 {
@@ -184,6 +185,28 @@ namespace core
         mWrittenSize = 0;
     }
 
+    /**
+     * SendChunkPool 생성자
+     *
+     * 사용 중인 청크 수 게이지를 등록합니다. 값은 스크레이프 시점에 샘플링합니다.
+     */
+    SendChunkPool::SendChunkPool()
+    {
+        mInUseGauge = gMetricRegistry->AddGauge(TEXT_8("net_send_chunks_in_use"), TEXT_8("Send chunks held by threads or send buffers"),
+                                                [this]()
+                                                {
+                                                    return GetInUseCount();
+                                                });
+    }
+
+    SendChunkPool::~SendChunkPool()
+    {
+        if (mInUseGauge != nullptr)
+        {
+            mInUseGauge->ClearSampler();
+        }
+    }
+
     /**
      * 송신 버퍼 할당
      *
@@ -248,6 +271,7 @@ namespace core
             }
         }
         // 새로운 청크 할당
+        mChunkCount.fetch_add(1, std::memory_order_relaxed);
         return SharedPtr<SendChunk>(new SendChunk(), Delete);
     }
 
@@ -264,6 +288,17 @@ namespace core
         mSendChunks.push_back(chunk);
     }
 
+    /**
+     * 풀 밖에서 사용 중인 청크 수
+     *
+     * @return 생성된 전체 청크 수에서 풀에 반환된 청크 수를 뺀 값
+     */
+    Int64 SendChunkPool::GetInUseCount()
+    {
+        READ_GUARD;
+        return mChunkCount.load(std::memory_order_relaxed) - static_cast_64(mSendChunks.size());
+    }
+
     /**
      * BufferReader 기본 생성자
      *
@@ -422,4 +457,211 @@ namespace core
         mSendBufs.swap(other.mSendBufs);
         mWsaBufs.swap(other.mWsaBufs);
     }
+
+    /**
+     * 등록된 송신 버퍼 중에 주어진 버퍼가 있는지 확인합니다.
+     *
+     * @param sendBuf 찾을 송신 버퍼
+     * @return 등록되어 있으면 true
+     */
+    Bool SendBufferManager::Contains(const SendBuffer* sendBuf) const
+    {
+        return std::any_of(mSendBufs.begin(), mSendBufs.end(),
+                           [sendBuf](const SharedPtr<SendBuffer>& registered) { return registered.get() == sendBuf; });
+    }
+
+    SendQueue::Node SendQueue::sSendingNode;
+
+    /**
+     * SendQueue 소멸자
+     *
+     * 송신되지 못하고 남은 노드를 해제합니다.
+     */
+    SendQueue::~SendQueue()
+    {
+        DeleteList(mHead.load());
+    }
+
+    /**
+     * 송신 버퍼 추가
+     *
+     * 여러 스레드에서 동시에 호출할 수 있습니다.
+     *
+     * @param sendBuf 추가할 송신 버퍼
+     * @return 큐가 송신 중이 아니었으면 true (호출한 스레드가 송신을 시작해야 함)
+     */
+    Bool SendQueue::Push(SharedPtr<SendBuffer> sendBuf)
+    {
+        Node* node = AllocNode(std::move(sendBuf));
+
+        Node* head = mHead.load();
+        do
+        {
+            node->next = head;
+        }
+        while (!mHead.compare_exchange_weak(OUT head, node));
+
+        return (head == nullptr);
+    }
+
+    /**
+     * 여러 송신 버퍼를 순서대로 연속해서 추가
+     *
+     * 여러 스레드에서 동시에 호출할 수 있습니다.
+     * 조각난 메시지의 프레임처럼 다른 버퍼가 사이에 끼면 안 되는 버퍼 목록에 사용합니다.
+     *
+     * @param sendBufs 추가할 송신 버퍼 목록 (비어 있으면 안 됨)
+     * @return 큐가 송신 중이 아니었으면 true (호출한 스레드가 송신을 시작해야 함)
+     */
+    Bool SendQueue::Push(const Vector<SharedPtr<SendBuffer>>& sendBufs)
+    {
+        ASSERT_CRASH(!sendBufs.empty(), "EMPTY_SEND_BUFFERS");
+
+        // 헤드 쪽이 최근에 추가된 노드이므로 마지막 버퍼의 노드가 목록의 앞에 오도록 연결
+        Node* first = nullptr;
+        Node* last = nullptr;
+        for (const auto& sendBuf : sendBufs)
+        {
+            Node* node = AllocNode(sendBuf);
+            node->next = last;
+            last = node;
+
+            if (first == nullptr)
+            {
+                first = node;
+            }
+        }
+
+        Node* head = mHead.load();
+        do
+        {
+            first->next = head;
+        }
+        while (!mHead.compare_exchange_weak(OUT head, last));
+
+        return (head == nullptr);
+    }
+
+    /**
+     * 대기 중인 버퍼를 모두 꺼내 추가된 순서대로 등록
+     *
+     * 송신 중인 스레드에서만 호출합니다. 큐는 송신 중 상태로 유지됩니다.
+     *
+     * @param bufferMgr 꺼낸 버퍼를 등록할 관리자
+     */
+    void SendQueue::PopAll(SendBufferManager& bufferMgr)
+    {
+        Node* node = mHead.exchange(&sSendingNode);
+
+        // 최근에 추가된 노드부터 연결되어 있으므로 뒤집는다
+        Node* reversed = nullptr;
+        while (!IsTerminal(node))
+        {
+            Node* next = node->next;
+            node->next = reversed;
+            reversed = node;
+            node = next;
+        }
+
+        while (reversed != nullptr)
+        {
+            Node* next = reversed->next;
+            bufferMgr.Register(std::move(reversed->sendBuf));
+            FreeNode(reversed);
+            reversed = next;
+        }
+    }
+
+    /**
+     * 송신 종료 시도
+     *
+     * 송신 중인 스레드에서만 호출합니다.
+     *
+     * @return 대기 중인 버퍼가 없어 송신 상태를 해제했으면 true, 버퍼가 남아 있으면 false
+     */
+    Bool SendQueue::TryFinish()
+    {
+        Node* expected = &sSendingNode;
+        return mHead.compare_exchange_strong(OUT expected, nullptr);
+    }
+
+    /**
+     * 대기 중인 버퍼를 모두 버리고 송신 상태를 해제
+     *
+     * 송신 중인 스레드에서만 호출합니다.
+     * 버리는 동안 다른 스레드가 추가한 버퍼도 함께 버립니다.
+     */
+    void SendQueue::Discard()
+    {
+        do
+        {
+            DeleteList(mHead.exchange(&sSendingNode));
+        }
+        while (!TryFinish());
+    }
+
+    void SendQueue::DeleteList(Node* node)
+    {
+        while (!IsTerminal(node))
+        {
+            Node* next = node->next;
+            FreeNode(node);
+            node = next;
+        }
+    }
+
+    /**
+     * 재사용 목록에서 노드를 꺼내 버퍼를 담습니다. 목록이 비어 있으면 새로 할당합니다.
+     *
+     * @param sendBuf 노드에 담을 송신 버퍼
+     * @return 다음 노드가 없는 노드
+     */
+    SendQueue::Node* SendQueue::AllocNode(SharedPtr<SendBuffer> sendBuf)
+    {
+        Node* node = nullptr;
+        if (!GetFreeNodes().try_dequeue(node))
+        {
+            node = new Node();
+        }
+
+        node->next = nullptr;
+        node->sendBuf = std::move(sendBuf);
+        return node;
+    }
+
+    /**
+     * 노드가 담은 버퍼를 해제하고 재사용 목록에 돌려줍니다.
+     * 목록이 kMaxFreeNodeCount만큼 차 있으면 노드를 해제합니다. (송신 폭주 뒤에 메모리를 붙잡지 않음)
+     */
+    void SendQueue::FreeNode(Node* node)
+    {
+        node->sendBuf.reset();
+
+        LockfreeQueue<Node*>& freeNodes = GetFreeNodes();
+        if ((static_cast_64(freeNodes.size_approx()) >= kMaxFreeNodeCount) ||
+            !freeNodes.enqueue(node))
+        {
+            delete node;
+        }
+    }
+
+    // 모든 송신 큐가 공유하는 노드 재사용 목록 (처음 사용할 때 생성)
+    LockfreeQueue<SendQueue::Node*>& SendQueue::GetFreeNodes()
+    {
+        static struct FreeNodes
+        {
+            LockfreeQueue<Node*>    queue;
+
+            ~FreeNodes()
+            {
+                Node* node = nullptr;
+                while (queue.try_dequeue(node))
+                {
+                    delete node;
+                }
+            }
+        } sFreeNodes;
+
+        return sFreeNodes.queue;
+    }
 } // namespace core
@@ -4,6 +4,8 @@
 
 namespace core
 {
+    class Gauge;
+
     /**
      * ReceiveBuffer - 네트워크 수신 데이터 관리 클래스
      *
@@ -24,6 +26,7 @@ namespace core
 
     public:
         void            Clear();
+        void            Reset() { mReadPos = 0; mWritePos = 0; } // 남은 데이터를 버림 (세션 재사용)
         Bool            OnRead(Int64 numBytes);
         Bool            OnWritten(Int64 numBytes);
 
@@ -99,12 +102,69 @@ namespace core
         WSABUF* GetWsaBuffers() { return mWsaBufs.data(); }
         Int64       GetWsaBufferCount() const { return mWsaBufs.size(); }
         Bool        IsEmpty() const { return mSendBufs.empty(); }
+        Bool        Contains(const SendBuffer* sendBuf) const;
 
     private:
         Vector<SharedPtr<SendBuffer>>   mSendBufs;
         Vector<WSABUF>                  mWsaBufs;
     };
 
+    /**
+     * SendQueue - 세션별 다중 생산자/단일 소비자 송신 큐
+     *
+     * 여러 스레드가 락 없이 송신 버퍼를 추가하고, 송신 중인 한 스레드만 꺼내갑니다.
+     * 송신 상태는 별도 플래그 없이 큐의 헤드 값으로 표현합니다.
+     *
+     * 헤드 상태:
+     * - nullptr: 송신 중이 아니고 대기 중인 버퍼도 없음
+     * - &sSendingNode: 송신 중이고 대기 중인 버퍼는 없음
+     * - 그 외: 송신 중이고 대기 중인 버퍼가 있음 (최근에 추가된 노드부터 연결된 목록)
+     *
+     * 특징:
+     * - Push는 CAS 한 번으로 노드를 헤드에 연결하며, 비어 있던 큐에 추가한 스레드가 송신 시작을 담당
+     * - 여러 버퍼를 한 번에 추가하면 미리 연결한 노드 목록을 CAS 한 번으로 연결하므로 다른 스레드의 버퍼가 끼어들지 않음
+     * - PopAll은 헤드를 교환해 목록 전체를 가져온 뒤 추가된 순서로 SendBufferManager에 등록
+     * - 같은 SendBuffer가 여러 세션으로 브로드캐스트되므로 노드는 버퍼가 아닌 큐가 할당
+     * - 노드는 모든 큐가 공유하는 락프리 재사용 목록에서 꺼내고 돌려줌 (송신마다 new/delete 하지 않음)
+     *   생산자 스레드가 꺼내고 송신 스레드가 돌려주므로 스레드 로컬 캐시 대신 공유 목록 사용
+     */
+    class SendQueue
+    {
+    public:
+                    ~SendQueue();
+
+        Bool        Push(SharedPtr<SendBuffer> sendBuf);
+        Bool        Push(const Vector<SharedPtr<SendBuffer>>& sendBufs);
+        void        PopAll(SendBufferManager& bufferMgr);
+        Bool        TryFinish();
+        void        Discard();
+        Bool        IsIdle() const { return mHead.load() == nullptr; }
+
+    private:
+        struct Node
+        {
+            Node*                   next = nullptr;
+            SharedPtr<SendBuffer>   sendBuf;
+        };
+
+        static Bool     IsTerminal(const Node* node) { return (node == nullptr) || (node == &sSendingNode); }
+        static void     DeleteList(Node* node);
+
+        static Node*    AllocNode(SharedPtr<SendBuffer> sendBuf);
+        static void     FreeNode(Node* node);
+        static LockfreeQueue<Node*>&    GetFreeNodes();
+
+    private:
+        // 재사용 목록에 보관하는 최대 노드 수 (넘치는 노드는 해제)
+        static constexpr Int64  kMaxFreeNodeCount = 64 * 1024;
+
+        // 송신 중이고 대기 중인 버퍼가 없음을 나타내는 표식
+        static Node     sSendingNode;
+
+    private:
+        Atomic<Node*>   mHead = nullptr;
+    };
+
     /**
      * SendChunk - 송신 버퍼 메모리 청크 관리 클래스
      *
@@ -153,17 +213,23 @@ namespace core
     class SendChunkPool
     {
     public:
+        SendChunkPool();
+        ~SendChunkPool();
+
         SharedPtr<SendBuffer>   Alloc(Int64 allocSize);
         static void             Delete(SendChunk* chunk);
 
     private:
         SharedPtr<SendChunk>    Pop();
         void                    Push(SharedPtr<SendChunk> chunk);
+        Int64                   GetInUseCount();
 
 
     private:
         RW_LOCK;
         Vector<SharedPtr<SendChunk>>    mSendChunks;
+        Atomic<Int64>                   mChunkCount = 0; // 생성된 전체 청크 수
+        Gauge*                          mInUseGauge = nullptr;
     };
 
     /**
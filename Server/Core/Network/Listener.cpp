@@ -6,9 +6,26 @@
 #include "Core/Network/Socket.h"
 #include "Core/Network/Session.h"
 #include "Core/Network/Service.h"
+#include "Core/Metric/Metric.h"
 
 namespace core
 {
+    namespace
+    {
+        // 연결 수락 메트릭 (처음 사용할 때 등록)
+        struct ListenerMetrics
+        {
+            Counter&    accepts = gMetricRegistry->AddCounter(TEXT_8("net_listener_accepts_total"), TEXT_8("Connections accepted by listeners"));
+            Gauge&      pendingAccepts = gMetricRegistry->AddGauge(TEXT_8("net_listener_pending_accepts"), TEXT_8("AcceptEx requests posted and not yet completed"));
+        };
+
+        ListenerMetrics& GetMetrics()
+        {
+            static ListenerMetrics sMetrics;
+            return sMetrics;
+        }
+    } // namespace
+
     /**
      * Listener 생성자
      *
@@ -40,12 +57,14 @@ namespace core
      * 3. IO 이벤트 디스패처에 등록
      * 4. 소켓 옵션 설정 (주소 재사용, Linger 등)
      * 5. 주소 바인딩 및 리스닝 시작
-     * 6. AcceptEvent 생성 및 비동기 Accept 요청 등록
+     * 6. 최대 수만큼 AcceptEvent를 만들고 최소 수만큼 비동기 Accept 요청 등록
      *
      * @param service 이 리스너가 사용할 서버 서비스 객체
+     * @param address 바인딩할 주소
+     * @param dispatcher 리슨 소켓을 등록할 디스패처 (Accept 완료를 처리할 입출력 워커 결정)
      * @return 성공 시 SUCCESS(0), 실패 시 FAILURE(-1) 혹은 오류 코드
      */
-    Int64 Listener::StartAccept(SharedPtr<ServerService> service)
+    Int64 Listener::StartAccept(SharedPtr<ServerService> service, const NetAddress& address, SharedPtr<IoEventDispatcher> dispatcher)
     {
         Int64 result = SUCCESS;
 
@@ -61,7 +80,7 @@ namespace core
             return result;
         }
         // 리슨 소켓을 입출력 이벤트 디스패처에 등록
-        if (result = mService->GetIoEventDispatcher()->Register(shared_from_this()))
+        if (result = dispatcher->Register(shared_from_this()))
         {
             return result;
         }
@@ -76,7 +95,7 @@ namespace core
             return result;
         }
 
-        if (result = SocketUtils::BindAddress(mSocket, mService->GetAddress()))
+        if (result = SocketUtils::BindAddress(mSocket, address))
         {
             return result;
         }
@@ -86,17 +105,52 @@ namespace core
             return result;
         }
 
-        // accept 이벤트 생성 및 등록
-        const Int64 acceptCount = mService->GetMaxSessionCount();
-        mAcceptEvents.resize(acceptCount);
+        // accept 이벤트 생성 (이후 크기를 바꾸지 않음)
+        const Service::Config& config = mService->GetConfig();
+        mMaxCount = std::max<Int64>(std::min(config.maxPendingAccepts, config.maxSessionCount), 1);
+        mMinCount = std::clamp<Int64>(config.minPendingAccepts, 1, mMaxCount);
+        mTargetCount = mMinCount;
+        mWindowStartTick = ::GetTickCount64();
+
+        mRetryQueue = std::make_shared<JobQueue>();
+
+        mAcceptEvents.resize(mMaxCount);
+        mFreeAcceptEvents.reserve(mMaxCount);
         for (AcceptEvent& event : mAcceptEvents)
         {
-            RegisterAccept(&event);
+            mFreeAcceptEvents.push_back(&event);
         }
 
+        // 최소 수만큼 accept 등록
+        PostAccepts();
+
         return result;
     }
 
+    /**
+     * Accept 중지
+     *
+     * 리슨 소켓을 닫아 더 이상 연결을 수락하지 않습니다.
+     * 대기 중인 AcceptEx는 취소되어 완료 통지되며, 중지 이후의 완료는 다시 등록하지 않고 버립니다.
+     * 마지막 AcceptEvent가 소유권을 해제하면 리스너와 서비스 간의 순환 참조도 끊어집니다.
+     */
+    void Listener::Stop()
+    {
+        // 진행 중인 AcceptEx 등록이 끝난 뒤 닫음
+        SrwLockWriteGuard guard(mSocketLock);
+
+        if (mStopped.exchange(true))
+        {
+            return;
+        }
+
+        const Int64 result = SocketUtils::CloseSocket(mSocket);
+        if (SUCCESS != result)
+        {
+            HandleError(result);
+        }
+    }
+
     /**
      * IO 객체 핸들 반환
      *
@@ -128,23 +182,105 @@ namespace core
         ProcessAccept(acceptEvent, numBytes);
     }
 
+    /**
+     * 목표 수까지 비동기 Accept 등록
+     *
+     * 걸려 있는 Accept가 목표 수보다 적으면 빈 AcceptEvent를 꺼내 등록합니다.
+     * 등록에 실패하면 다음 Accept 완료나 재시도 타이머에서 다시 시도합니다.
+     *
+     * 동작:
+     * 1. 소켓 읽기 락을 잡고 중지 여부 확인 (락을 놓기 전에는 Stop이 소켓을 닫지 못함)
+     * 2. 빈 AcceptEvent를 꺼내 AcceptEx 등록
+     * 3. 실패하면 이벤트를 돌려주고 재시도를 예약, 성공하면 재시도 간격 초기화
+     */
+    void Listener::PostAccepts()
+    {
+        SrwLockReadGuard socketGuard(mSocketLock);
+
+        while (true)
+        {
+            AcceptEvent* event = nullptr;
+            {
+                SrwLockWriteGuard guard(mAcceptLock);
+
+                // 중지된 리스너는 accept를 다시 등록하지 않음
+                if (mStopped.load() ||
+                    (mPendingCount >= mTargetCount) ||
+                    mFreeAcceptEvents.empty())
+                {
+                    return;
+                }
+
+                event = mFreeAcceptEvents.back();
+                mFreeAcceptEvents.pop_back();
+                ++mPendingCount;
+            }
+            GetMetrics().pendingAccepts.Add(1);
+
+            if (!RegisterAccept(event))
+            {
+                ReleaseAcceptEvent(event, false);
+                ScheduleRetry();
+                return;
+            }
+
+            mRetryDelayMs.store(kMinAcceptRetryMs);
+        }
+    }
+
+    /**
+     * Accept 등록 재시도 예약
+     *
+     * 이미 예약되어 있으면 무시하고, 예약할 때마다 간격을 두 배로 늘립니다.
+     * 예약 작업은 리스너를 약하게 참조하므로 서비스가 해제되면 아무것도 하지 않습니다.
+     */
+    void Listener::ScheduleRetry()
+    {
+        if (mIsRetryScheduled.exchange(true))
+        {
+            return;
+        }
+
+        const Int64 delayMs = mRetryDelayMs.load();
+        mRetryDelayMs.store(std::min(delayMs * 2, kMaxAcceptRetryMs));
+        LOG_WARN(Network, TEXT_8("Listener: Failed to post accept, retrying in {} ms"), delayMs);
+
+        WeakPtr<Listener> weakListener = std::static_pointer_cast<Listener>(shared_from_this());
+        SharedPtr<Job> job = std::make_shared<Job>([weakListener]()
+                                                   {
+                                                       if (SharedPtr<Listener> listener = weakListener.lock())
+                                                       {
+                                                           listener->mIsRetryScheduled.store(false);
+                                                           listener->PostAccepts();
+                                                       }
+                                                   });
+        gJobTimer->Schedule(std::move(job), mRetryQueue, delayMs);
+    }
+
     /**
      * 비동기 Accept 등록
      *
      * 새로운 클라이언트 연결을 수락하기 위한 비동기 Accept 작업을 등록합니다.
      * 서비스로부터 새 세션을 생성하고 AcceptEx API를 사용해 비동기 Accept를 요청합니다.
+     * mSocketLock 읽기 락을 잡은 PostAccepts에서만 호출합니다.
      *
      * @param event 사용할 AcceptEvent 객체
+     * @return 등록에 성공하면 true
      */
-    void Listener::RegisterAccept(AcceptEvent* event)
+    Bool Listener::RegisterAccept(AcceptEvent* event)
     {
         SharedPtr<Session> session = mService->CreateSession();
+        if (nullptr == session)
+        {
+            return false;
+        }
+
         Int64 numBytes = 0;
         event->Init();
         event->session = session;
         event->owner = shared_from_this();
 
-        // 비동기 accept 요청
+        // 비동기 accept 요청 (원격 주소는 세션 수신 버퍼에 기록됨)
         Int64 result = SocketUtils::AcceptAsync(mSocket, session->GetSocket(), OUT session->mReceiveBuffer.AtWritePos(), OUT & numBytes, event);
         if ((SUCCESS != result) &&
             (WSA_IO_PENDING != result))
@@ -152,8 +288,10 @@ namespace core
             HandleError(result);
             event->owner.reset();
             event->session.reset();
-            RegisterAccept(event);
+            return false;
         }
+
+        return true;
     }
 
     /**
@@ -163,11 +301,11 @@ namespace core
      * 소켓 옵션 업데이트, 피어 주소 획득, 세션 연결 처리 등을 수행합니다.
      *
      * 주요 단계:
-     * 1. AcceptEvent에서 세션 및 결과 확인
-     * 2. 소켓 옵션 업데이트
-     * 3. 클라이언트 주소 정보 획득
-     * 4. 세션에 주소 설정 및 연결 처리
-     * 5. 다음 Accept 작업 등록
+     * 1. AcceptEvent에서 세션 및 결과 확인 후 이벤트 반환, 목표 수 갱신
+     * 2. 대체 Accept 작업을 먼저 등록 (세션 연결 처리 동안에도 다음 연결을 받을 수 있도록)
+     * 3. 소켓 옵션 업데이트
+     * 4. AcceptEx 버퍼에서 클라이언트 주소 해석 (getpeername 호출 없음)
+     * 5. 세션에 주소 설정 및 연결 처리
      *
      * @param event 완료된 AcceptEvent 객체
      * @param numBytes 수신된 초기 데이터 크기
@@ -176,11 +314,21 @@ namespace core
     {
         event->owner.reset();
         SharedPtr<Session> session = std::move(event->session);
+        const Int64 eventResult = event->result;
+        ReleaseAcceptEvent(event, (eventResult == SUCCESS));
+
+        // 중지로 취소된 accept는 버림
+        if (mStopped.load())
+        {
+            return;
+        }
+
+        PostAccepts();
+
         // accpet 처리 중 에러가 발생한 경우
-        if (event->result != SUCCESS)
+        if (eventResult != SUCCESS)
         {
-            HandleError(event->result);
-            RegisterAccept(event);
+            HandleError(eventResult);
             return;
         }
 
@@ -190,26 +338,64 @@ namespace core
         if (result != SUCCESS)
         {
             HandleError(result);
-            RegisterAccept(event);
             return;
         }
 
-        SOCKADDR_IN sockAddress = {};
-        Int32 sockAddressLength = sizeof_32(SOCKADDR_IN);
         // peer 소켓 주소를 가져온다
-        result = ::getpeername(session->GetSocket(), OUT reinterpret_cast<SOCKADDR*>(&sockAddress), &sockAddressLength);
+        NetAddress address;
+        result = SocketUtils::GetAcceptAddress(session->mReceiveBuffer.AtWritePos(), OUT address);
         if (result != SUCCESS)
         {
             HandleError(result);
-            RegisterAccept(event);
             return;
         }
 
+        GetMetrics().accepts.Add();
+        LOG_DEBUG(Network, TEXT_8("Listener: Accepted session[{}]"), session->GetId());
+
         // 세션 연결 처리
-        session->SetNetAddress(NetAddress(sockAddress));
+        session->SetNetAddress(address);
         session->ProcessConnect();
+    }
+
+    /**
+     * Accept 이벤트 반환 및 목표 수 갱신
+     *
+     * @param event 완료되었거나 등록에 실패한 AcceptEvent
+     * @param accepted 연결을 수락했으면 true (도착률 측정에 포함)
+     *
+     * 동작:
+     * 1. 이벤트를 빈 목록에 돌려주고 걸려 있는 수 감소
+     * 2. 걸려 있는 Accept가 목표의 1/4 아래로 소진되면 목표를 두 배로 (도착률이 등록 속도를 앞지름)
+     * 3. 측정 구간이 끝나면 구간 동안의 수락 수와 이전 목표의 절반 중 큰 값으로 목표 재설정
+     */
+    void Listener::ReleaseAcceptEvent(AcceptEvent* event, Bool accepted)
+    {
+        GetMetrics().pendingAccepts.Add(-1);
+
+        SrwLockWriteGuard guard(mAcceptLock);
+
+        mFreeAcceptEvents.push_back(event);
+        --mPendingCount;
 
-        RegisterAccept(event);
+        if (!accepted)
+        {
+            return;
+        }
+
+        ++mWindowAcceptCount;
+        if (mPendingCount < mTargetCount / 4)
+        {
+            mTargetCount = std::min(mTargetCount * 2, mMaxCount);
+        }
+
+        const Int64 nowTick = ::GetTickCount64();
+        if (nowTick - mWindowStartTick >= kAcceptRateWindowMs)
+        {
+            mTargetCount = std::clamp(std::max(mWindowAcceptCount, mTargetCount / 2), mMinCount, mMaxCount);
+            mWindowStartTick = nowTick;
+            mWindowAcceptCount = 0;
+        }
     }
 
     /**
@@ -23,10 +23,23 @@ namespace core
      * - 다중 동시 연결 처리를 위한 AcceptEvent 풀 관리
      * - IO 이벤트 처리를 위한 IIoObjectOwner 인터페이스 구현
      *
+     * 미리 걸어 두는 Accept 수:
+     * - minPendingAccepts로 시작하고, 걸어 둔 Accept가 목표의 1/4 아래로 소진되면 두 배로 늘림
+     * - kAcceptRateWindowMs 구간마다 그 구간의 수락 수(이전 목표의 절반 이상)로 목표를 다시 정함
+     * - 목표는 [minPendingAccepts, min(maxPendingAccepts, maxSessionCount)] 범위로 제한
+     * - 목표보다 많이 걸려 있으면 완료된 Accept를 다시 걸지 않아 자연스럽게 줄어듦
+     * - 등록에 실패하면 JobTimer로 다시 시도 (kMinAcceptRetryMs부터 두 배씩, 최대 kMaxAcceptRetryMs)
+     *   걸려 있는 Accept가 모두 실패해도 완료 통지가 없어 리스너가 멈추는 것을 막음
+     *
+     * 스레드 규칙:
+     * - AcceptEx 등록은 mSocketLock 읽기 락, Stop의 소켓 닫기는 쓰기 락 안에서 수행
+     *   (중지 확인 뒤 닫힌 소켓이나 재사용된 핸들에 AcceptEx를 거는 경합 방지)
+     *
      * 사용 패턴:
      * 1. ServerService가 Listener 객체 생성
      * 2. StartAccept() 호출을 통한 리스닝 시작
-     * 3. 비동기 Accept 완료 시 이벤트 처리 및 세션 생성
+     * 3. 비동기 Accept 완료 시 대체 Accept를 먼저 건 뒤 세션 연결 처리
+     * 4. Stop() 호출로 리슨 소켓을 닫아 대기 중인 Accept 취소
      */
     class Listener
         : public IIoObjectOwner
@@ -36,21 +49,47 @@ namespace core
         ~Listener();
 
     public:
-        Int64               StartAccept(SharedPtr<ServerService> service);
+        Int64               StartAccept(SharedPtr<ServerService> service, const NetAddress& address, SharedPtr<IoEventDispatcher> dispatcher);
+        void                Stop();
 
     public:
         virtual HANDLE      GetIoObject() override;
         virtual void        DispatchIoEvent(IoEvent* event, Int64 numBytes = 0) override;
 
     private:
-        void                RegisterAccept(AcceptEvent* event);
+        void                PostAccepts();
+        void                ScheduleRetry();
+        Bool                RegisterAccept(AcceptEvent* event);
         void                ProcessAccept(AcceptEvent* event, Int64 numBytes);
+        void                ReleaseAcceptEvent(AcceptEvent* event, Bool accepted);
 
         void                HandleError(Int64 errorCode);
 
+    private:
+        static constexpr Int64      kAcceptRateWindowMs = 100;
+        static constexpr Int64      kMinAcceptRetryMs = 10;
+        static constexpr Int64      kMaxAcceptRetryMs = 1000;
+
     protected:
         SOCKET                      mSocket = INVALID_SOCKET;
-        Vector<AcceptEvent>         mAcceptEvents;
         SharedPtr<ServerService>    mService;
+        Atomic<Bool>                mStopped = false;
+        SRWLOCK                     mSocketLock = SRWLOCK_INIT;
+
+        // 등록 실패 재시도 (예약은 한 번에 하나)
+        SharedPtr<JobQueue>         mRetryQueue;
+        Atomic<Bool>                mIsRetryScheduled = false;
+        Atomic<Int64>               mRetryDelayMs = kMinAcceptRetryMs;
+
+        // Accept 이벤트 풀과 목표 수 (mAcceptLock으로 보호)
+        SRWLOCK                     mAcceptLock = SRWLOCK_INIT;
+        Vector<AcceptEvent>         mAcceptEvents; // 최대 수만큼 한 번만 생성 (주소 고정)
+        Vector<AcceptEvent*>        mFreeAcceptEvents;
+        Int64                       mPendingCount = 0;
+        Int64                       mTargetCount = 0;
+        Int64                       mMinCount = 0;
+        Int64                       mMaxCount = 0;
+        Int64                       mWindowStartTick = 0;
+        Int64                       mWindowAcceptCount = 0;
     };
 } // namespace core
@@ -4,9 +4,37 @@
 #include "Core/Network/Service.h"
 #include "Core/Network/Session.h"
 #include "Core/Network/Listener.h"
+#include "Core/Network/Socket.h"
+#include "Core/Metric/Metric.h"
 
 namespace core
 {
+    namespace
+    {
+        // 세션/소켓 생성 메트릭 (처음 사용할 때 등록)
+        struct ServiceMetrics
+        {
+            Counter&    socketsCreated = gMetricRegistry->AddCounter(TEXT_8("net_session_sockets_created_total"), TEXT_8("Session sockets created with WSASocket"));
+            Counter&    socketsReused = gMetricRegistry->AddCounter(TEXT_8("net_session_sockets_reused_total"), TEXT_8("Session sockets reused after a TF_REUSE_SOCKET disconnect"));
+            Counter&    sessionsCreated = gMetricRegistry->AddCounter(TEXT_8("net_sessions_created_total"), TEXT_8("Session objects created by the session factory"));
+            Counter&    sessionsReused = gMetricRegistry->AddCounter(TEXT_8("net_sessions_reused_total"), TEXT_8("Session objects reset and reused from the session pool"));
+        };
+
+        ServiceMetrics& GetMetrics()
+        {
+            static ServiceMetrics sMetrics;
+            return sMetrics;
+        }
+
+        // 주소의 포트에 offset을 더한 주소 (리스너/연결 대상 포트 분산)
+        NetAddress OffsetPort(const NetAddress& address, Int64 offset)
+        {
+            SOCKADDR_IN sockAddress = address.GetAddress();
+            sockAddress.sin_port = ::htons(static_cast<UInt16>(address.GetPort() + offset));
+            return NetAddress(sockAddress);
+        }
+    } // namespace
+
     /**
      * Service 생성자
      *
@@ -18,21 +46,40 @@ namespace core
     Service::Service(ServiceType type, const Config& config)
         : mType(type)
         , mConfig(config)
-    {}
+    {
+        // 조회(읽기)가 많아도 세션 추가/제거(쓰기)가 밀리지 않도록 쓰기 우선
+        mLocks[0].SetWriterPreferred(true);
+    }
 
     /**
      * Service 소멸자
      *
      * 서비스 리소스를 정리합니다. 파생 클래스에서 필요한 추가 정리 작업을 수행합니다.
+     * 재사용을 기다리던 세션은 소멸시키고(소켓도 닫힘), 소켓은 모두 닫습니다.
      */
     Service::~Service()
-    {}
+    {
+        for (Session* session : mPooledSessions)
+        {
+            delete session;
+        }
+
+        for (SOCKET& socket : mReusableSockets)
+        {
+            SocketUtils::CloseSocket(socket);
+        }
+    }
 
     /**
      * 새 세션 생성
      *
-     * 세션 팩토리를 사용하여 새 세션을 생성하고 초기화합니다.
-     * 생성된 세션에 고유 ID를 할당하고 IO 이벤트 디스패처에 등록합니다.
+     * 세션을 준비하고 고유 ID를 할당합니다.
+     * 마지막 참조가 사라지면 세션은 소멸하지 않고 DestroySession을 거쳐 세션 풀로 돌아옵니다.
+     *
+     * 세션 준비:
+     * 1. 세션 풀에 초기화된 세션이 있으면 재사용 (소켓, 수신 버퍼 유지, 디스패처 등록 생략)
+     * 2. 없으면 세션 팩토리로 생성하고, 보관 중인 소켓이 있으면 재사용 (이미 디스패처에 등록되어 있음)
+     * 3. 보관 중인 소켓도 없으면 새 소켓을 생성하고 IO 이벤트 디스패처에 등록
      *
      * @return 생성된 세션 (성공시) 또는 nullptr (실패시)
      */
@@ -40,10 +87,37 @@ namespace core
     {
         static Atomic<Int64> sNextSessionId = 1;
 
-        SharedPtr<Session> session = mConfig.sessionFactory();
+        SharedPtr<Session> session = AcquirePooledSession();
+        if (nullptr != session)
+        {
+            GetMetrics().sessionsReused.Add();
+            session->SetService(shared_from_this());
+            session->SetId(sNextSessionId.fetch_add(1));
+            return session;
+        }
+
+        WeakPtr<Service> service = weak_from_this();
+        session = SharedPtr<Session>(mConfig.sessionFactory(), [service](Session* session)
+                                     {
+                                         DestroySession(service, session);
+                                     });
+        GetMetrics().sessionsCreated.Add();
         session->SetService(shared_from_this());
         session->SetId(sNextSessionId.fetch_add(1));
 
+        session->mSocket = AcquireSocket();
+        if (INVALID_SOCKET != session->mSocket)
+        {
+            GetMetrics().socketsReused.Add();
+            return session;
+        }
+
+        if (SUCCESS != SocketUtils::CreateSocket(OUT session->mSocket))
+        {
+            return nullptr;
+        }
+        GetMetrics().socketsCreated.Add();
+
         // IoEventDispatcher에 세션 등록
         if (SUCCESS == mConfig.ioEventDispatcher->Register(session))
         {
@@ -133,6 +207,210 @@ namespace core
         return nullptr;
     }
 
+    /**
+     * 재사용 소켓 반환
+     *
+     * TF_REUSE_SOCKET으로 연결 해제를 마친 세션이 소멸할 때 소켓을 서비스에 돌려줍니다.
+     * 보관 수는 최대 세션 수로 제한합니다.
+     *
+     * @param socket 반환할 소켓
+     * @return 보관했으면 true, 가득 차서 호출자가 닫아야 하면 false
+     */
+    Bool Service::ReleaseSocket(SOCKET socket)
+    {
+        SrwLockWriteGuard guard(mSocketLock);
+
+        if (static_cast_64(mReusableSockets.size()) >= mConfig.maxSessionCount)
+        {
+            return false;
+        }
+
+        mReusableSockets.push_back(socket);
+        return true;
+    }
+
+    /**
+     * 재사용 소켓 획득
+     *
+     * @return 보관 중인 소켓, 없으면 INVALID_SOCKET
+     */
+    SOCKET Service::AcquireSocket()
+    {
+        SrwLockWriteGuard guard(mSocketLock);
+
+        if (mReusableSockets.empty())
+        {
+            return INVALID_SOCKET;
+        }
+
+        const SOCKET socket = mReusableSockets.back();
+        mReusableSockets.pop_back();
+        return socket;
+    }
+
+    /**
+     * 재사용 세션 획득
+     *
+     * 풀에 보관한 세션을 새 삭제자와 함께 공유 포인터로 감싸 돌려줍니다.
+     *
+     * @return 초기화된 세션, 풀이 비어 있으면 nullptr
+     */
+    SharedPtr<Session> Service::AcquirePooledSession()
+    {
+        Session* session = nullptr;
+        {
+            SrwLockWriteGuard guard(mSessionPoolLock);
+
+            if (mPooledSessions.empty())
+            {
+                return nullptr;
+            }
+
+            session = mPooledSessions.back();
+            mPooledSessions.pop_back();
+        }
+
+        WeakPtr<Service> service = weak_from_this();
+        return SharedPtr<Session>(session, [service](Session* session)
+                                  {
+                                      DestroySession(service, session);
+                                  });
+    }
+
+    /**
+     * 세션 반환
+     *
+     * 연결 해제를 마친 세션을 초기화해 풀에 보관합니다.
+     * 보관 수는 최대 세션 수로 제한합니다. (동시에 반환되면 잠시 넘을 수 있음)
+     *
+     * @param session 마지막 참조가 사라진 세션 (진행 중인 입출력 없음)
+     * @return 보관했으면 true, 재사용할 수 없거나 가득 차서 호출자가 소멸시켜야 하면 false
+     */
+    Bool Service::RecycleSession(Session* session)
+    {
+        // TF_REUSE_SOCKET 연결 해제를 마치지 않은 소켓은 다시 쓸 수 없음
+        if (!mConfig.poolSessions ||
+            !session->mIsSocketReusable)
+        {
+            return false;
+        }
+
+        {
+            SrwLockReadGuard guard(mSessionPoolLock);
+            if (static_cast_64(mPooledSessions.size()) >= mConfig.maxSessionCount)
+            {
+                return false;
+            }
+        }
+
+        session->Reset();
+
+        SrwLockWriteGuard guard(mSessionPoolLock);
+        mPooledSessions.push_back(session);
+
+        return true;
+    }
+
+    /**
+     * 세션 삭제자
+     *
+     * 세션의 마지막 공유 포인터가 사라질 때 호출됩니다.
+     * 서비스가 살아 있고 세션을 재사용할 수 있으면 풀에 돌려주고, 아니면 소멸시킵니다.
+     * (소멸하는 세션의 소켓은 가능하면 서비스의 재사용 소켓으로 반환됨)
+     *
+     * @param service 세션을 만든 서비스
+     * @param session 반환할 세션
+     */
+    void Service::DestroySession(const WeakPtr<Service>& service, Session* session)
+    {
+        SharedPtr<Service> owner = service.lock();
+        if ((nullptr != owner) &&
+            owner->RecycleSession(session))
+        {
+            return;
+        }
+
+        delete session;
+    }
+
+    /**
+     * 세션 송신 마무리 및 연결 해제
+     *
+     * 모든 세션의 송신 큐가 비거나 기한이 지날 때까지 기다린 뒤 세션 연결을 해제합니다.
+     * 이어서 세션이 모두 제거되고 연결 해제 완료 통지를 모두 받을 때까지 kDisconnectWaitMs 동안 기다리므로,
+     * 반환한 뒤 입출력 워커를 중지해도 OnDisconnected가 누락되지 않습니다.
+     *
+     * @param timeoutMs 송신 마무리를 기다릴 최대 시간(밀리초)
+     * @return 기한이 지나도록 송신을 마치지 못한 세션 수
+     */
+    Int64 Service::DrainSessions(Int64 timeoutMs)
+    {
+        const Int64 deadlineTick = ::GetTickCount64() + timeoutMs;
+
+        // 세션 목록 스냅샷
+        Vector<SharedPtr<Session>> sessions;
+        {
+            READ_GUARD;
+            sessions.reserve(mSessions.size());
+            for (const auto& [sessionId, session] : mSessions)
+            {
+                sessions.push_back(session);
+            }
+        }
+
+        // 송신 중인 세션이 없거나 기한이 지날 때까지 대기
+        Int64 pendingCount = 0;
+        while (true)
+        {
+            pendingCount = std::count_if(sessions.begin(), sessions.end(),
+                                         [](const SharedPtr<Session>& session)
+                                         {
+                                             return session->IsConnected() && !session->IsSendIdle();
+                                         });
+
+            if ((pendingCount == 0) ||
+                (static_cast_64(::GetTickCount64()) >= deadlineTick))
+            {
+                break;
+            }
+
+            ::Sleep(kDrainPollMs);
+        }
+
+        // 모든 세션 연결 해제 후 완료 통지 대기 (대기 중 연결을 마친 세션도 함께 해제)
+        const Int64 disconnectedCount = static_cast_64(sessions.size());
+        const Int64 disconnectDeadlineTick = ::GetTickCount64() + kDisconnectWaitMs;
+        while (true)
+        {
+            for (const SharedPtr<Session>& session : sessions)
+            {
+                session->DisconnectAsync(TEXT_8("Service stopped"));
+            }
+
+            sessions.clear();
+            {
+                READ_GUARD;
+                for (const auto& [sessionId, session] : mSessions)
+                {
+                    sessions.push_back(session);
+                }
+            }
+
+            if ((sessions.empty() && (GetPendingDisconnectCount() == 0)) ||
+                (static_cast_64(::GetTickCount64()) >= disconnectDeadlineTick))
+            {
+                break;
+            }
+
+            ::Sleep(kDrainPollMs);
+        }
+
+        LOG_INFO(Network, TEXT_8("Service: Disconnected {} sessions, {} with unsent data, {} disconnects unfinished"),
+                 disconnectedCount, pendingCount, GetPendingDisconnectCount());
+
+        return pendingCount;
+    }
+
     /**
      * ClientService 생성자
      *
@@ -148,11 +426,24 @@ namespace core
      * 클라이언트 서비스 시작
      *
      * 클라이언트 세션을 생성하고 서버에 연결을 시도합니다.
-     * 서비스 구성에 지정된 최대 세션 수만큼의 연결을 시도합니다.
+     * 서비스 구성에 지정된 최대 세션 수만큼의 연결을 한 번에 시도합니다.
+     * 연결 속도를 조절하려면 Run() 대신 Connect()를 나눠서 호출합니다.
      *
      * @return SUCCESS 성공 시, FAILURE 실패 시
      */
     Int64 ClientService::Run()
+    {
+        return Connect(mConfig.maxSessionCount);
+    }
+
+    /**
+     * 지정된 수의 클라이언트 세션을 생성하고 비동기 연결을 요청합니다.
+     * 서버 리스너가 여러 개(listenerCount)이면 연결마다 포트를 번갈아 고릅니다.
+     *
+     * @param count 생성할 세션 수
+     * @return SUCCESS 성공 시, 세션 생성 실패 시 FAILURE, 연결 요청 실패 시 오류 코드
+     */
+    Int64 ClientService::Connect(Int64 count)
     {
         Int64 result = SUCCESS;
 
@@ -162,16 +453,17 @@ namespace core
             return result;
         }
 
-        for (Int64 i = 0; i < mConfig.maxSessionCount; ++i)
+        for (Int64 i = 0; i < count; ++i)
         {
             // 세션 생성
             SharedPtr<Session> session = CreateSession();
-            session->SetNetAddress(mConfig.address);
             if (nullptr == session)
             {
                 result = FAILURE;
                 break;
             }
+            const Int64 portOffset = mConnectCount.fetch_add(1) % std::max<Int64>(mConfig.listenerCount, 1);
+            session->SetNetAddress(OffsetPort(mConfig.address, portOffset));
 
             // 비동기 연결 요청
             result = session->ConnectAsync();
@@ -187,11 +479,12 @@ namespace core
     /**
      * 클라이언트 서비스 중지
      *
-     * 클라이언트 서비스를 중지하고 모든 연결을 종료합니다.
-     * 현재 구현은 비어 있습니다 (향후 구현 예정).
+     * 대기 중인 송신을 기한(drainTimeoutMs) 내에 마무리한 뒤 모든 연결을 종료합니다.
      */
     void ClientService::Stop()
-    {}
+    {
+        DrainSessions(mConfig.drainTimeoutMs);
+    }
 
     /**
      * ServerService 생성자
@@ -209,7 +502,11 @@ namespace core
      *
      * 리스너를 생성하고 클라이언트 연결 수락을 시작합니다.
      *
-     * @return SUCCESS 성공 시, FAILURE 실패 시
+     * Windows에는 리슨 소켓 사이에 연결을 나눠 주는 SO_REUSEPORT가 없으므로
+     * 리스너 i는 address 포트 + i에 바인딩하고, 클라이언트가 포트를 골라 연결을 분산합니다.
+     * 리스너마다 acceptDispatchers 중 하나에 등록해 수락 완료를 서로 다른 입출력 워커가 처리합니다.
+     *
+     * @return SUCCESS 성공 시, FAILURE 또는 오류 코드 실패 시
      */
     Int64 ServerService::Run()
     {
@@ -221,16 +518,21 @@ namespace core
             return result;
         }
 
-        // 리스너 생성
-        if (nullptr == (mListener = std::make_shared<Listener>()))
+        SharedPtr<ServerService> self = std::static_pointer_cast<ServerService>(shared_from_this());
+        const Int64 listenerCount = std::max<Int64>(mConfig.listenerCount, 1);
+        for (Int64 i = 0; i < listenerCount; ++i)
         {
-            result = FAILURE;
-            return result;
-        }
+            SharedPtr<IoEventDispatcher> dispatcher = mConfig.acceptDispatchers.empty() ?
+                mConfig.ioEventDispatcher : mConfig.acceptDispatchers[i % mConfig.acceptDispatchers.size()];
 
-        // 리스너 accept 시작
-        SharedPtr<ServerService> self = std::static_pointer_cast<ServerService>(shared_from_this());
-        result = mListener->StartAccept(std::move(self));
+            // 리스너 생성 및 accept 시작
+            SharedPtr<Listener> listener = std::make_shared<Listener>();
+            mListeners.push_back(listener);
+            if (result = listener->StartAccept(self, OffsetPort(mConfig.address, i), std::move(dispatcher)))
+            {
+                return result;
+            }
+        }
 
         return result;
     }
@@ -238,11 +540,27 @@ namespace core
     /**
      * 서버 서비스 중지
      *
-     * 서버 서비스를 중지하고 모든 연결을 종료합니다.
-     * 현재 구현은 비어 있습니다 (향후 구현 예정).
+     * 새 연결 수락을 중지하고, 대기 중인 송신을 기한(drainTimeoutMs) 내에 마무리한 뒤
+     * 모든 연결을 종료합니다.
      */
     void ServerService::Stop()
     {
-        // TODO
+        StopAccept();
+        DrainSessions(mConfig.drainTimeoutMs);
+    }
+
+    /**
+     * 연결 수락 중지
+     *
+     * 모든 리스너를 중지해 대기 중인 accept를 취소합니다.
+     * 리스너는 취소된 accept의 완료 통지가 모두 처리되면 해제됩니다.
+     */
+    void ServerService::StopAccept()
+    {
+        for (const SharedPtr<Listener>& listener : mListeners)
+        {
+            listener->Stop();
+        }
+        mListeners.clear();
     }
 } // namespace core
@@ -16,7 +16,17 @@ namespace core
         Client,
     };
 
-    using SessionFactory = Function<SharedPtr<Session>(void)>;
+    // 세션 객체를 생성하는 함수 (소유권은 서비스가 가져가며, 연결 해제 후 초기화해서 재사용)
+    using SessionFactory = Function<Session*(void)>;
+
+    template<typename T>
+    SessionFactory MakeSessionFactory()
+    {
+        return []() -> Session*
+            {
+                return new T();
+            };
+    }
 
     /**
      * Service - 네트워크 서비스의 기본 추상 클래스
@@ -29,6 +39,9 @@ namespace core
      * - 세션 ID 자동 할당 및 관리
      * - 스레드 안전한 세션 컬렉션 관리
      * - IO 이벤트 디스패처 연동
+     * - 연결 해제를 마친 세션을 소멸시키지 않고 초기화해 보관했다가 새 연결에 재사용 (소켓/버퍼 유지)
+     * - TF_REUSE_SOCKET으로 연결을 해제한 소켓을 보관했다가 새 세션에 재사용
+     * - 종료 시 대기 중인 송신을 기한 내에 마무리한 뒤 모든 세션 연결 해제
      *
      * 파생 클래스:
      * - ServerService: 서버 측 연결 수신 서비스
@@ -38,12 +51,30 @@ namespace core
         : public std::enable_shared_from_this<Service>
     {
     public:
+        /*
+         * 연결 수락 설정 (서버)
+         *
+         * - minPendingAccepts/maxPendingAccepts: 리스너마다 미리 걸어 두는 AcceptEx 수의 범위
+         *   (접속 도착률에 맞춰 이 범위 안에서 늘리고 줄임)
+         * - listenerCount: 리슨 소켓 수, address의 포트부터 연속된 포트를 사용
+         *   (클라이언트는 같은 수의 포트에 연결을 나눠서 요청)
+         * - acceptDispatchers: 리슨 소켓을 등록할 디스패처 목록 (비어 있으면 ioEventDispatcher)
+         *   리스너 i는 acceptDispatchers[i % 크기]를 사용하므로 디스패처마다 전용 입출력 워커를 두면
+         *   접속 폭주가 세션 송수신 워커와 경쟁하지 않음
+         * - poolSessions: 연결 해제를 마친 세션을 최대 세션 수까지 보관해 재사용 (false면 매번 생성/소멸)
+         */
         struct Config
         {
             NetAddress                      address;
             SharedPtr<IoEventDispatcher>    ioEventDispatcher;
             SessionFactory                  sessionFactory;
             Int64                           maxSessionCount = 1;
+            Int64                           drainTimeoutMs = 3000;
+            Int64                           minPendingAccepts = 16;
+            Int64                           maxPendingAccepts = 256;
+            Int64                           listenerCount = 1;
+            Vector<SharedPtr<IoEventDispatcher>>    acceptDispatchers;
+            Bool                            poolSessions = true;
         };
 
     public:
@@ -57,15 +88,32 @@ namespace core
         Int64                           AddSession(SharedPtr<Session> session);
         Int64                           RemoveSession(SharedPtr<Session> session);
         SharedPtr<Session>              FindSession(Int64 sessionId);
+        Bool                            ReleaseSocket(SOCKET socket);
 
         Bool                            CanRun() const { return mConfig.sessionFactory != nullptr; }
         void                            SetSessionFactory(SessionFactory factory) { mConfig.sessionFactory = std::move(factory); }
         Int64                           GetCurrentSessionCount() const { return mSessionCount; }
+        Int64                           GetPendingDisconnectCount() const { return mPendingDisconnectCount.load(); }
+        void                            AddPendingDisconnect() { mPendingDisconnectCount.fetch_add(1); }
+        void                            RemovePendingDisconnect() { mPendingDisconnectCount.fetch_sub(1); }
         Int64                           GetMaxSessionCount() const { return mConfig.maxSessionCount; }
+        const Config&                   GetConfig() const { return mConfig; }
         ServiceType                     GetType() const { return mType; }
         const NetAddress&               GetAddress() const { return mConfig.address; }
         SharedPtr<IoEventDispatcher>    GetIoEventDispatcher() const { return mConfig.ioEventDispatcher; }
 
+    protected:
+        Int64                           DrainSessions(Int64 timeoutMs);
+        SOCKET                          AcquireSocket();
+        SharedPtr<Session>              AcquirePooledSession();
+        Bool                            RecycleSession(Session* session);
+
+        static void                     DestroySession(const WeakPtr<Service>& service, Session* session);
+
+    protected:
+        static constexpr Int64          kDrainPollMs = 10;
+        static constexpr Int64          kDisconnectWaitMs = 1'000;
+
     protected:
         ServiceType     mType;
         Config          mConfig;
@@ -73,6 +121,15 @@ namespace core
         RW_LOCK;
         HashMap<Int64, SharedPtr<Session>>      mSessions;
         Int64                                   mSessionCount = 0;
+        Atomic<Int64>                           mPendingDisconnectCount = 0;    // 완료 통지를 받지 못한 연결 해제 요청 수
+
+        // 재사용 대기 소켓 (이미 디스패처에 등록되어 있음)
+        SRWLOCK                                 mSocketLock = SRWLOCK_INIT;
+        Vector<SOCKET>                          mReusableSockets;
+
+        // 재사용 대기 세션 (초기화를 마쳤고 소켓은 디스패처에 등록된 상태)
+        SRWLOCK                                 mSessionPoolLock = SRWLOCK_INIT;
+        Vector<Session*>                        mPooledSessions;
     };
 
     /**
@@ -89,6 +146,7 @@ namespace core
      * 사용 예시:
      * ClientService::Config config;
      * config.address = NetAddress(TEXT_16("127.0.0.1"), 8000);
+     * config.sessionFactory = MakeSessionFactory<MySession>();
      * config.maxSessionCount = 100;
      * auto service = std::make_shared<ClientService>(config);
      * service->Run();
@@ -101,6 +159,11 @@ namespace core
 
         virtual Int64       Run() override;
         virtual void        Stop() override;
+
+        Int64               Connect(Int64 count);
+
+    private:
+        Atomic<Int64>       mConnectCount = 0; // 서버 포트를 번갈아 고르는 데 사용
     };
 
     /**
@@ -110,13 +173,14 @@ namespace core
      * Listener를 통해 클라이언트 연결을 수락하고 세션을 생성합니다.
      *
      * 주요 기능:
-     * - 클라이언트 연결 수신을 위한 Listener 관리
+     * - 클라이언트 연결 수신을 위한 Listener 관리 (listenerCount개, 포트마다 하나)
      * - 접속한 클라이언트 세션 생성 및 관리
      * - 세션 수명 주기 관리
      *
      * 사용 예시:
      * ServerService::Config config;
      * config.address = NetAddress(TEXT_16("127.0.0.1"), 8000);
+     * config.sessionFactory = MakeSessionFactory<MySession>();
      * config.maxSessionCount = 1000;
      * auto service = std::make_shared<ServerService>(config);
      * service->Run();
@@ -129,8 +193,9 @@ namespace core
 
         virtual Int64       Run() override;
         virtual void        Stop() override;
+        void                StopAccept();
 
     protected:
-        SharedPtr<Listener>     mListener;
+        Vector<SharedPtr<Listener>>     mListeners;
     };
 } // namespace core
@@ -4,30 +4,60 @@
 #include "Core/Network/Session.h"
 #include "Core/Network/Socket.h"
 #include "Core/Network/Service.h"
+#include "Core/Network/Batch.h"
+#include "Core/Metric/Metric.h"
 
 namespace core
 {
+    namespace
+    {
+        // 세션 입출력 메트릭 (처음 사용할 때 등록)
+        struct SessionMetrics
+        {
+            Counter&    receivedBytes = gMetricRegistry->AddCounter(TEXT_8("net_session_received_bytes_total"), TEXT_8("Bytes received by sessions"));
+            Counter&    sentBytes = gMetricRegistry->AddCounter(TEXT_8("net_session_sent_bytes_total"), TEXT_8("Bytes sent by sessions"));
+            Counter&    sentPackets = gMetricRegistry->AddCounter(TEXT_8("net_session_sent_packets_total"), TEXT_8("Send buffers queued to sessions"));
+            Counter&    sendCalls = gMetricRegistry->AddCounter(TEXT_8("net_session_send_calls_total"), TEXT_8("WSASend calls issued by sessions"));
+        };
+
+        SessionMetrics& GetMetrics()
+        {
+            static SessionMetrics sMetrics;
+            return sMetrics;
+        }
+    } // namespace
+
     /**
      * Session 생성자
      *
-     * 새로운 세션 객체를 초기화하고 소켓을 생성합니다.
+     * 새로운 세션 객체를 초기화합니다.
      * 수신 버퍼를 kReceiveBufferSize 크기로 초기화합니다.
-     * 소켓 생성 실패 시 크래시가 발생합니다.
+     * 소켓은 Service::CreateSession에서 재사용 소켓을 받거나 새로 생성해 할당합니다.
      */
     Session::Session()
         : mReceiveBuffer(kReceiveBufferSize)
-    {
-        ASSERT_CRASH(SUCCESS == SocketUtils::CreateSocket(mSocket), "CREATE_SOCKET_FAILED");
-    }
+    {}
 
     /**
      * Session 소멸자
      *
-     * 세션 리소스를 정리하고 소켓을 안전하게 닫습니다.
-     * 소켓이 정상적으로 닫히지 않으면 크래시가 발생합니다.
+     * 세션 리소스를 정리합니다.
+     * TF_REUSE_SOCKET 연결 해제를 마친 소켓은 서비스에 돌려주어 다음 세션이 재사용하고,
+     * 그 외에는 소켓을 닫습니다. 소켓이 정상적으로 닫히지 않으면 크래시가 발생합니다.
      */
     Session::~Session()
     {
+        if (mIsSocketReusable)
+        {
+            SharedPtr<Service> service = GetService();
+            if ((nullptr != service) &&
+                service->ReleaseSocket(mSocket))
+            {
+                mSocket = INVALID_SOCKET;
+                return;
+            }
+        }
+
         ASSERT_CRASH(SUCCESS == SocketUtils::CloseSocket(mSocket), "CLOSE_SOCKET_FAILED");
     }
 
@@ -65,6 +95,8 @@ namespace core
             return;
         }
 
+        LOG_DEBUG(Network, TEXT_8("Session[{}]: Disconnecting: {}"), mId, cause);
+
         // 서비스에서 세션 제거
         Int64 result = GetService()->RemoveSession(GetSession());
         if (SUCCESS != result)
@@ -82,21 +114,22 @@ namespace core
      * 제공된 버퍼의 데이터를 비동기적으로 전송합니다.
      * 동시에 여러 스레드가 SendAsync를 호출할 수 있으며,
      * 한 번에 하나의 송신 작업만 진행하도록 보장합니다.
+     * 송신 묶음 범위 안이면 송신 등록을 범위가 끝날 때로 미룹니다.
      *
      * @param buffer 전송할 데이터가 포함된 SendBuffer
      */
     void Session::SendAsync(SharedPtr<SendBuffer> buffer)
     {
-        Bool isSending = false;
-        // 송신 버퍼 매니저에 버퍼 등록
+        GetMetrics().sentPackets.Add();
+
+        // 송신 큐에 버퍼 추가, 이미 송신 작업 중인 경우 송신 중인 스레드가 처리
+        if (!mSendQueue.Push(std::move(buffer)))
         {
-            WRITE_GUARD;
-            mSendBufferMgr.Register(std::move(buffer));
-            isSending = mIsSending.exchange(true);
+            return;
         }
 
-        // 이미 송신 작업 중인 경우
-        if (isSending)
+        // 송신 묶음이 끝날 때 이후에 추가된 버퍼와 함께 송신
+        if (SendBatch::TryDefer(GetSession()))
         {
             return;
         }
@@ -105,6 +138,71 @@ namespace core
         RegisterSend();
     }
 
+    /**
+     * 여러 프레임으로 나뉜 메시지 하나를 송신합니다.
+     *
+     * 프레임 사이에 다른 스레드가 송신한 버퍼가 끼지 않도록 한 번에 송신 큐에 추가합니다.
+     *
+     * @param buffers 순서대로 송신할 프레임 버퍼 목록
+     */
+    void Session::SendAsync(const Vector<SharedPtr<SendBuffer>>& buffers)
+    {
+        if (buffers.empty())
+        {
+            return;
+        }
+
+        GetMetrics().sentPackets.Add();
+
+        if (!mSendQueue.Push(buffers))
+        {
+            return;
+        }
+
+        if (SendBatch::TryDefer(GetSession()))
+        {
+            return;
+        }
+
+        RegisterSend();
+    }
+
+    Int64 Session::GetTotalSentBytes()
+    {
+        return GetMetrics().sentBytes.GetValue();
+    }
+
+    /**
+     * 송신 후 완료 통지
+     *
+     * 버퍼를 송신하고, 이 버퍼를 담은 송신이 완료되면 콜백을 호출합니다.
+     * 뒤에 추가된 버퍼의 송신을 기다리지 않으므로 송신 큐가 계속 차 있어도 통지가 늦어지지 않습니다.
+     *
+     * @param buffer 전송할 데이터가 포함된 SendBuffer
+     * @param callback 송신 성공 여부를 인자로 받는 콜백 (연결이 끊겨 버려지면 false)
+     *
+     * 동작:
+     * 1. 송신 큐에 추가하기 전에 버퍼와 콜백을 대기 목록에 추가 (송신 완료가 먼저 처리되어 통지를 놓치지 않음)
+     * 2. 버퍼를 송신 큐에 추가
+     * 3. 연결이 끊겼으면 버려진 버퍼이므로 실패로 통지
+     * 4. 그 외에는 송신 완료를 처리하는 스레드가 완료된 버퍼의 대기자만 골라 통지
+     */
+    void Session::SendAndNotify(SharedPtr<SendBuffer> buffer, Function<void(Bool)> callback)
+    {
+        {
+            SrwLockWriteGuard guard(mSendWaiterLock);
+            mSendWaiters.push_back(SendWaiter{buffer.get(), std::move(callback)});
+            mSendWaiterCount.fetch_add(1);
+        }
+
+        SendAsync(std::move(buffer));
+
+        if (!IsConnected())
+        {
+            NotifySendWaiters(false);
+        }
+    }
+
     /**
      * IO 객체 핸들 반환
      *
@@ -177,9 +275,10 @@ namespace core
             return result;
         }
 
-        // 주소 임의 설정
+        // 주소 임의 설정 (재사용 소켓은 이미 바인딩되어 있을 수 있음)
         result = SocketUtils::BindAnyAddress(mSocket, 0);
-        if (result != SUCCESS)
+        if ((result != SUCCESS) &&
+            (result != WSAEINVAL))
         {
             return result;
         }
@@ -218,11 +317,22 @@ namespace core
         mDisconnectEvent.owner = GetSession();
         mDisconnectEvent.cause = std::move(cause);
 
+        // 서비스 중지 시 완료 통지를 기다릴 수 있도록 요청 수 기록
+        SharedPtr<Service> service = GetService();
+        if (service != nullptr)
+        {
+            service->AddPendingDisconnect();
+        }
+
         // 비동기 연결 해제 요청
         Int64 result = SocketUtils::DisconnectAsync(mSocket, TF_REUSE_SOCKET, &mDisconnectEvent);
         if ((result != SUCCESS) &&
             (result != WSA_IO_PENDING))
         {
+            if (service != nullptr)
+            {
+                service->RemovePendingDisconnect();
+            }
             HandleError(result);
             mDisconnectEvent.owner.reset();
         }
@@ -274,20 +384,20 @@ namespace core
      */
     void Session::RegisterSend()
     {
-        // 연결 상태 확인
+        // 연결되지 않았으면 대기 중인 버퍼를 버리고 송신 상태를 해제
         if (!IsConnected())
         {
+            mSendQueue.Discard();
+            NotifySendWaiters(false);
             return;
         }
 
         Int64 numBytes = 0;
         mSendEvent.Init();
         mSendEvent.owner = GetSession();
-        // 송신 이벤트의 버퍼 매니저와 세션의 버퍼 매니저를 교체
-        {
-            WRITE_GUARD;
-            mSendEvent.bufferMgr.Swap(mSendBufferMgr);
-        }
+        // 송신 큐에 대기 중인 버퍼를 모두 송신 이벤트의 버퍼 매니저로 이동
+        mSendQueue.PopAll(mSendEvent.bufferMgr);
+        GetMetrics().sendCalls.Add();
 
         // 비동기 송신 요청
         Int64 result = SocketUtils::SendAsync(mSocket, mSendEvent.bufferMgr.GetWsaBuffers(), mSendEvent.bufferMgr.GetWsaBufferCount(), OUT & numBytes, &mSendEvent);
@@ -296,8 +406,9 @@ namespace core
         {
             HandleError(result);
             mSendEvent.owner.reset();
-            mSendBufferMgr.Clear();
-            mIsSending.store(false);
+            mSendEvent.bufferMgr.Clear();
+            mSendQueue.Discard();
+            NotifySendWaiters(false);
         }
     }
 
@@ -314,6 +425,7 @@ namespace core
         // 에러가 발생한 경우
         if (mConnectEvent.result != SUCCESS)
         {
+            OnConnectFailed(mConnectEvent.result);
             HandleError(mConnectEvent.result);
             return;
         }
@@ -343,16 +455,27 @@ namespace core
     void Session::ProcessDisconnect()
     {
         mDisconnectEvent.owner.reset();
+        SharedPtr<Service> service = GetService();
 
         // 에러가 발생한 경우
         if (mDisconnectEvent.result != SUCCESS)
         {
             HandleError(mDisconnectEvent.result);
-            return;
+        }
+        else
+        {
+            // TF_REUSE_SOCKET 연결 해제가 끝났으므로 소멸 시 소켓을 재사용할 수 있음
+            mIsSocketReusable = true;
+
+            // 콘텐츠 코드에서 연결 해제 처리
+            OnDisconnected(std::move(mDisconnectEvent.cause));
         }
 
-        // 콘텐츠 코드에서 연결 해제 처리
-        OnDisconnected(std::move(mDisconnectEvent.cause));
+        // 연결 해제 처리를 마친 뒤 완료 기록 (서비스 중지는 이 시점까지 대기)
+        if (service != nullptr)
+        {
+            service->RemovePendingDisconnect();
+        }
     }
 
     /**
@@ -388,8 +511,21 @@ namespace core
             return;
         }
 
-        // 콘텐츠 코드에서 수신 처리
-        Int64 processedSize = OnReceived(mReceiveBuffer.AtReadPos(), numBytes);
+        GetMetrics().receivedBytes.Add(numBytes);
+
+        // 콘텐츠 코드에서 수신 처리 (이전 수신에서 남은 일부 패킷까지 포함)
+        // 수신 하나를 처리하면서 보낸 응답은 세션마다 묶어서 송신
+        Int64 processedSize = 0;
+        {
+            SendBatchScope batch;
+            processedSize = OnReceived(mReceiveBuffer.AtReadPos(), mReceiveBuffer.GetDataSize());
+        }
+        if (processedSize < 0)
+        {
+            DisconnectAsync(TEXT_8("Invalid packet"));
+            return;
+        }
+
         if (mReceiveBuffer.OnRead(processedSize) == false)
         {
             DisconnectAsync(TEXT_8("Receive buffer error"));
@@ -413,33 +549,125 @@ namespace core
     void Session::ProcessSend(Int64 numBytes)
     {
         mSendEvent.owner.reset();
-        mSendEvent.bufferMgr.Clear();
 
         // 에러가 발생한 경우
         if (mSendEvent.result != SUCCESS)
         {
             HandleError(mSendEvent.result);
+            mSendEvent.bufferMgr.Clear();
+            mSendQueue.Discard();
+            NotifySendWaiters(false);
             return;
         }
 
+        GetMetrics().sentBytes.Add(numBytes);
+
+        // 이번 송신에 담긴 버퍼를 기다리던 대기자만 통지
+        NotifySendWaiters(mSendEvent.bufferMgr);
+        mSendEvent.bufferMgr.Clear();
+
         // 콘텐츠 코드에서 송신 처리
         OnSent(numBytes);
 
+        // 대기 중인 송신 버퍼가 없으면 송신 상태를 해제
+        if (mSendQueue.TryFinish())
         {
-            WRITE_GUARD;
-
-            // 등록된 송신 버퍼가 없으면 송신 상태를 해제
-            if (mSendBufferMgr.IsEmpty())
-            {
-                mIsSending.store(false);
-                return;
-            }
+            return;
         }
 
         // 송신 버퍼가 있으면 다시 송신 등록
         RegisterSend();
     }
 
+    /**
+     * 송신 완료 대기자 통지 (버려진 송신)
+     *
+     * 대기 목록을 통째로 가져온 뒤 락을 해제하고 콜백을 호출합니다.
+     * 송신 큐를 버린 뒤 호출하므로 모든 대기자의 버퍼가 버려진 상태입니다.
+     * 대기자가 없으면 락 없이 반환하므로 일반 송신 경로의 비용은 원자적 읽기 1회입니다.
+     *
+     * @param sent 송신 성공 여부
+     */
+    void Session::NotifySendWaiters(Bool sent)
+    {
+        if (mSendWaiterCount.load() == 0)
+        {
+            return;
+        }
+
+        Vector<SendWaiter> waiters;
+        {
+            SrwLockWriteGuard guard(mSendWaiterLock);
+            waiters.swap(mSendWaiters);
+            mSendWaiterCount.store(0);
+        }
+
+        for (auto& waiter : waiters)
+        {
+            waiter.callback(sent);
+        }
+    }
+
+    /**
+     * 송신 완료 대기자 통지 (완료된 송신)
+     *
+     * 송신 완료된 버퍼 목록에 자신의 버퍼가 있는 대기자만 목록에서 꺼내 성공으로 통지합니다.
+     * 대기자가 없으면 락 없이 반환합니다.
+     *
+     * @param sentBufferMgr 송신 완료된 버퍼 목록
+     */
+    void Session::NotifySendWaiters(const SendBufferManager& sentBufferMgr)
+    {
+        if (mSendWaiterCount.load() == 0)
+        {
+            return;
+        }
+
+        Vector<SendWaiter> completed;
+        {
+            SrwLockWriteGuard guard(mSendWaiterLock);
+            // 아직 송신되지 않은 대기자를 앞쪽에 남김
+            auto it = std::stable_partition(mSendWaiters.begin(), mSendWaiters.end(),
+                                            [&sentBufferMgr](const SendWaiter& waiter) { return !sentBufferMgr.Contains(waiter.buffer); });
+            completed.assign(std::make_move_iterator(it), std::make_move_iterator(mSendWaiters.end()));
+            mSendWaiters.erase(it, mSendWaiters.end());
+            mSendWaiterCount.store(static_cast_64(mSendWaiters.size()));
+        }
+
+        for (auto& waiter : completed)
+        {
+            waiter.callback(true);
+        }
+    }
+
+    /**
+     * 재사용을 위한 세션 초기화
+     *
+     * 연결 해제를 마친 세션을 다음 연결에 다시 쓸 수 있도록 연결별 상태를 초기화합니다.
+     * 마지막 참조가 사라져 진행 중인 입출력이 없을 때 서비스가 호출합니다.
+     * 소켓(디스패처 등록 유지)과 수신 버퍼 메모리는 그대로 두고 다음 연결에서 재사용합니다.
+     */
+    void Session::Reset()
+    {
+        mService.reset();
+        mAddress = NetAddress();
+        mId = 0;
+        mIsConnected.store(false);
+        mIsCompressionEnabled.store(false);
+
+        mSendQueue.Discard();
+        NotifySendWaiters(false);
+        mSendEvent.bufferMgr.Clear();
+
+        mReceiveBuffer.Reset();
+
+        mDisconnectEvent.cause.clear();
+        mIsSocketReusable = false;
+
+        // 콘텐츠 코드의 연결별 상태 초기화
+        OnReset();
+    }
+
     /**
      * 오류 처리
      *
@@ -475,4 +703,19 @@ namespace core
             break;
         }
     }
+
+    /**
+     * 송신을 요청하고 완료 대기를 등록합니다.
+     * 등록 직후 다른 스레드에서 재개되어 대기 객체가 해제될 수 있으므로 세션을 지역 변수로 유지합니다.
+     */
+    void SendAwaiter::await_suspend(Task::Handle handle)
+    {
+        SharedPtr<Session> target = session;
+        target->SendAndNotify(std::move(buffer), [this, handle](Bool result)
+                              {
+                                  // 재개를 예약한 이후에는 대기 객체에 접근하지 않음
+                                  sent = result;
+                                  handle.promise().Resume();
+                              });
+    }
 } // namespace core
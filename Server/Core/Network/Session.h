@@ -11,6 +11,25 @@ namespace core
     class Listener;
     class IoEventDispatcher;
     class Service;
+    class Session;
+
+    /*
+     * 송신 완료 대기 객체
+     *
+     * 버퍼를 송신 큐에 추가한 뒤, 이 버퍼를 담은 송신이 완료되면
+     * 코루틴을 현재 직렬화 객체의 JobQueue에서 재개합니다. 뒤에 추가된 버퍼의 송신은 기다리지 않습니다.
+     * co_await 결과는 송신 성공 여부이며, 연결이 끊겨 버려진 경우 false입니다.
+     */
+    struct SendAwaiter
+    {
+        SharedPtr<Session>      session;
+        SharedPtr<SendBuffer>   buffer;
+        Bool                    sent = false;
+
+        Bool    await_ready() const noexcept { return false; }
+        void    await_suspend(Task::Handle handle);
+        Bool    await_resume() const noexcept { return sent; }
+    };
 
     /**
      * Session - 네트워크 연결 세션 관리 추상 클래스
@@ -30,6 +49,9 @@ namespace core
      * - 상속을 통해 OnConnected, OnDisconnected, OnReceived, OnSent 메서드 구현
      * - 서비스 객체에서 세션 생성 및 관리
      * - 비동기 메서드 호출(ConnectAsync, DisconnectAsync, SendAsync)로 작업 수행
+     * - SendBatchScope 안에서 호출한 SendAsync는 범위가 끝날 때 세션마다 한 번에 송신
+     * - 코루틴에서는 co_await SendAndWait(buffer)로 송신 완료까지 대기
+     * - 연결 해제 후 서비스가 세션을 재사용하므로, 연결마다 초기화할 멤버는 OnReset에서 초기화
      */
     class Session
         : public IIoObjectOwner
@@ -38,6 +60,7 @@ namespace core
         friend class Listener;
         friend class IoEventDispatcher;
         friend class Service;
+        friend class SendBatch;
 
     public:
         Session();
@@ -47,6 +70,9 @@ namespace core
         Int64               ConnectAsync();
         void                DisconnectAsync(String8 cause);
         void                SendAsync(SharedPtr<SendBuffer> buffer);
+        void                SendAsync(const Vector<SharedPtr<SendBuffer>>& buffers);
+        SendAwaiter         SendAndWait(SharedPtr<SendBuffer> buffer) { return SendAwaiter{GetSession(), std::move(buffer)}; }
+        void                SendAndNotify(SharedPtr<SendBuffer> buffer, Function<void(Bool)> callback);
 
         SharedPtr<Service>  GetService() const { return mService.lock(); }
         void                SetService(SharedPtr<Service> service) { mService = std::move(service); }
@@ -56,13 +82,25 @@ namespace core
         Int64               GetId() const { return mId; }
         void                SetId(Int64 id) { mId = id; }
         Bool                IsConnected() const { return mIsConnected; }
+        Bool                IsSendIdle() const { return mSendQueue.IsIdle(); }
+        // 압축 협상(Hello)을 마친 세션에만 압축된 메시지를 보냄
+        Bool                IsCompressionEnabled() const { return mIsCompressionEnabled.load(std::memory_order_relaxed); }
+        void                SetCompressionEnabled(Bool enabled) { mIsCompressionEnabled.store(enabled, std::memory_order_relaxed); }
         SharedPtr<Session>  GetSession() { return std::static_pointer_cast<Session>(shared_from_this()); }
 
+        // 모든 세션이 송신 완료한 바이트 수 (net_session_sent_bytes_total)
+        static Int64        GetTotalSentBytes();
+
     protected:  // 세션 구현 인터페이스
         virtual void        OnConnected() = 0;
         virtual void        OnDisconnected(String8 cause) = 0;
+        // 처리한 바이트 수를 반환, 잘못된 데이터를 받았으면 음수를 반환해 연결을 끊음
         virtual Int64       OnReceived(const Byte* buffer, Int64 numBytes) = 0;
         virtual void        OnSent(Int64 numBytes) = 0;
+        // 비동기 연결 요청이 실패한 경우 (클라이언트 세션)
+        virtual void        OnConnectFailed(Int64 errorCode) {}
+        // 연결 해제를 마친 세션을 다음 연결에 재사용하기 전 (파생 클래스의 연결별 상태 초기화)
+        virtual void        OnReset() {}
 
     private:    // IIoObjectOwner 인터페이스 구현
         virtual HANDLE      GetIoObject() override;
@@ -80,27 +118,56 @@ namespace core
         void                ProcessSend(Int64 numBytes);
 
         void                HandleError(Int64 errorCode);
+        void                NotifySendWaiters(Bool sent);
+        void                NotifySendWaiters(const SendBufferManager& sentBufferMgr);
+        void                Reset();
+
+    private:
+        // 송신 완료를 기다리는 버퍼와 콜백 (버퍼는 식별에만 사용)
+        struct SendWaiter
+        {
+            const SendBuffer*       buffer = nullptr;
+            Function<void(Bool)>    callback;
+        };
 
     private:
         static constexpr Int64      kReceiveBufferSize = 4096;
 
     private:
-        RW_LOCK;
+        /*
+         * 캐시 라인 배치
+         *
+         * - 식별 정보: 생성/연결 시에만 쓰고 이후에는 읽기만 하는 필드
+         * - 송신 생산자: SendAsync를 호출하는 잡/게임 루프 스레드가 쓰는 필드
+         * - 송신 완료: 송신 중인 한 스레드(입출력 워커)만 쓰는 필드
+         * - 수신: 수신 완료를 처리하는 입출력 워커만 쓰는 필드
+         * - 연결/해제 이벤트: 세션 수명 동안 한 번씩만 쓰는 필드
+         */
+
+        // 식별 정보
         WeakPtr<Service>    mService;
         SOCKET              mSocket = INVALID_SOCKET;
         NetAddress          mAddress;
         Int64               mId = 0;
         Atomic<Bool>        mIsConnected = false;
-        Atomic<Bool>        mIsSending = false;
+        Atomic<Bool>        mIsCompressionEnabled = false;
 
-    private:
-        ConnectEvent        mConnectEvent;
-        DisconnectEvent     mDisconnectEvent;
-        ReceiveEvent        mReceiveEvent;
-        SendEvent           mSendEvent;
+        // 송신 생산자
+        alignas(64) SendQueue   mSendQueue;
+        Atomic<Int64>                   mSendWaiterCount = 0;
+        SRWLOCK                         mSendWaiterLock = SRWLOCK_INIT;
+        Vector<SendWaiter>              mSendWaiters;
 
-    private:
-        ReceiveBuffer       mReceiveBuffer;
-        SendBufferManager   mSendBufferMgr;
+        // 송신 완료
+        alignas(64) SendEvent   mSendEvent;
+
+        // 수신
+        alignas(64) ReceiveEvent    mReceiveEvent;
+        ReceiveBuffer               mReceiveBuffer;
+
+        // 연결/해제 이벤트
+        alignas(64) ConnectEvent    mConnectEvent;
+        DisconnectEvent             mDisconnectEvent;
+        Bool                        mIsSocketReusable = false; // 연결 해제 완료 후 소멸 시 소켓을 서비스에 반환
     };
 } // namespace core
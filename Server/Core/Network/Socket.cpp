@@ -25,6 +25,7 @@ namespace core
         ASSERT_CRASH(SUCCESS == BindWindowsFunction(dummySocket, WSAID_CONNECTEX, OUT reinterpret_cast<LPVOID*>(&sConnectEx)), "CONNECTEX_BIND_FAILED");
         ASSERT_CRASH(SUCCESS == BindWindowsFunction(dummySocket, WSAID_DISCONNECTEX, OUT reinterpret_cast<LPVOID*>(&sDisconnectEx)), "DISCONNECTEX_BIND_FAILED");
         ASSERT_CRASH(SUCCESS == BindWindowsFunction(dummySocket, WSAID_ACCEPTEX, OUT reinterpret_cast<LPVOID*>(&sAcceptEx)), "ACCEPTEX_BIND_FAILED");
+        ASSERT_CRASH(SUCCESS == BindWindowsFunction(dummySocket, WSAID_GETACCEPTEXSOCKADDRS, OUT reinterpret_cast<LPVOID*>(&sGetAcceptExSockaddrs)), "GETACCEPTEXSOCKADDRS_BIND_FAILED");
         CloseSocket(OUT dummySocket);
     }
 
@@ -116,6 +117,21 @@ namespace core
         return SetSocketOpt(socket, SOL_SOCKET, SO_REUSEADDR, enable);
     }
 
+    /**
+     * 주소 독점 옵션 설정
+     *
+     * SO_EXCLUSIVEADDRUSE 옵션을 설정하여 다른 소켓이 같은 주소에 바인딩하지 못하게 합니다.
+     * 다른 프로세스가 SO_REUSEADDR로 포트를 가로채는 것을 막으며, 바인딩 전에 설정해야 합니다.
+     *
+     * @param socket 설정할 소켓
+     * @param enable true: 주소 독점 활성화, false: 비활성화
+     * @return SUCCESS 성공 시, 오류 코드 실패 시
+     */
+    Int64 SocketUtils::SetExclusiveAddressUse(SOCKET socket, Bool enable)
+    {
+        return SetSocketOpt(socket, SOL_SOCKET, SO_EXCLUSIVEADDRUSE, enable);
+    }
+
     /**
      * Nagle 알고리즘 비활성화 옵션 설정
      *
@@ -324,7 +340,7 @@ namespace core
      */
     Int64 SocketUtils::AcceptAsync(SOCKET listenSocket, SOCKET acceptSocket, Byte* buffer, Int64* numBytes, AcceptEvent* event)
     {
-        if (FALSE == sAcceptEx(listenSocket, acceptSocket, buffer, 0, sizeof(SOCKADDR_IN) + 16, sizeof(SOCKADDR_IN) + 16, reinterpret_cast<LPDWORD>(&numBytes), static_cast<LPOVERLAPPED>(event)))
+        if (FALSE == sAcceptEx(listenSocket, acceptSocket, buffer, 0, kAcceptAddressSize, kAcceptAddressSize, reinterpret_cast<LPDWORD>(numBytes), static_cast<LPOVERLAPPED>(event)))
         {
             return ::WSAGetLastError();
         }
@@ -332,6 +348,37 @@ namespace core
         return SUCCESS;
     }
 
+    /**
+     * 수락된 연결의 원격 주소 획득
+     *
+     * AcceptEx가 버퍼에 기록한 주소를 해석합니다.
+     * 수락한 소켓마다 getpeername을 호출하지 않아도 되므로 접속이 몰릴 때 시스템 호출이 줄어듭니다.
+     *
+     * @param buffer AcceptAsync에 전달한 버퍼 (수락 완료 후 다른 용도로 쓰기 전에 호출)
+     * @param address [OUT] 원격 주소를 저장할 참조
+     * @return SUCCESS 성공 시, FAILURE 주소 형식이 IPv4가 아닌 경우
+     */
+    Int64 SocketUtils::GetAcceptAddress(Byte* buffer, NetAddress& address)
+    {
+        SOCKADDR* localAddress = nullptr;
+        SOCKADDR* remoteAddress = nullptr;
+        Int32 localAddressLength = 0;
+        Int32 remoteAddressLength = 0;
+        sGetAcceptExSockaddrs(buffer, 0, kAcceptAddressSize, kAcceptAddressSize,
+                              OUT & localAddress, OUT & localAddressLength, OUT & remoteAddress, OUT & remoteAddressLength);
+
+        if ((nullptr == remoteAddress) ||
+            (remoteAddressLength < sizeof_32(SOCKADDR_IN)) ||
+            (remoteAddress->sa_family != AF_INET))
+        {
+            return FAILURE;
+        }
+
+        address = NetAddress(*reinterpret_cast<SOCKADDR_IN*>(remoteAddress));
+
+        return SUCCESS;
+    }
+
     /**
      * 비동기 데이터 수신
      *
@@ -382,4 +429,5 @@ namespace core
     LPFN_CONNECTEX           SocketUtils::sConnectEx = nullptr;
     LPFN_DISCONNECTEX        SocketUtils::sDisconnectEx = nullptr;
     LPFN_ACCEPTEX            SocketUtils::sAcceptEx = nullptr;
+    LPFN_GETACCEPTEXSOCKADDRS   SocketUtils::sGetAcceptExSockaddrs = nullptr;
 }
@@ -42,6 +42,7 @@ namespace core
 
         static Int64                SetLinger(SOCKET socket, UInt16 onOff, UInt16 lingerTime);
         static Int64                SetReuseAddress(SOCKET socket, Bool enable);
+        static Int64                SetExclusiveAddressUse(SOCKET socket, Bool enable);
         static Int64                SetNoDelay(SOCKET socket, Bool enable);
         static Int64                SetReceiveBufferSize(SOCKET socket, Int64 size);
         static Int64                SetSendBufferSize(SOCKET socket, Int64 size);
@@ -55,13 +56,19 @@ namespace core
         static Int64                ConnectAsync(SOCKET socket, const NetAddress& address, Int64* numBytes, ConnectEvent* event);
         static Int64                DisconnectAsync(SOCKET socket, Int64 flags, DisconnectEvent* event);
         static Int64                AcceptAsync(SOCKET listenSocket, SOCKET acceptSocket, Byte* buffer, Int64* numBytes, AcceptEvent* event);
+        static Int64                GetAcceptAddress(Byte* buffer, NetAddress& address);
         static Int64                ReceiveAsync(SOCKET socket, WSABUF* buffer, Int64* numBytes, Int64* flags, ReceiveEvent* event);
         static Int64                SendAsync(SOCKET socket, WSABUF* buffers, Int64 bufferCount, Int64* numBytes, SendEvent* event);
 
+    public:
+        // AcceptEx가 버퍼에 기록하는 주소 하나의 크기 (프로토콜 최대 주소 크기 + 16)
+        static constexpr Int32      kAcceptAddressSize = sizeof(SOCKADDR_IN) + 16;
+
     private:
         static LPFN_CONNECTEX       sConnectEx;
         static LPFN_DISCONNECTEX    sDisconnectEx;
         static LPFN_ACCEPTEX        sAcceptEx;
+        static LPFN_GETACCEPTEXSOCKADDRS    sGetAcceptExSockaddrs;
     };
 
     /**
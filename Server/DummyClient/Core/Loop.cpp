@@ -4,6 +4,10 @@
 #include "DummyClient/Core/Loop.h"
 #include "DummyClient/Packet/Handler.h"
 #include "Core/Network/Session.h"
+#include "Core/Network/Batch.h"
+#include "DummyClient/Simulation/LoadRunner.h"
+#include "Core/Metric/Metric.h"
+#include "Protocol/Packet/Compression.h"
 
 namespace dummy
 {
@@ -16,16 +20,25 @@ namespace dummy
         {
             auto start = std::chrono::steady_clock::now();
 
-            ProcessPackets();
+            // 틱 동안의 송신은 세션마다 모아 틱 끝에 한 번에 송신
+            {
+                core::SendBatchScope batch;
+
+                ProcessPackets();
+                core::SendBatch::FlushIfDue();
+
+                // 연결 요청과 에이전트 행동 갱신
+                LoadRunner::GetInstance().Tick();
+            }
 
             ++tickCount;
 
-            // 1초마다 틱 카운트 로그 출력
+            // 1초마다 진행 상황 로그 출력
             auto now = std::chrono::steady_clock::now();
             auto elapsedSinceLastLog = std::chrono::duration_cast<MilliSec>(now - lastLogTime);
             if (elapsedSinceLastLog >= MilliSec(1000))
             {
-                core::gLogger->Info("Tick Count: {}", tickCount);
+                LoadRunner::GetInstance().LogProgress(tickCount);
                 tickCount = 0;
                 lastLogTime = now;
             }
@@ -46,9 +59,9 @@ namespace dummy
         mRunning = false;
     }
 
-    Int64 Loop::PushPackets(const SharedPtr<core::Session>& owner, const Byte* buffer, Int64 numBytes)
+    Int64 Loop::PushPackets(const SharedPtr<core::Session>& owner, proto::PacketAssembler& assembler, const Byte* buffer, Int64 numBytes)
     {
-        return mPacketQueue.Push(owner, buffer, numBytes);
+        return mPacketQueue.Push(owner, assembler, buffer, numBytes);
     }
 
     void Loop::ProcessPackets()
@@ -60,10 +73,17 @@ namespace dummy
         {
             ASSERT_CRASH_DEBUG(packet != nullptr, "NULL_PACKET_RECEIVED");
 
+            // 사전 학습 중이면 해제된 페이로드를 표본으로 수집
+            if (proto::DictionaryTrainer* trainer = LoadRunner::GetInstance().GetTrainer())
+            {
+                trainer->AddSample(packet->GetPayload(), packet->GetPayloadSize());
+            }
+
             // 패킷을 핸들러로 전달하여 처리
             Bool result = S2C_PacketDispatcher::GetInstance().DispatchPacket(packet);
             if (!result)
             {
+                LoadRunner::GetInstance().GetStats().packetErrors.Add();
                 core::gLogger->Error(TEXT_8("Session[{}]: Failed to process packet with id: {}"), packet->GetOwner()->GetId(), packet->GetId());
             }
 
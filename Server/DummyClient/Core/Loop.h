@@ -40,14 +40,15 @@ namespace dummy
         void Stop();
 
         /**
-         * 버퍼의 패킷들을 큐에 추가합니다.
+         * 버퍼의 프레임들을 재조립해 완성된 패킷을 큐에 추가합니다.
          *
          * @param owner 패킷 소유자 세션
-         * @param buffer 패킷 데이터 버퍼
+         * @param assembler 소유자 세션의 재조립 상태
+         * @param buffer 프레임 데이터 버퍼
          * @param numBytes 버퍼에 있는 데이터 크기 (바이트 단위)
-         * @return 버퍼의 패킷 중 큐로 추가된 패킷 크기의 합 (바이트 단위)
+         * @return 버퍼에서 처리한 프레임 크기의 합 (바이트 단위), 잘못된 프레임이 있으면 FAILURE
          */
-        Int64 PushPackets(const SharedPtr<core::Session>& owner, const Byte* buffer, Int64 numBytes);
+        Int64 PushPackets(const SharedPtr<core::Session>& owner, proto::PacketAssembler& assembler, const Byte* buffer, Int64 numBytes);
 
     private:
         Loop() = default; // 외부 생성 방지
@@ -61,6 +62,6 @@ namespace dummy
 
     private:
         proto::PacketQueue mPacketQueue; // 패킷 큐
-        Bool mRunning = true; // 루프 실행 여부
+        Atomic<Bool> mRunning = true; // 루프 실행 여부 (다른 스레드에서 Stop 호출)
     };
 }
@@ -4,9 +4,12 @@
 #include "Core/Concurrency/Thread.h"
 #include "Core/Io/Dispatcher.h"
 #include "Core/Network/Service.h"
+#include "Core/Network/Batch.h"
 #include "DummyClient/Network/Session.h"
 #include "DummyClient/Packet/Handler.h"
 #include "DummyClient/Core/Loop.h"
+#include "DummyClient/Simulation/LoadRunner.h"
+#include "Protocol/Packet/Compression.h"
 
 using namespace core;
 using namespace dummy;
@@ -15,31 +18,181 @@ Service::Config gConfig =
 {
     NetAddress(TEXT_16("127.0.0.1"), 7777),
     std::make_shared<IoEventDispatcher>(),
-    std::make_shared<ServerSession>,
+    MakeSessionFactory<ServerSession>(),
     1000,
 };
 
-int main()
+// 종료 요청 신호 (Ctrl+C, Ctrl+Break)
+HANDLE gShutdownEvent = ::CreateEventW(nullptr, TRUE, FALSE, nullptr);
+
+/**
+ * 실행 인자
+ *
+ * --agents <count>         유지할 에이전트(연결) 수 (기본 1000)
+ * --rooms <count>          에이전트를 나눠 입장시킬 룸 수 (기본 500, 서버의 RoomManager::kMaxRoomCount 미만)
+ * --ramp <count>           초당 새 연결 수 (기본 200, 0이면 한 번에 모두 연결)
+ * --duration <sec>         실행 시간, 지나면 종료하고 결과 보고 (기본 0: 종료 요청까지)
+ * --script <path>          에이전트 행동 스크립트 파일 (형식은 AgentScript 참고)
+ * --ping <ms>              에이전트별 지연 측정 핑 간격 (기본 1000, 0이면 보내지 않음)
+ * --threads <role>=<count> 역할별 스레드 수 지정 (예: --threads io=4), 반복 가능
+ * --compression            연결마다 C2S_Hello로 zstd 압축 요청
+ * --dictionary <path>      압축 사전 파일 로드 (서버와 같은 사전이어야 압축 협상 성공)
+ * --train-dictionary <path>  수신한 페이로드로 압축 사전을 학습해 종료 시 저장
+ * --send-batch-us <us>     루프 틱 동안의 송신을 세션마다 묶어 보내고, 묶인 송신의 최대 지연을 지정 (기본 0: 즉시 송신)
+ * --listeners <count>      서버 리스너 수와 같게 지정하면 7777부터 연속된 포트에 연결을 나눠 요청 (기본 1)
+ *
+ * 에이전트는 전용 스레드 없이 루프 틱에서 갱신되고, 연결은 입출력 워커들이 IOCP로 나눠 처리합니다.
+ *
+ * 룸 부하 테스트 (에이전트 1만 명을 500개 룸에 분산):
+ *     GameServer --max-sessions 10000
+ *     DummyClient --agents 10000 --rooms 500 --ramp 1000 --duration 120
+ * 서버는 RoomManager 통계(룸/멤버/브로드캐스트 수)를 주기적으로 기록하고,
+ * 클라이언트는 종료 시 룸당 에이전트 수, 채팅 팬아웃(수신/송신), 입장 실패 수와 지연을 보고합니다.
+ */
+LoadConfig ParseOptions(int argc, char* argv[])
+{
+    LoadConfig config;
+    for (int i = 1; i < argc; ++i)
+    {
+        const String8View arg = argv[i];
+        if (arg == "--compression")
+        {
+            config.compression = true;
+        }
+        else if (i + 1 == argc)
+        {
+            break;
+        }
+        else if (arg == "--agents")
+        {
+            config.agentCount = std::max<Int64>(std::atoll(argv[++i]), 1);
+        }
+        else if (arg == "--rooms")
+        {
+            config.roomCount = std::max<Int64>(std::atoll(argv[++i]), 1);
+        }
+        else if (arg == "--ramp")
+        {
+            config.rampPerSec = std::max<Int64>(std::atoll(argv[++i]), 0);
+        }
+        else if (arg == "--duration")
+        {
+            config.durationSec = std::max<Int64>(std::atoll(argv[++i]), 0);
+        }
+        else if (arg == "--script")
+        {
+            config.scriptPath = argv[++i];
+        }
+        else if (arg == "--ping")
+        {
+            config.pingIntervalMs = std::max<Int64>(std::atoll(argv[++i]), 0);
+        }
+        else if (arg == "--dictionary")
+        {
+            config.dictionaryPath = argv[++i];
+        }
+        else if (arg == "--train-dictionary")
+        {
+            config.trainDictionaryPath = argv[++i];
+        }
+        else if (arg == "--send-batch-us")
+        {
+            SendBatch::Configure(std::atoll(argv[++i]));
+        }
+        else if (arg == "--listeners")
+        {
+            gConfig.listenerCount = std::max<Int64>(std::atoll(argv[++i]), 1);
+        }
+        else if (arg == "--threads")
+        {
+            const String8View option = argv[++i];
+            const auto separator = option.find('=');
+            ThreadRole role;
+            if ((separator == String8View::npos) || !ThreadManager::FindRole(option.substr(0, separator), OUT role))
+            {
+                gLogger->Warn(TEXT_8("Invalid thread option: {}"), option);
+                continue;
+            }
+
+            ThreadRoleConfig roleConfig = gThreadManager->GetRoleConfig(role);
+            roleConfig.count = std::max(std::atoi(String8(option.substr(separator + 1)).c_str()), 1);
+            gThreadManager->SetRoleConfig(role, roleConfig);
+        }
+    }
+
+    return config;
+}
+
+BOOL WINAPI HandleConsoleCtrl(DWORD ctrlType)
 {
+    switch (ctrlType)
+    {
+    case CTRL_C_EVENT:
+    case CTRL_BREAK_EVENT:
+        ::SetEvent(gShutdownEvent);
+        return TRUE;
+    default:
+        return FALSE;
+    }
+}
+
+/**
+ * 더미 클라이언트를 종료합니다.
+ *
+ * 동작:
+ * 1. 부하 테스트 집계를 멈춘 뒤 클라이언트 루프, 잡 타이머, 잡 워커 순서로 중지 (잡 워커는 남은 큐를 비운 뒤 종료)
+ * 2. 대기 중인 송신을 기한 내에 마무리하고 모든 세션 연결 해제
+ * 3. 입출력 워커 중지 후 전체 소요 시간 기록
+ */
+void Shutdown(const SharedPtr<ClientService>& service)
+{
+    const auto begin = std::chrono::steady_clock::now();
+
+    LoadRunner::GetInstance().Stop();
+    dummy::Loop::GetInstance().Stop();
+    gThreadManager->Join(ThreadRole::Loop);
+
+    gJobTimer->Stop();
+    gThreadManager->Join(ThreadRole::Timer);
+
+    gJobQueueManager->Stop();
+    gThreadManager->Join(ThreadRole::Job);
+
+    service->Stop();
+
+    service->GetIoEventDispatcher()->Stop();
+    gThreadManager->Join();
+
+    gLogger->Info(TEXT_8("Shutdown: Completed in {} ms"),
+                  std::chrono::duration_cast<MilliSec>(std::chrono::steady_clock::now() - begin).count());
+}
+
+int main(int argc, char* argv[])
+{
+    const LoadConfig loadConfig = ParseOptions(argc, argv);
+
+    ::SetConsoleCtrlHandler(HandleConsoleCtrl, TRUE);
+
     // 서버 서비스 준비까지 잠시 대기
     std::this_thread::sleep_for(std::chrono::milliseconds(250));
 
-    // 클라이언트 서비스 생성 및 실행
+    // 클라이언트 서비스 생성 (연결은 루프 틱에서 LoadRunner가 속도를 조절하며 요청)
+    gConfig.maxSessionCount = loadConfig.agentCount;
     auto service = std::make_shared<ClientService>(gConfig);
-    ASSERT_CRASH(SUCCESS == service->Run(), "CLIENT_SERVICE_RUN_FAILED");
+    ASSERT_CRASH(LoadRunner::GetInstance().Init(loadConfig, service), "LOAD_RUNNER_INIT_FAILED");
 
     // 더미 클라이언트 루프 실행
-    gThreadManager->Launch([]
+    gThreadManager->Launch(ThreadRole::Loop, []
                            {
                                dummy::Loop::GetInstance().Run();
                            });
 
     // 입출력 워커 실행
-    for (Int64 i = 0; i < 4; ++i)
+    for (Int32 i = 0; i < gThreadManager->GetRoleConfig(ThreadRole::Io).count; ++i)
     {
-        gThreadManager->Launch([service]
+        gThreadManager->Launch(ThreadRole::Io, [service]
                                {
-                                   while (true)
+                                   while (service->GetIoEventDispatcher()->IsRunning())
                                    {
                                        Int64 result = service->GetIoEventDispatcher()->Dispatch();
                                    }
@@ -47,25 +200,27 @@ int main()
     }
 
     // 잡 워커 실행
-    for (Int64 i = 0; i < 3; ++i)
+    for (Int32 i = 0; i < gThreadManager->GetRoleConfig(ThreadRole::Job).count; ++i)
     {
-        gThreadManager->Launch([]
+        gThreadManager->Launch(ThreadRole::Job, []
                                {
                                    gJobQueueManager->FlushQueues();
                                });
     }
 
     // 잡 타이머 실행
-    gThreadManager->Launch([]
+    gThreadManager->Launch(ThreadRole::Timer, []
                            {
                                gJobTimer->Run();
                            });
 
+    // 실행 시간이 지나거나 종료 요청까지 대기한 뒤 클라이언트 종료
+    const DWORD waitMs = (loadConfig.durationSec > 0) ? static_cast<DWORD>(loadConfig.durationSec * 1'000) : INFINITE;
+    ::WaitForSingleObject(gShutdownEvent, waitMs);
+    Shutdown(service);
 
-    gThreadManager->Join();
-
-    // 클라이언트 서비스 중지
-    service->Stop();
+    LoadRunner::GetInstance().SaveDictionary();
+    LoadRunner::GetInstance().Report();
 
     return 0;
 }
@@ -4,48 +4,79 @@
 #include "DummyClient/Network/Session.h"
 #include "DummyClient/Packet/Handler.h"
 #include "Protocol/Packet/Utils.h"
+#include "Protocol/Packet/Compression.h"
 #include "DummyClient/Core/Loop.h"
 #include "DummyClient/Simulation/Agent.h"
+#include "DummyClient/Simulation/LoadRunner.h"
 
 namespace dummy
 {
     ServerSession::~ServerSession()
     {
-        core::gLogger->Info(TEXT_8("Session[{}]: Destroyed"), GetId());
+        LOG_DEBUG(Network, TEXT_8("Session[{}]: Destroyed"), GetId());
     }
 
     void ServerSession::OnConnected()
     {
-        core::gLogger->Info(TEXT_8("Session[{}]: Connected to server"), GetId());
+        LOG_DEBUG(Network, TEXT_8("Session[{}]: Connected to server"), GetId());
 
-        // 에이전트 추가
-        SharedPtr<Agent> agent = AgentManager::GetInstance().AddAgent(GetServerSession());
+        // 스크립트의 프로필로 에이전트 추가
+        const AgentProfile& profile = LoadRunner::GetInstance().OnConnected();
+        SharedPtr<Agent> agent = AgentManager::GetInstance().AddAgent(GetServerSession(), profile);
 
-        // 방 입장 요청 전송
-        proto::C2S_EnterRoom payload;
-        payload.set_id(agent->GetId());
-        payload.set_password(TEXT_8("1234"));
-        proto::PacketUtils::Send(GetSession(), payload);
+        // 압축 협상 요청 (응답이 오기 전까지는 압축하지 않은 메시지만 주고받음)
+        const proto::PacketCompressor& compressor = proto::PacketCompressor::GetInstance();
+        if (compressor.IsEnabled())
+        {
+            // 요청을 보낸 뒤에는 서버가 언제든 압축된 프레임을 보낼 수 있음
+            SetCompressedFramesAllowed(true);
+
+            proto::C2S_Hello hello;
+            hello.set_compression(static_cast_64(proto::CompressionType::Zstd));
+            hello.set_dictionary_id(compressor.GetDictionaryId());
+            proto::PacketUtils::Send(GetSession(), hello);
+        }
+
+        // 방 입장 요청 전송 (로비를 제외한 룸에 고르게 분산)
+        agent->RequestEnterRoom(agent->GetId() % LoadRunner::GetInstance().GetConfig().roomCount + 1);
     }
 
     void ServerSession::OnDisconnected(String8 cause)
     {
-        core::gLogger->Warn(TEXT_8("Session[{}]: Disconnected from server: {}"), GetId(), cause);
+        LOG_DEBUG(Network, TEXT_8("Session[{}]: Disconnected from server: {}"), GetId(), cause);
 
         // 에이전트 제거
-        SharedPtr<Agent> agent = AgentManager::GetInstance().FindAgent(GetSession()->GetId());
-        Bool result = AgentManager::GetInstance().RemoveAgent(agent->GetId());
-        if (!result)
+        SharedPtr<Agent> agent = AgentManager::GetInstance().FindAgentBySessionId(GetId());
+        if (!agent)
+        {
+            core::gLogger->Error(TEXT_8("Session[{}]: Agent not found"), GetId());
+            return;
+        }
+
+        if (!AgentManager::GetInstance().RemoveAgent(agent->GetId()))
         {
             core::gLogger->Error(TEXT_8("Session[{}]: Failed to remove agent[{}]"), GetId(), agent->GetId());
         }
+
+        LoadRunner::GetInstance().OnDisconnected(agent->GetProfile(), agent->IsLeaving());
     }
 
     Int64 ServerSession::OnReceived(const Byte* buffer, Int64 numBytes)
     {
-        return dummy::Loop::GetInstance().PushPackets(GetSession(), buffer, numBytes);
+        return dummy::Loop::GetInstance().PushPackets(GetSession(), mAssembler, buffer, numBytes);
     }
 
     void ServerSession::OnSent(Int64 numBytes)
     {}
+
+    void ServerSession::OnConnectFailed(Int64 errorCode)
+    {
+        LOG_DEBUG(Network, TEXT_8("Session[{}]: Failed to connect: {}"), GetId(), errorCode);
+        LoadRunner::GetInstance().OnConnectFailed();
+    }
+
+    void ServerSession::OnReset()
+    {
+        mAssembler.Reset();
+    }
 } // namespace dummy
@@ -3,11 +3,7 @@
 #pragma once
 
 #include "Core/Network/Session.h"
-
-namespace game
-{
-    class Room;
-} // namespace game
+#include "Protocol/Packet/Assembler.h"
 
 namespace dummy
 {
@@ -18,13 +14,17 @@ namespace dummy
         virtual             ~ServerSession() override;
 
         SharedPtr<ServerSession> GetServerSession() { return std::static_pointer_cast<ServerSession>(shared_from_this()); }
+        void                SetCompressedFramesAllowed(Bool allowed) { mAssembler.SetCompressionAllowed(allowed); }
 
     protected:
         virtual void        OnConnected() override;
         virtual void        OnDisconnected(String8 cause) override;
         virtual Int64       OnReceived(const Byte* buffer, Int64 numBytes) override;
         virtual void        OnSent(Int64 numBytes) override;
-    };
+        virtual void        OnConnectFailed(Int64 errorCode) override;
+        virtual void        OnReset() override;
 
-    extern SharedPtr<game::Room>    gRoom;
+    private:
+        proto::PacketAssembler  mAssembler; // 수신 프레임 재조립 (수신 완료 처리에서만 사용)
+    };
 } // namespace dummy
@@ -4,17 +4,15 @@
 #include "DummyClient/Packet/Handler.h"
 #include "DummyClient/Network/Session.h"
 #include "DummyClient/Simulation/Agent.h"
+#include "DummyClient/Simulation/LoadRunner.h"
+#include "Core/Metric/Metric.h"
+#include "Protocol/Packet/Compression.h"
+#include <charconv>
 
 namespace dummy
 {
     Bool S2C_PacketDispatcher::Handle_S2C_EnterRoom(const SharedPtr<core::Session>& owner, const proto::S2C_EnterRoom& payload)
     {
-        if (!payload.success())
-        {
-            core::gLogger->Error(TEXT_8("Session[{}]: Failed to enter room"), owner->GetId());
-            return false;
-        }
-
         // 에전전트 찾기
         SharedPtr<Agent> agent = AgentManager::GetInstance().FindAgentBySessionId(owner->GetId());
         if (!agent)
@@ -30,11 +28,95 @@ namespace dummy
             return false;
         }
 
+        agent->OnEnterRoom(payload.success());
+        if (!payload.success())
+        {
+            LOG_WARN(Game, TEXT_8("Session[{}]: Failed to enter room"), owner->GetId());
+        }
+
         return true;
     }
 
+    /**
+     * 압축 협상 응답 처리
+     *
+     * 서버가 압축을 허용하면 이 세션이 보내는 메시지도 압축합니다.
+     * 서버는 응답을 보낸 뒤부터 압축하므로 응답 이전의 메시지는 압축되어 있지 않습니다.
+     */
+    Bool S2C_PacketDispatcher::Handle_S2C_Hello(const SharedPtr<core::Session>& owner, const proto::S2C_Hello& payload)
+    {
+        if (static_cast<proto::CompressionType>(payload.compression()) != proto::CompressionType::Zstd)
+        {
+            LOG_WARN(Network, TEXT_8("Session[{}]: Compression rejected (server dictionary={}, client dictionary={})"),
+                     owner->GetId(), payload.dictionary_id(), proto::PacketCompressor::GetInstance().GetDictionaryId());
+            return true;
+        }
+
+        owner->SetCompressionEnabled(true);
+        LoadRunner::GetInstance().GetStats().compressionSessions.Add();
+
+        return true;
+    }
+
+    /**
+     * 채팅 수신 처리
+     *
+     * 다른 에이전트가 보낸 채팅이면 메시지 앞의 전송 시각으로 전달 지연을 기록합니다.
+     * 서버가 보낸 메시지처럼 전송 시각이 없으면 수신 수만 집계합니다.
+     */
     Bool S2C_PacketDispatcher::Handle_S2C_Chat(const SharedPtr<core::Session>& owner, const proto::S2C_Chat& payload)
     {
+        LoadStats& stats = LoadRunner::GetInstance().GetStats();
+        stats.chatsReceived.Add();
+
+        const String8& message = payload.message();
+        const auto separator = message.find(':');
+        if ((separator == String8::npos) || (separator == 0))
+        {
+            return true;
+        }
+
+        Int64 sentUs = 0;
+        const auto [end, error] = std::from_chars(message.data(), message.data() + separator, sentUs);
+        if ((error == std::errc()) && (end == message.data() + separator))
+        {
+            stats.chatLatency.Record(LoadRunner::GetNowUs() - sentUs);
+        }
+
+        return true;
+    }
+
+    /**
+     * 퐁 수신 처리
+     *
+     * 왕복 시간은 클라이언트 루프의 대기를 빼기 위해 퐁의 수신 완료 시각으로 계산하고,
+     * 서버가 보낸 구간 길이를 빼서 네트워크 구간을 구합니다.
+     */
+    Bool S2C_PacketDispatcher::Handle_S2C_Pong(const SharedPtr<core::Session>& owner, const proto::S2C_Pong& payload)
+    {
+        LoadStats& stats = LoadRunner::GetInstance().GetStats();
+        stats.pongsReceived.Add();
+
+        const Int64 nowUs = LoadRunner::GetNowUs();
+        const proto::RawPacket* packet = GetCurrentPacket();
+        const Int64 receiveUs = ((packet != nullptr) && (packet->GetReceiveUs() > 0)) ? packet->GetReceiveUs() : nowUs;
+
+        const Int64 rttUs = receiveUs - payload.client_send_us();
+        const Int64 serverUs = payload.tick_wait_us() + payload.queue_us() + payload.handler_us();
+
+        stats.pingRtt.Record(rttUs);
+        stats.pingNetwork.Record(std::max<Int64>(rttUs - serverUs, 0));
+        stats.pingTickWait.Record(payload.tick_wait_us());
+        stats.pingQueue.Record(payload.queue_us());
+        stats.pingHandler.Record(payload.handler_us());
+        stats.pingClientQueue.Record(nowUs - receiveUs);
+
+        // 첫 퐁에는 직전 송신 시간이 없음
+        if (payload.sequence() > 1)
+        {
+            stats.pingEgress.Record(payload.egress_us());
+        }
+
         return true;
     }
 } // namespace dummy
@@ -25,10 +25,14 @@ namespace dummy
             
             RegisterHandler<S2C_EnterRoom>(&Handle_S2C_EnterRoom, PacketId::S2C_EnterRoom);
             RegisterHandler<S2C_Chat>(&Handle_S2C_Chat, PacketId::S2C_Chat);
+            RegisterHandler<S2C_Pong>(&Handle_S2C_Pong, PacketId::S2C_Pong);
+            RegisterHandler<S2C_Hello>(&Handle_S2C_Hello, PacketId::S2C_Hello);
         }
 
     private:    // 모든 페이로드 핸들러
         static Bool     Handle_S2C_EnterRoom(const SharedPtr<core::Session>& owner, const proto::S2C_EnterRoom& payload);
         static Bool     Handle_S2C_Chat(const SharedPtr<core::Session>& owner, const proto::S2C_Chat& payload);
+        static Bool     Handle_S2C_Pong(const SharedPtr<core::Session>& owner, const proto::S2C_Pong& payload);
+        static Bool     Handle_S2C_Hello(const SharedPtr<core::Session>& owner, const proto::S2C_Hello& payload);
     };
 } // namespace dummy
\ No newline at end of file
@@ -2,18 +2,163 @@
 
 #include "DummyClient/Pch.h"
 #include "DummyClient/Simulation/Agent.h"
+#include "DummyClient/Simulation/LoadRunner.h"
+#include "Protocol/Packet/Utils.h"
+#include "Core/Metric/Metric.h"
 
 namespace dummy
 {
-    Agent::Agent(AgentId id, const SharedPtr<ServerSession>& session)
-        : mId(id), mSession(session)
-    {}
+    /**
+     * 에이전트를 생성합니다.
+     *
+     * 같은 프로필의 에이전트가 동시에 채팅하거나 재접속하지 않도록
+     * 첫 채팅 시각과 접속 유지 시간을 에이전트 ID로 분산시킵니다.
+     */
+    Agent::Agent(AgentId id, const SharedPtr<ServerSession>& session, const AgentProfile& profile)
+        : mId(id)
+        , mSession(session)
+        , mProfile(profile)
+        , mConnectUs(LoadRunner::GetNowUs())
+    {
+        if (mProfile.chatPerSec > 0.0)
+        {
+            mChatIntervalUs = std::max<Int64>(static_cast<Int64>(1'000'000.0 / mProfile.chatPerSec), 1);
+        }
+
+        if (mProfile.lifetimeMs > 0)
+        {
+            const Int64 lifetimeUs = mProfile.lifetimeMs * 1'000;
+            // 유지 시간의 75% ~ 125% 사이로 분산
+            mExpireUs = mConnectUs + lifetimeUs * 3 / 4 + (mId * 7'919) % (lifetimeUs / 2 + 1);
+        }
+
+        const Int64 pingIntervalMs = LoadRunner::GetInstance().GetConfig().pingIntervalMs;
+        if (pingIntervalMs > 0)
+        {
+            mPingIntervalUs = pingIntervalMs * 1'000;
+            mNextPingUs = mConnectUs + (mId * 7'919) % mPingIntervalUs;
+        }
+    }
 
-    SharedPtr<Agent> AgentManager::AddAgent(const SharedPtr<ServerSession>& session)
+    void Agent::RequestEnterRoom(Int64 roomId)
+    {
+        mEnterRequestUs = LoadRunner::GetNowUs();
+
+        proto::C2S_EnterRoom payload;
+        payload.set_id(mId);
+        payload.set_password(TEXT_8("1234"));
+        payload.set_room_id(roomId);
+        proto::PacketUtils::Send(mSession, payload);
+    }
+
+    void Agent::OnEnterRoom(Bool success)
+    {
+        LoadStats& stats = LoadRunner::GetInstance().GetStats();
+        if (!success)
+        {
+            stats.enterRoomFailures.Add();
+            return;
+        }
+
+        const Int64 nowUs = LoadRunner::GetNowUs();
+        stats.enterRoomRtt.Record(nowUs - mEnterRequestUs);
+
+        mInRoom = true;
+        if (mChatIntervalUs > 0)
+        {
+            mNextChatUs = nowUs + (mId * 7'919) % mChatIntervalUs;
+        }
+    }
+
+    /**
+     * 에이전트 행동을 갱신합니다.
+     *
+     * @param nowUs 현재 시각 (마이크로초)
+     *
+     * 동작:
+     * 1. 접속 유지 시간이 지났으면 연결을 끊음
+     * 2. 핑 시각이 되었으면 핑 전송 (밀려도 한 번만 전송)
+     * 3. 룸에 입장했고 채팅 시각이 되었으면 채팅 전송 (틱 간격보다 빈도가 높으면 밀린 만큼 전송)
+     * 4. 루프가 멈췄다가 재개되는 등 kMaxChatBurst보다 많이 밀렸으면 나머지는 보내지 않고 다음 시각을 다시 맞춤
+     */
+    void Agent::Update(Int64 nowUs)
+    {
+        if (mLeaving.load())
+        {
+            return;
+        }
+
+        if ((mExpireUs > 0) && (nowUs >= mExpireUs))
+        {
+            mLeaving.store(true);
+            mSession->DisconnectAsync(kChurnCause);
+            return;
+        }
+
+        if ((mPingIntervalUs > 0) && (nowUs >= mNextPingUs))
+        {
+            SendPing(nowUs);
+            mNextPingUs = nowUs + mPingIntervalUs;
+        }
+
+        if (!mInRoom || (mChatIntervalUs == 0))
+        {
+            return;
+        }
+
+        Int64 sentCount = 0;
+        while ((nowUs >= mNextChatUs) && (sentCount < kMaxChatBurst))
+        {
+            SendChat(nowUs);
+            mNextChatUs += mChatIntervalUs;
+            ++sentCount;
+        }
+
+        if (nowUs >= mNextChatUs)
+        {
+            mNextChatUs = nowUs + mChatIntervalUs;
+        }
+    }
+
+    /**
+     * 전송 시각을 앞에 기록한 채팅을 보냅니다.
+     *
+     * 메시지 형식: "<전송 시각(us)>:" 뒤에 프로필 크기까지 채움
+     * 같은 프로세스의 다른 에이전트가 받으면 전송 시각과 비교해 전달 지연을 계산합니다.
+     */
+    void Agent::SendChat(Int64 nowUs)
+    {
+        String8 message = fmt::format("{}:", nowUs);
+        if (static_cast_64(message.size()) < mProfile.messageSize)
+        {
+            message.resize(mProfile.messageSize, 'x');
+        }
+
+        LoadStats& stats = LoadRunner::GetInstance().GetStats();
+        stats.chatsSent.Add();
+        stats.chatBytesSent.Add(static_cast_64(message.size()));
+
+        proto::C2S_Chat payload;
+        payload.set_id(mId);
+        payload.set_message(std::move(message));
+        proto::PacketUtils::Send(mSession, payload);
+    }
+
+    void Agent::SendPing(Int64 nowUs)
+    {
+        LoadRunner::GetInstance().GetStats().pingsSent.Add();
+
+        proto::C2S_Ping payload;
+        payload.set_sequence(++mPingSequence);
+        payload.set_client_send_us(nowUs);
+        proto::PacketUtils::Send(mSession, payload);
+    }
+
+    SharedPtr<Agent> AgentManager::AddAgent(const SharedPtr<ServerSession>& session, const AgentProfile& profile)
     {
         static Atomic<AgentId> sNextAgentId = 1;
 
-        SharedPtr<Agent> agent = std::make_shared<Agent>(sNextAgentId.fetch_add(1), session);
+        SharedPtr<Agent> agent = std::make_shared<Agent>(sNextAgentId.fetch_add(1), session, profile);
         {
             WRITE_GUARD;
 
@@ -21,7 +166,7 @@ namespace dummy
             mSessionToAgentIdMap[session->GetId()] = agent->GetId();
         }
 
-        core::gLogger->Info(TEXT_8("Agent[{}] added with session ID [{}]"), agent->GetId(), session->GetId());
+        LOG_DEBUG(Game, TEXT_8("Agent[{}] added with session ID [{}]"), agent->GetId(), session->GetId());
 
         return agent;
     }
@@ -64,19 +209,53 @@ namespace dummy
 
     Bool AgentManager::RemoveAgent(AgentId agentId)
     {
-        WRITE_GUARD;
-
-        auto it = mAgents.find(agentId);
-        if (it == mAgents.end())
         {
-            return false; // 에이전트가 존재하지 않음
-        }
+            WRITE_GUARD;
+
+            auto it = mAgents.find(agentId);
+            if (it == mAgents.end())
+            {
+                return false; // 에이전트가 존재하지 않음
+            }
 
-        mSessionToAgentIdMap.erase(it->second->GetSessionId());
-        mAgents.erase(it);
+            mSessionToAgentIdMap.erase(it->second->GetSessionId());
+            mAgents.erase(it);
+        }
 
-        core::gLogger->Info(TEXT_8("Agent[{}] removed"), agentId);
+        LOG_DEBUG(Game, TEXT_8("Agent[{}] removed"), agentId);
 
         return true; // 성공적으로 제거됨
     }
+
+    /**
+     * 모든 에이전트를 갱신합니다. 루프 스레드에서 매 틱 호출됩니다.
+     *
+     * 에이전트가 연결을 끊으면 입출력 스레드에서 RemoveAgent()가 호출되므로
+     * 락을 잡은 채로 갱신하지 않고 스냅샷을 만든 뒤 락 밖에서 갱신합니다.
+     */
+    void AgentManager::UpdateAgents(Int64 nowUs)
+    {
+        {
+            READ_GUARD;
+
+            mUpdateAgents.clear();
+            mUpdateAgents.reserve(mAgents.size());
+            for (const auto& [id, agent] : mAgents)
+            {
+                mUpdateAgents.push_back(agent);
+            }
+        }
+
+        for (const SharedPtr<Agent>& agent : mUpdateAgents)
+        {
+            agent->Update(nowUs);
+        }
+        mUpdateAgents.clear();
+    }
+
+    Int64 AgentManager::GetAgentCount()
+    {
+        READ_GUARD;
+        return static_cast_64(mAgents.size());
+    }
 }
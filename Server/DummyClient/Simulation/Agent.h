@@ -3,23 +3,64 @@
 #pragma once
 
 #include "DummyClient/Network/Session.h"
+#include "DummyClient/Simulation/Script.h"
 
 namespace dummy
 {
-
     using AgentId = Int64;
 
+    /*
+     * Agent - 세션 하나를 사용하는 가상 플레이어
+     *
+     * 주요 기능:
+     * - 접속하면 룸 입장을 요청하고 응답까지의 왕복 시간을 기록
+     * - 입장 후 프로필의 빈도와 크기로 채팅 전송 (메시지 앞에 전송 시각을 기록)
+     * - 설정된 간격으로 지연 측정 핑 전송 (퐁은 S2C_Pong 핸들러가 집계)
+     * - 프로필의 접속 유지 시간이 지나면 연결을 끊음 (LoadRunner가 새 에이전트로 재접속)
+     *
+     * 스레드 규칙:
+     * - Update()와 OnEnterRoom()은 루프 스레드에서만 호출
+     * - 전용 스레드나 타이머 없이 루프 틱에서 모든 에이전트를 갱신하므로 에이전트 수에 따라 스레드가 늘지 않음
+     */
     class Agent
     {
     public:
-        Agent(AgentId id, const SharedPtr<ServerSession>& session);
+        Agent(AgentId id, const SharedPtr<ServerSession>& session, const AgentProfile& profile);
+
+        void                    RequestEnterRoom(Int64 roomId);
+        void                    OnEnterRoom(Bool success);
+        void                    Update(Int64 nowUs);
 
-        AgentId GetId() const { return mId; }
-        Int64 GetSessionId() const { return mSession->GetId(); }
+        AgentId                 GetId() const { return mId; }
+        Int64                   GetSessionId() const { return mSession->GetId(); }
+        const AgentProfile&     GetProfile() const { return mProfile; }
+        Bool                    IsLeaving() const { return mLeaving.load(); }
+
+    public:
+        // 재접속 주기에 따라 끊을 때의 원인
+        static constexpr const Char8*   kChurnCause = "Agent churn";
+        // 한 번의 갱신에서 밀린 채팅을 보내는 최대 수 (넘으면 나머지는 버리고 현재 시각 기준으로 다시 맞춤)
+        static constexpr Int64          kMaxChatBurst = 4;
 
     private:
-        const AgentId mId;
-        SharedPtr<ServerSession> mSession;
+        void                    SendChat(Int64 nowUs);
+        void                    SendPing(Int64 nowUs);
+
+    private:
+        const AgentId               mId;
+        SharedPtr<ServerSession>    mSession;
+        const AgentProfile&         mProfile;
+
+        Int64                       mConnectUs = 0;
+        Int64                       mEnterRequestUs = 0;
+        Bool                        mInRoom = false;
+        Int64                       mChatIntervalUs = 0;
+        Int64                       mNextChatUs = 0;
+        Int64                       mExpireUs = 0;
+        Int64                       mPingIntervalUs = 0;
+        Int64                       mNextPingUs = 0;
+        Int64                       mPingSequence = 0;
+        Atomic<Bool>                mLeaving = false;
     };
 
     class AgentManager
@@ -31,10 +72,12 @@ namespace dummy
             return sInstance;
         }
 
-        SharedPtr<Agent> AddAgent(const SharedPtr<ServerSession>& session);
+        SharedPtr<Agent> AddAgent(const SharedPtr<ServerSession>& session, const AgentProfile& profile);
         SharedPtr<Agent> FindAgent(AgentId agentId);
         SharedPtr<Agent> FindAgentBySessionId(Int64 sessionId);
         Bool RemoveAgent(AgentId agentId);
+        void UpdateAgents(Int64 nowUs);
+        Int64 GetAgentCount();
 
     private:
         AgentManager() = default;
@@ -43,5 +86,6 @@ namespace dummy
         RW_LOCK;
         HashMap<AgentId, SharedPtr<Agent>> mAgents;
         HashMap<Int64, AgentId> mSessionToAgentIdMap;
+        Vector<SharedPtr<Agent>> mUpdateAgents; // 갱신할 에이전트 스냅샷 (루프 스레드 전용)
     };
 }
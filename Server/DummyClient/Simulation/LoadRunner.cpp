@@ -0,0 +1,307 @@
+﻿/*    DummyClient/Simulation/LoadRunner.cpp    */
+
+#include "DummyClient/Pch.h"
+#include "DummyClient/Simulation/LoadRunner.h"
+#include "DummyClient/Simulation/Agent.h"
+#include "Core/Network/Service.h"
+#include "Core/Network/Batch.h"
+#include "Core/Metric/Metric.h"
+#include "Protocol/Packet/Compression.h"
+
+using namespace core;
+
+namespace dummy
+{
+    LoadStats::LoadStats()
+        : connectAttempts(gMetricRegistry->AddCounter(TEXT_8("dummy_connect_attempts_total"), TEXT_8("Connections requested")))
+        , connects(gMetricRegistry->AddCounter(TEXT_8("dummy_connects_total"), TEXT_8("Connections established")))
+        , connectFailures(gMetricRegistry->AddCounter(TEXT_8("dummy_connect_failures_total"), TEXT_8("Connections that failed")))
+        , churnDisconnects(gMetricRegistry->AddCounter(TEXT_8("dummy_churn_disconnects_total"), TEXT_8("Disconnects requested by agent scripts")))
+        , unexpectedDisconnects(gMetricRegistry->AddCounter(TEXT_8("dummy_unexpected_disconnects_total"), TEXT_8("Disconnects not requested by agents")))
+        , enterRoomFailures(gMetricRegistry->AddCounter(TEXT_8("dummy_enter_room_failures_total"), TEXT_8("Rejected enter room requests")))
+        , packetErrors(gMetricRegistry->AddCounter(TEXT_8("dummy_packet_errors_total"), TEXT_8("Packets that failed to dispatch")))
+        , chatsSent(gMetricRegistry->AddCounter(TEXT_8("dummy_chats_sent_total"), TEXT_8("Chat messages sent")))
+        , chatBytesSent(gMetricRegistry->AddCounter(TEXT_8("dummy_chat_sent_bytes_total"), TEXT_8("Chat message bytes sent")))
+        , chatsReceived(gMetricRegistry->AddCounter(TEXT_8("dummy_chats_received_total"), TEXT_8("Chat messages received")))
+        , enterRoomRtt(gMetricRegistry->AddHistogram(TEXT_8("dummy_enter_room_rtt_microseconds"), TEXT_8("Enter room request to response")))
+        , chatLatency(gMetricRegistry->AddHistogram(TEXT_8("dummy_chat_latency_microseconds"), TEXT_8("Chat send to delivery at another agent")))
+        , pingsSent(gMetricRegistry->AddCounter(TEXT_8("dummy_pings_sent_total"), TEXT_8("Latency pings sent")))
+        , pongsReceived(gMetricRegistry->AddCounter(TEXT_8("dummy_pongs_received_total"), TEXT_8("Latency pongs received")))
+        , pingRtt(gMetricRegistry->AddHistogram(TEXT_8("dummy_ping_rtt_microseconds"), TEXT_8("Ping send to pong receive completion")))
+        , pingNetwork(gMetricRegistry->AddHistogram(TEXT_8("dummy_ping_network_microseconds"), TEXT_8("Ping RTT minus server residence (kernels, wire and pong egress)")))
+        , pingTickWait(gMetricRegistry->AddHistogram(TEXT_8("dummy_ping_tick_wait_microseconds"), TEXT_8("Server receive completion to start of the processing tick")))
+        , pingQueue(gMetricRegistry->AddHistogram(TEXT_8("dummy_ping_queue_microseconds"), TEXT_8("Server tick start to packet queue pop")))
+        , pingHandler(gMetricRegistry->AddHistogram(TEXT_8("dummy_ping_handler_microseconds"), TEXT_8("Server packet queue pop to handler exit")))
+        , pingEgress(gMetricRegistry->AddHistogram(TEXT_8("dummy_ping_egress_microseconds"), TEXT_8("Server handler exit to send completion of the previous pong")))
+        , pingClientQueue(gMetricRegistry->AddHistogram(TEXT_8("dummy_ping_client_queue_microseconds"), TEXT_8("Client pong receive completion to handler")))
+        , compressionSessions(gMetricRegistry->AddCounter(TEXT_8("dummy_compression_sessions_total"), TEXT_8("Sessions that negotiated compression")))
+    {}
+
+    LoadRunner::LoadRunner() = default;
+
+    LoadRunner::~LoadRunner() = default;
+
+    /**
+     * 부하 테스트를 준비합니다.
+     *
+     * @param config 부하 테스트 설정
+     * @param service 연결에 사용할 클라이언트 서비스
+     * @return 스크립트나 압축 사전을 읽지 못하면 false
+     */
+    Bool LoadRunner::Init(const LoadConfig& config, SharedPtr<ClientService> service)
+    {
+        mConfig = config;
+        mService = std::move(service);
+
+        if (!mConfig.scriptPath.empty() && !mScript.LoadFile(mConfig.scriptPath))
+        {
+            return false;
+        }
+
+        proto::PacketCompressor& compressor = proto::PacketCompressor::GetInstance();
+        if (!mConfig.dictionaryPath.empty() && !compressor.LoadDictionary(mConfig.dictionaryPath))
+        {
+            return false;
+        }
+        compressor.SetEnabled(mConfig.compression);
+
+        if (!mConfig.trainDictionaryPath.empty())
+        {
+            mTrainer = std::make_unique<proto::DictionaryTrainer>();
+        }
+
+        mStartUs = GetNowUs();
+        mLastTickUs = mStartUs;
+
+        gLogger->Info(TEXT_8("LoadRunner: {} agents, ramp {}/s, duration {} s, {} profiles, compression {}"),
+                      mConfig.agentCount, mConfig.rampPerSec, mConfig.durationSec, mScript.GetProfiles().size(),
+                      mConfig.compression ? TEXT_8("on") : TEXT_8("off"));
+
+        return true;
+    }
+
+    /**
+     * 연결을 요청하고 에이전트를 갱신합니다. 루프 스레드에서 매 틱 호출됩니다.
+     *
+     * 동작:
+     * 1. 경과 시간만큼 연결 토큰을 채움 (최대 1초 분량)
+     * 2. 재시도 대기 중이 아니면 처음 연결할 에이전트와 다시 연결할 에이전트를 토큰 수만큼 연결 요청
+     * 3. 요청이 실패하면 남은 요청은 보내지 않고 토큰과 함께 되돌린 뒤 재시도 간격을 두 배로 늘림
+     *    (최대 세션 수에 걸리면 끊긴 세션이 반환될 때까지 이어지는 요청도 모두 실패)
+     * 4. 모든 에이전트의 행동을 갱신
+     */
+    void LoadRunner::Tick()
+    {
+        if (mStopped.load())
+        {
+            return;
+        }
+
+        const Int64 nowUs = GetNowUs();
+
+        Int64 budget = 0;
+        if (mConfig.rampPerSec > 0)
+        {
+            const Float64 elapsedSec = static_cast<Float64>(nowUs - mLastTickUs) / 1'000'000.0;
+            mConnectTokens = std::min(mConnectTokens + elapsedSec * mConfig.rampPerSec, static_cast<Float64>(mConfig.rampPerSec));
+            budget = static_cast<Int64>(mConnectTokens);
+        }
+        else
+        {
+            budget = mConfig.agentCount;
+        }
+        mLastTickUs = nowUs;
+
+        if (nowUs < mNextConnectUs)
+        {
+            budget = 0;
+        }
+
+        const Int64 initialCount = std::min(budget, mConfig.agentCount - mInitialConnectCount);
+        const Int64 reconnectCount = std::min(budget - initialCount, mReconnectCount.load());
+        const Int64 connectCount = initialCount + reconnectCount;
+        if (connectCount > 0)
+        {
+            mInitialConnectCount += initialCount;
+            mReconnectCount.fetch_sub(reconnectCount);
+            mConnectTokens -= static_cast<Float64>(connectCount);
+
+            for (Int64 i = 0; i < connectCount; ++i)
+            {
+                mStats.connectAttempts.Add();
+                if (mService->Connect(1) == SUCCESS)
+                {
+                    mConnectBackoffUs = 0;
+                    continue;
+                }
+
+                // 실패한 요청과 남은 요청은 재시도 간격이 지난 뒤 다시 연결
+                const Int64 remainingCount = connectCount - i;
+                mStats.connectFailures.Add();
+                mReconnectCount.fetch_add(remainingCount);
+                mConnectTokens += static_cast<Float64>(remainingCount);
+
+                mConnectBackoffUs = std::clamp(mConnectBackoffUs * 2, kMinConnectBackoffUs, kMaxConnectBackoffUs);
+                mNextConnectUs = nowUs + mConnectBackoffUs;
+                break;
+            }
+        }
+
+        mPeakSessionCount = std::max(mPeakSessionCount, mService->GetCurrentSessionCount());
+
+        AgentManager::GetInstance().UpdateAgents(nowUs);
+    }
+
+    // 종료 절차 중 끊기는 연결은 오류로 집계하지 않음
+    void LoadRunner::Stop()
+    {
+        if (mStopped.exchange(true) == false)
+        {
+            mStopUs = GetNowUs();
+        }
+    }
+
+    void LoadRunner::LogProgress(Int64 tickCount)
+    {
+        gLogger->Info(TEXT_8("LoadRunner: Ticks={}, Sessions={}, Agents={}, ChatsSent={}, ChatsReceived={}, Errors={}"),
+                      tickCount, mService->GetCurrentSessionCount(), AgentManager::GetInstance().GetAgentCount(),
+                      mStats.chatsSent.GetValue(), mStats.chatsReceived.GetValue(),
+                      mStats.connectFailures.GetValue() + mStats.unexpectedDisconnects.GetValue() + mStats.enterRoomFailures.GetValue() + mStats.packetErrors.GetValue());
+    }
+
+    /**
+     * 부하 테스트 결과를 출력합니다. 종료 절차가 끝난 뒤 호출합니다.
+     *
+     * 처리량은 시작부터 Stop() 호출까지의 시간으로 계산합니다.
+     */
+    void LoadRunner::Report()
+    {
+        const Int64 endUs = (mStopUs > 0) ? mStopUs : GetNowUs();
+        const Float64 elapsedSec = std::max(static_cast<Float64>(endUs - mStartUs) / 1'000'000.0, 0.001);
+
+        // 세션 송수신 바이트는 Core 세션 메트릭에서 읽음
+        Counter& sentBytes = gMetricRegistry->AddCounter(TEXT_8("net_session_sent_bytes_total"), TEXT_8("Bytes sent by sessions"));
+        Counter& receivedBytes = gMetricRegistry->AddCounter(TEXT_8("net_session_received_bytes_total"), TEXT_8("Bytes received by sessions"));
+        Counter& sentPackets = gMetricRegistry->AddCounter(TEXT_8("net_session_sent_packets_total"), TEXT_8("Send buffers queued to sessions"));
+        Counter& sendCalls = gMetricRegistry->AddCounter(TEXT_8("net_session_send_calls_total"), TEXT_8("WSASend calls issued by sessions"));
+        // 해제 바이트와 시간은 PacketCompressor 메트릭에서 읽음
+        Counter& compressedBytes = gMetricRegistry->AddCounter(TEXT_8("net_decompress_input_bytes_total"), TEXT_8("Compressed payload bytes received"));
+        Counter& decompressedBytes = gMetricRegistry->AddCounter(TEXT_8("net_decompress_output_bytes_total"), TEXT_8("Payload bytes after decompression"));
+        Counter& decompressTimeUs = gMetricRegistry->AddCounter(TEXT_8("net_decompress_microseconds_total"), TEXT_8("Time spent decompressing payloads"));
+
+        gLogger->Info(TEXT_8("==== Load report ({:.1f} s) ===="), elapsedSec);
+        gLogger->Info(TEXT_8("Agents: target={}, peak sessions={}, rooms={} ({:.1f} agents per room)"),
+                      mConfig.agentCount, mPeakSessionCount, mConfig.roomCount,
+                      static_cast<Float64>(mConfig.agentCount) / static_cast<Float64>(mConfig.roomCount));
+        gLogger->Info(TEXT_8("Connections: attempted={}, established={}, failed={}, churned={}, unexpected disconnects={}"),
+                      mStats.connectAttempts.GetValue(), mStats.connects.GetValue(), mStats.connectFailures.GetValue(),
+                      mStats.churnDisconnects.GetValue(), mStats.unexpectedDisconnects.GetValue());
+        gLogger->Info(TEXT_8("Chat: sent={} ({:.1f}/s, {:.1f} KB/s), received={} ({:.1f}/s)"),
+                      mStats.chatsSent.GetValue(), mStats.chatsSent.GetValue() / elapsedSec, mStats.chatBytesSent.GetValue() / elapsedSec / 1'024.0,
+                      mStats.chatsReceived.GetValue(), mStats.chatsReceived.GetValue() / elapsedSec);
+        gLogger->Info(TEXT_8("Network: sent={:.1f} KB/s, received={:.1f} KB/s"),
+                      sentBytes.GetValue() / elapsedSec / 1'024.0, receivedBytes.GetValue() / elapsedSec / 1'024.0);
+        gLogger->Info(TEXT_8("Send calls: {:.1f}/s, {:.2f} buffers per call (batch cap {} us)"),
+                      sendCalls.GetValue() / elapsedSec,
+                      static_cast<Float64>(sentPackets.GetValue()) / std::max<Int64>(sendCalls.GetValue(), 1),
+                      SendBatch::GetLatencyCapUs());
+        gLogger->Info(TEXT_8("Compression: sessions={}, received {} -> {} bytes (ratio {:.2f}), decompress CPU={:.1f} ms ({:.2f} us/KB)"),
+                      mStats.compressionSessions.GetValue(), compressedBytes.GetValue(), decompressedBytes.GetValue(),
+                      static_cast<Float64>(decompressedBytes.GetValue()) / std::max<Int64>(compressedBytes.GetValue(), 1),
+                      decompressTimeUs.GetValue() / 1'000.0,
+                      decompressTimeUs.GetValue() / std::max(decompressedBytes.GetValue() / 1'024.0, 1.0));
+        LogLatency(TEXT_8("Enter room RTT"), mStats.enterRoomRtt);
+        LogLatency(TEXT_8("Chat latency"), mStats.chatLatency);
+        gLogger->Info(TEXT_8("Ping: sent={}, received={}"), mStats.pingsSent.GetValue(), mStats.pongsReceived.GetValue());
+        LogLatency(TEXT_8("Ping RTT"), mStats.pingRtt);
+        LogLatency(TEXT_8("  network"), mStats.pingNetwork);
+        LogLatency(TEXT_8("  server tick wait"), mStats.pingTickWait);
+        LogLatency(TEXT_8("  server queue"), mStats.pingQueue);
+        LogLatency(TEXT_8("  server handler"), mStats.pingHandler);
+        LogLatency(TEXT_8("  server egress"), mStats.pingEgress);
+        LogLatency(TEXT_8("  client queue"), mStats.pingClientQueue);
+        gLogger->Info(TEXT_8("Errors: connect={}, disconnect={}, enter room={}, packet={}"),
+                      mStats.connectFailures.GetValue(), mStats.unexpectedDisconnects.GetValue(),
+                      mStats.enterRoomFailures.GetValue(), mStats.packetErrors.GetValue());
+    }
+
+    // 수신한 페이로드로 사전을 학습해 저장합니다. 루프 스레드가 종료된 뒤 호출합니다.
+    void LoadRunner::SaveDictionary()
+    {
+        if (mTrainer)
+        {
+            mTrainer->Train(mConfig.trainDictionaryPath);
+        }
+    }
+
+    /**
+     * 연결된 세션에 사용할 에이전트 프로필을 정합니다.
+     *
+     * @return 끊긴 에이전트의 프로필이 있으면 그 프로필, 없으면 스크립트 가중치에 따른 다음 프로필
+     *
+     * 끊긴 에이전트의 프로필을 다시 사용하므로 재접속이 반복되어도 프로필 비율이 유지됩니다.
+     */
+    const AgentProfile& LoadRunner::OnConnected()
+    {
+        mStats.connects.Add();
+
+        const AgentProfile* profile = nullptr;
+        if (mReconnectProfiles.try_dequeue(profile))
+        {
+            return *profile;
+        }
+
+        return mScript.SelectProfile(mNextProfileIndex.fetch_add(1));
+    }
+
+    void LoadRunner::OnConnectFailed()
+    {
+        mStats.connectFailures.Add();
+        if (!mStopped.load())
+        {
+            mReconnectCount.fetch_add(1);
+        }
+    }
+
+    /**
+     * 에이전트 연결이 끊겼을 때 호출됩니다.
+     *
+     * @param profile 끊긴 에이전트의 프로필
+     * @param churned 재접속 주기에 따라 에이전트가 직접 끊었으면 true
+     */
+    void LoadRunner::OnDisconnected(const AgentProfile& profile, Bool churned)
+    {
+        if (mStopped.load())
+        {
+            return;
+        }
+
+        if (churned)
+        {
+            mStats.churnDisconnects.Add();
+        }
+        else
+        {
+            mStats.unexpectedDisconnects.Add();
+        }
+
+        mReconnectProfiles.enqueue(&profile);
+        mReconnectCount.fetch_add(1);
+    }
+
+    Int64 LoadRunner::GetNowUs()
+    {
+        return GetSteadyNowUs();
+    }
+
+    void LoadRunner::LogLatency(const Char8* name, const Histogram& histogram)
+    {
+        auto snapshot = std::make_unique<Histogram::Snapshot>();
+        histogram.TakeSnapshot(OUT *snapshot);
+
+        gLogger->Info(TEXT_8("{} (us): count={}, mean={:.0f}, p50={}, p90={}, p99={}, p99.9={}, max={}"),
+                      name, snapshot->totalCount, snapshot->GetMean(),
+                      snapshot->GetPercentile(50.0), snapshot->GetPercentile(90.0), snapshot->GetPercentile(99.0),
+                      snapshot->GetPercentile(99.9), snapshot->max);
+    }
+} // namespace dummy
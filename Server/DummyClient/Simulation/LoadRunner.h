@@ -0,0 +1,144 @@
+﻿/*    DummyClient/Simulation/LoadRunner.h    */
+
+#pragma once
+
+#include "DummyClient/Simulation/Script.h"
+
+namespace core
+{
+    class ClientService;
+    class Counter;
+    class Histogram;
+}
+
+namespace proto
+{
+    class DictionaryTrainer;
+}
+
+namespace dummy
+{
+    struct LoadConfig
+    {
+        Int64       agentCount = 1'000;     // 유지할 에이전트 수
+        Int64       roomCount = 500;        // 에이전트를 분산시킬 룸 수 (로비 제외, 룸 ID 1부터)
+        Int64       rampPerSec = 200;       // 초당 새 연결 수 (0이면 한 번에 모두 연결)
+        Int64       durationSec = 0;        // 실행 시간 (0이면 종료 요청까지)
+        String8     scriptPath;             // 에이전트 행동 스크립트 (비어 있으면 기본 스크립트)
+        Int64       pingIntervalMs = 1'000; // 에이전트별 지연 측정 핑 간격 (0이면 보내지 않음)
+        Bool        compression = false;    // 연결마다 C2S_Hello로 zstd 압축 요청
+        String8     dictionaryPath;         // 압축 사전 파일 (서버와 같은 사전이어야 함)
+        String8     trainDictionaryPath;    // 수신한 페이로드로 사전을 학습해 종료 시 저장할 경로
+    };
+
+    /*
+     * LoadStats - 부하 테스트 통계
+     *
+     * 메트릭 레지스트리에 dummy_* 이름으로 등록하므로 핫 경로 비용은 샤드 카운터 갱신뿐입니다.
+     *
+     * 핑 왕복 시간 분해:
+     *     RTT = 네트워크(양쪽 커널 + 선로 + 퐁 송신) + 서버 틱 대기 + 서버 큐 대기 + 서버 핸들러
+     * 서버 송신 시간은 직전 퐁의 값이며 클라이언트 큐 대기는 RTT에 포함되지 않습니다.
+     */
+    struct LoadStats
+    {
+        LoadStats();
+
+        core::Counter&      connectAttempts;
+        core::Counter&      connects;
+        core::Counter&      connectFailures;
+        core::Counter&      churnDisconnects;
+        core::Counter&      unexpectedDisconnects;
+        core::Counter&      enterRoomFailures;
+        core::Counter&      packetErrors;
+        core::Counter&      chatsSent;
+        core::Counter&      chatBytesSent;
+        core::Counter&      chatsReceived;
+        core::Histogram&    enterRoomRtt;
+        core::Histogram&    chatLatency;
+        core::Counter&      pingsSent;
+        core::Counter&      pongsReceived;
+        core::Histogram&    pingRtt;
+        core::Histogram&    pingNetwork;
+        core::Histogram&    pingTickWait;
+        core::Histogram&    pingQueue;
+        core::Histogram&    pingHandler;
+        core::Histogram&    pingEgress;
+        core::Histogram&    pingClientQueue;
+        core::Counter&      compressionSessions;
+    };
+
+    /*
+     * LoadRunner - 더미 클라이언트 부하 테스트 진행
+     *
+     * 주요 기능:
+     * - 초당 연결 수를 제한해 목표 에이전트 수까지 점진적으로 연결 (ramp-up)
+     * - 재접속 주기로 끊겼거나 예기치 않게 끊긴 에이전트를 같은 속도 제한과 같은 프로필로 다시 연결
+     * - 연결 요청이 실패하면(최대 세션 수에 걸린 경우 등) 남은 요청을 되돌리고 간격을 두 배씩 늘리며 재시도
+     * - 루프 틱마다 모든 에이전트의 행동을 갱신
+     * - 종료 시 연결/오류 수, 처리량, 왕복 시간 백분위수를 보고
+     *
+     * 스레드 규칙:
+     * - Tick()은 루프 스레드에서만 호출
+     * - On*() 통지는 입출력 스레드에서 호출
+     */
+    class LoadRunner
+    {
+    public:
+        static LoadRunner& GetInstance()
+        {
+            static LoadRunner sInstance;
+            return sInstance;
+        }
+
+        Bool                Init(const LoadConfig& config, SharedPtr<core::ClientService> service);
+        void                Tick();
+        void                Stop();
+        void                LogProgress(Int64 tickCount);
+        void                Report();
+        void                SaveDictionary();
+
+        const AgentProfile& OnConnected();
+        void                OnConnectFailed();
+        void                OnDisconnected(const AgentProfile& profile, Bool churned);
+
+        const LoadConfig&   GetConfig() const { return mConfig; }
+        const AgentScript&  GetScript() const { return mScript; }
+        LoadStats&          GetStats() { return mStats; }
+        // 사전 학습 중이 아니면 nullptr (루프 스레드에서만 사용)
+        proto::DictionaryTrainer*   GetTrainer() { return mTrainer.get(); }
+
+    public:
+        static Int64        GetNowUs();
+
+    private:
+        LoadRunner();
+        ~LoadRunner();
+
+        void                LogLatency(const Char8* name, const core::Histogram& histogram);
+
+    private:
+        static constexpr Int64      kMinConnectBackoffUs = 10'000;
+        static constexpr Int64      kMaxConnectBackoffUs = 1'000'000;
+
+    private:
+        LoadConfig                      mConfig;
+        AgentScript                     mScript;
+        LoadStats                       mStats;
+        SharedPtr<core::ClientService>  mService;
+        UniquePtr<proto::DictionaryTrainer> mTrainer;
+
+        Int64                           mStartUs = 0;
+        Int64                           mStopUs = 0;
+        Int64                           mLastTickUs = 0;
+        Float64                         mConnectTokens = 0.0;
+        Int64                           mInitialConnectCount = 0;   // 처음 연결을 요청한 에이전트 수
+        Int64                           mConnectBackoffUs = 0;      // 연결 요청 실패 후 재시도 간격 (실패가 없으면 0)
+        Int64                           mNextConnectUs = 0;         // 연결 요청을 다시 시작할 시각
+        Atomic<Int64>                   mReconnectCount = 0;        // 다시 연결해야 할 에이전트 수
+        LockfreeQueue<const AgentProfile*>  mReconnectProfiles;     // 끊긴 에이전트의 프로필 (재접속 시 그대로 사용)
+        Atomic<Int64>                   mNextProfileIndex = 0;
+        Int64                           mPeakSessionCount = 0;
+        Atomic<Bool>                    mStopped = false;
+    };
+} // namespace dummy
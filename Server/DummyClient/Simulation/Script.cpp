@@ -0,0 +1,100 @@
+﻿/*    DummyClient/Simulation/Script.cpp    */
+
+#include "DummyClient/Pch.h"
+#include "DummyClient/Simulation/Script.h"
+#include <sstream>
+
+namespace dummy
+{
+    /**
+     * 기본 스크립트로 초기화합니다.
+     *
+     * 절반은 접속만 유지하고, 나머지는 채팅하거나 주기적으로 재접속합니다.
+     */
+    AgentScript::AgentScript()
+        : mProfiles({
+            {TEXT_8("idle"), 50, 0.0, 0, 0},
+            {TEXT_8("chatter"), 40, 1.0, 64, 0},
+            {TEXT_8("churner"), 10, 0.5, 32, 30'000},
+        })
+        , mTotalWeight(100)
+    {}
+
+    /**
+     * 스크립트 파일을 읽어 프로필을 교체합니다.
+     *
+     * @param path 스크립트 파일 경로
+     * @return 유효한 프로필이 하나 이상 있으면 true (실패하면 기존 프로필 유지)
+     */
+    Bool AgentScript::LoadFile(const String8& path)
+    {
+        std::ifstream file(path);
+        if (!file.is_open())
+        {
+            core::gLogger->Error(TEXT_8("AgentScript: Failed to open {}"), path);
+            return false;
+        }
+
+        Vector<AgentProfile> profiles;
+        Int64 totalWeight = 0;
+
+        String8 line;
+        Int64 lineNumber = 0;
+        while (std::getline(file, line))
+        {
+            ++lineNumber;
+
+            std::istringstream stream(line);
+            AgentProfile profile;
+            Float64 lifetimeSec = 0.0;
+            if (!(stream >> profile.name) || (profile.name[0] == '#'))
+            {
+                continue;
+            }
+
+            if (!(stream >> profile.weight >> profile.chatPerSec >> profile.messageSize >> lifetimeSec) ||
+                (profile.weight <= 0) || (profile.chatPerSec < 0.0) || (profile.messageSize < 0) || (lifetimeSec < 0.0))
+            {
+                core::gLogger->Warn(TEXT_8("AgentScript: Invalid profile at {}:{}"), path, lineNumber);
+                continue;
+            }
+
+            profile.messageSize = std::min(profile.messageSize, kMaxMessageSize);
+            profile.lifetimeMs = static_cast<Int64>(lifetimeSec * 1'000.0);
+            totalWeight += profile.weight;
+            profiles.push_back(std::move(profile));
+        }
+
+        if (profiles.empty())
+        {
+            core::gLogger->Error(TEXT_8("AgentScript: No profile in {}"), path);
+            return false;
+        }
+
+        mProfiles = std::move(profiles);
+        mTotalWeight = totalWeight;
+
+        for (const AgentProfile& profile : mProfiles)
+        {
+            core::gLogger->Info(TEXT_8("AgentScript: Profile {} (weight={}, chat={}/s, size={}, lifetime={} ms)"),
+                                profile.name, profile.weight, profile.chatPerSec, profile.messageSize, profile.lifetimeMs);
+        }
+
+        return true;
+    }
+
+    const AgentProfile& AgentScript::SelectProfile(Int64 index) const
+    {
+        Int64 slot = index % mTotalWeight;
+        for (const AgentProfile& profile : mProfiles)
+        {
+            if (slot < profile.weight)
+            {
+                return profile;
+            }
+            slot -= profile.weight;
+        }
+
+        return mProfiles.back();
+    }
+} // namespace dummy
@@ -0,0 +1,53 @@
+﻿/*    DummyClient/Simulation/Script.h    */
+
+#pragma once
+
+namespace dummy
+{
+    /*
+     * AgentProfile - 에이전트 행동 프로필
+     *
+     * 채팅 빈도, 메시지 크기, 재접속 주기를 지정합니다.
+     * 값이 0이면 해당 행동을 하지 않습니다.
+     */
+    struct AgentProfile
+    {
+        String8     name;
+        Int64       weight = 1;         // 프로필 선택 가중치
+        Float64     chatPerSec = 0.0;   // 초당 채팅 횟수
+        Int64       messageSize = 0;    // 채팅 메시지 크기 (바이트)
+        Int64       lifetimeMs = 0;     // 접속 유지 시간, 지나면 끊고 다시 접속 (0이면 유지)
+    };
+
+    /*
+     * AgentScript - 에이전트 행동 스크립트
+     *
+     * 스크립트 파일 형식 (한 줄에 프로필 하나, '#'으로 시작하면 주석):
+     *     <name> <weight> <chatPerSec> <messageSize> <lifetimeSec>
+     *
+     * 예시:
+     *     idle     50  0    0   0
+     *     chatter  40  1    64  0
+     *     churner  10  0.5  32  30
+     *
+     * 선택 순번을 가중치 합으로 나눈 나머지로 프로필을 선택하므로
+     * 연속해서 선택한 프로필은 가중치 비율대로 고르게 나뉩니다.
+     */
+    class AgentScript
+    {
+    public:
+        AgentScript();
+
+        Bool                        LoadFile(const String8& path);
+        const AgentProfile&         SelectProfile(Int64 index) const;
+        const Vector<AgentProfile>& GetProfiles() const { return mProfiles; }
+
+    public:
+        // 서버가 거부하지 않도록 서버의 채팅 최대 크기(ChatCommand::kMaxMessageSize)와 같게 제한
+        static constexpr Int64      kMaxMessageSize = 512;
+
+    private:
+        Vector<AgentProfile>        mProfiles;
+        Int64                       mTotalWeight = 0;
+    };
+} // namespace dummy
@@ -4,103 +4,351 @@
 #include "GameServer/Chat/Room.h"
 #include "GameServer/Entity/Player.h"
 #include "Core/Network/Session.h"
+#include "Protocol/Packet/Compression.h"
 
 using namespace core;
 
 namespace game
 {
-    void Room::Enter(SharedPtr<Player> player)
+    Room::Room(RoomId id)
+        : mId(id)
+        , mLastActiveTick(::GetTickCount64())
+    {}
+
+    /**
+     * 플레이어를 룸에 입장시킵니다.
+     *
+     * @param player 입장할 플레이어
+     * @return 입장에 성공하면 true, 닫힌 룸이거나 이미 입장한 플레이어면 false
+     *
+     * 동작:
+     * 1. 룸이 닫히지 않았으면 멤버 수를 원자적으로 증가
+     * 2. 플레이어를 멤버 맵에 추가
+     * 3. 추가에 실패하면 증가시킨 멤버 수를 되돌림
+     */
+    Bool Room::Enter(SharedPtr<Player> player)
     {
-        Bool result = true;
+        Int64 memberCount = mMemberCount.load();
+        do
         {
-            WRITE_GUARD;
-            // 플레이어 추가
-            result = mPlayers.insert({player->GetId(), player}).second;
+            if (memberCount == kClosedCount)
+            {
+                return false;
+            }
         }
+        while (!mMemberCount.compare_exchange_weak(OUT memberCount, memberCount + 1));
+
+        mLastActiveTick.store(::GetTickCount64());
+
+        // 플레이어 추가
+        const Bool result = mPlayers.Insert(player->GetId(), player);
 
         if (result)
         {
-            gLogger->Info(TEXT_8("Player[{}]: Entered room"), player->GetId());
+            LOG_INFO(Game, TEXT_8("Player[{}]: Entered room[{}]"), player->GetId(), mId);
         }
         else
         {
-            gLogger->Error(TEXT_8("Player[{}]: Failed to enter room"), player->GetId());
+            mMemberCount.fetch_sub(1);
+            gLogger->Error(TEXT_8("Player[{}]: Failed to enter room[{}]"), player->GetId(), mId);
         }
+
+        return result;
     }
 
     void Room::Leave(Int64 playerId)
     {
-        Bool result = true;
-        {
-            WRITE_GUARD;
-            // 플레이어 제거
-            result = (mPlayers.erase(playerId) > 0);
-        }
+        // 플레이어 제거
+        const Bool result = mPlayers.Erase(playerId);
 
         if (result)
         {
-            gLogger->Info(TEXT_8("Player[{}]: Left room"), playerId);
+            mMemberCount.fetch_sub(1);
+            mLastActiveTick.store(::GetTickCount64());
+            LOG_INFO(Game, TEXT_8("Player[{}]: Left room[{}]"), playerId, mId);
         }
         else
         {
-            gLogger->Error(TEXT_8("Player[{}]: Failed to leave room"), playerId);
+            gLogger->Error(TEXT_8("Player[{}]: Failed to leave room[{}]"), playerId, mId);
         }
+    }
 
+    void Room::Broadcast(Vector<SharedPtr<SendBuffer>> frames, Int64 playerId)
+    {
+        CompressedBroadcast compressed;
+        BroadcastCached(frames, playerId, compressed);
     }
 
-    void Room::Broadcast(SharedPtr<SendBuffer> buffer, Int64 playerId)
+    /**
+     * 자신을 제외한 모든 플레이어에게 메시지를 전송합니다.
+     *
+     * @param frames 압축하지 않은 메시지의 프레임 목록 (MakeSendBuffers의 결과)
+     * @param playerId 제외할 플레이어 ID (0이면 모두에게 전송)
+     * @param compressed 압축 결과 캐시 (같은 메시지를 반복해서 보내면 재사용)
+     *
+     * 동작:
+     * 1. 프레임 목록이 비어 있으면 (메시지 생성 실패) 아무것도 전송하지 않음
+     * 2. 단일 프레임 메시지는 압축을 협상한 플레이어가 처음 나올 때 한 번 압축해 캐시
+     * 3. 압축 효과가 있으면 압축된 프레임을, 아니면 원본 프레임들을 한 번에 전송
+     * 4. 모든 플레이어가 같은 송신 버퍼를 공유하므로 플레이어 수와 관계없이 압축은 한 번
+     */
+    void Room::BroadcastCached(const Vector<SharedPtr<SendBuffer>>& frames, Int64 playerId, CompressedBroadcast& compressed)
     {
-        Vector<SharedPtr<Player>> targets;
+        if (frames.empty())
         {
-            WRITE_GUARD;
-            // 자신을 제외한 모든 플레이어 대상
-            for (auto& [id, player] : mPlayers)
-            {
-                if (id == playerId)
-                {
-                    continue;
-                }
-                targets.push_back(player);
-            }
+            return;
         }
 
-        // 메시지 전송
-        for (auto& player : targets)
+        Int64 frameBytes = 0;
+        for (const auto& frame : frames)
         {
-            player->SendAsync(buffer);
+            frameBytes += frame->GetWrittenSize();
         }
 
-        gLogger->Info(TEXT_8("Player[{}]: Broadcasted message"), playerId);
+        // 여러 프레임으로 나뉜 메시지는 이미 큰 메시지이므로 압축하지 않고 그대로 전송
+        if (frames.size() > 1)
+        {
+            compressed.isAttempted = true;
+        }
+
+        Int64 sentCount = 0;
+        Int64 sentBytes = 0;
+
+        mPlayers.ForEach([&frames, &compressed, &sentCount, &sentBytes, frameBytes, playerId](Int64 id, const SharedPtr<Player>& player)
+                         {
+                             if (id == playerId)
+                             {
+                                 return;
+                             }
+
+                             if (player->IsCompressionEnabled())
+                             {
+                                 if (!compressed.isAttempted)
+                                 {
+                                     compressed.isAttempted = true;
+                                     compressed.frames = proto::PacketCompressor::GetInstance().Compress(frames.front());
+                                     for (const auto& frame : compressed.frames)
+                                     {
+                                         compressed.size += frame->GetWrittenSize();
+                                     }
+                                 }
+
+                                 if (!compressed.frames.empty())
+                                 {
+                                     player->SendAsync(compressed.frames);
+                                     ++sentCount;
+                                     sentBytes += compressed.size;
+                                     return;
+                                 }
+                             }
+
+                             player->SendAsync(frames);
+                             ++sentCount;
+                             sentBytes += frameBytes;
+                         });
+
+        mBroadcastCount.fetch_add(1, std::memory_order_relaxed);
+        mMessageCount.fetch_add(sentCount, std::memory_order_relaxed);
+        mByteCount.fetch_add(sentBytes, std::memory_order_relaxed);
+
+        LOG_DEBUG_RATE(Game, 10, TEXT_8("Player[{}]: Broadcasted message in room[{}]"), playerId, mId);
     }
 
-    void Room::StartBroadcastLoop(SharedPtr<SendBuffer> buffer, Int64 loopMs)
+    /**
+     * 룸이 닫힐 때까지 주기적으로 모든 플레이어에게 메시지를 전송합니다. Spawn()으로 시작합니다.
+     *
+     * @param frames 전송할 메시지의 프레임 목록
+     * @param loopMs 전송 주기(밀리초)
+     */
+    Task Room::RunBroadcastLoop(Vector<SharedPtr<SendBuffer>> frames, Int64 loopMs)
     {
-        const Int64 nextTick = ::GetTickCount64() + loopMs;
+        // 같은 메시지를 반복해서 보내므로 압축 결과도 재사용
+        CompressedBroadcast compressed;
 
-        Vector<SharedPtr<Player>> targets;
+        while (!IsClosed())
         {
-            WRITE_GUARD;
-            // 모든 플레이어 대상
-            for (auto& [id, player] : mPlayers)
+            const Int64 nextTick = ::GetTickCount64() + loopMs;
+
+            // 모든 플레이어에게 메시지 전송
+            BroadcastCached(frames, 0, compressed);
+
+            // 다음 주기까지 대기
+            co_await SleepFor(nextTick - ::GetTickCount64());
+        }
+    }
+
+    /**
+     * 유휴 상태인 룸을 닫습니다.
+     *
+     * @param idleMs 멤버가 없는 상태로 유지되어야 하는 최소 시간(밀리초)
+     * @return 룸을 닫았으면 true
+     *
+     * 동작:
+     * 1. 마지막 입장/퇴장 이후 지정된 시간이 지나지 않았으면 실패
+     * 2. 멤버 수가 0일 때만 원자적으로 닫힘 상태로 변경
+     * 3. 닫힌 룸에는 더 이상 입장할 수 없음
+     */
+    Bool Room::TryClose(Int64 idleMs)
+    {
+        if (static_cast_64(::GetTickCount64()) - mLastActiveTick.load() < idleMs)
+        {
+            return false;
+        }
+
+        Int64 expected = 0;
+        return mMemberCount.compare_exchange_strong(OUT expected, kClosedCount);
+    }
+
+    RoomStats Room::GetStats() const
+    {
+        RoomStats stats;
+        stats.memberCount = std::max<Int64>(mMemberCount.load(), 0);
+        stats.broadcastCount = mBroadcastCount.load(std::memory_order_relaxed);
+        stats.messageCount = mMessageCount.load(std::memory_order_relaxed);
+        stats.byteCount = mByteCount.load(std::memory_order_relaxed);
+
+        return stats;
+    }
+
+    SharedPtr<Room> RoomManager::FindRoom(RoomId id)
+    {
+        // 락 없이 현재 스냅샷에서 룸 찾기
+        return mRooms.Find(id);
+    }
+
+    /**
+     * 룸을 찾고, 없으면 생성합니다.
+     *
+     * @param id 룸 ID (IsValidRoomId로 검사한 ID)
+     * @return 열려 있는 룸
+     *
+     * 동작:
+     * 1. 락 없이 조회해서 열려 있는 룸이 있으면 반환
+     * 2. 생성 락을 획득한 뒤 다시 조회 (다른 스레드가 먼저 생성했을 수 있음)
+     * 3. 닫힌 룸이 남아 있으면 제거
+     * 4. 새 룸을 생성하고 룸 ID로 잡 워커 친화도를 지정한 뒤 등록
+     */
+    SharedPtr<Room> RoomManager::GetOrCreateRoom(RoomId id)
+    {
+        ASSERT_CRASH_DEBUG(IsValidRoomId(id), "INVALID_ROOM_ID");
+
+        SharedPtr<Room> room = mRooms.Find(id);
+        if (room && !room->IsClosed())
+        {
+            return room;
+        }
+
+        SrwLockWriteGuard guard(mCreateLock);
+
+        room = mRooms.Find(id);
+        if (room)
+        {
+            if (!room->IsClosed())
             {
-                targets.push_back(player);
+                return room;
             }
+            mRooms.Erase(id);
         }
 
-        // 메시지 전송
-        for (auto& player : targets)
+        room = std::make_shared<Room>(id);
+        // 같은 룸의 작업은 항상 같은 잡 워커에서 처리
+        room->SetAffinity(static_cast_32(id & 0x7FFF'FFFF));
+        mRooms.Insert(id, room);
+
+        gLogger->Info(TEXT_8("Room[{}]: Created"), id);
+
+        return room;
+    }
+
+    /**
+     * 플레이어를 룸에 입장시킵니다. 룸이 없으면 생성합니다.
+     *
+     * @param id 룸 ID
+     * @param player 입장할 플레이어
+     * @return 입장 성공 여부
+     *
+     * 동작:
+     * 1. 룸을 찾거나 생성한 뒤 입장 시도
+     * 2. 입장 직전에 룸이 회수되어 닫혔으면 다시 생성해서 재시도
+     */
+    Bool RoomManager::EnterRoom(RoomId id, SharedPtr<Player> player)
+    {
+        while (true)
         {
-            player->SendAsync(buffer);
+            SharedPtr<Room> room = GetOrCreateRoom(id);
+            if (room->Enter(player))
+            {
+                return true;
+            }
+
+            if (!room->IsClosed())
+            {
+                return false;
+            }
+        }
+    }
+
+    /**
+     * 유휴 룸을 회수합니다. 게임 루프에서 매 틱 호출됩니다.
+     *
+     * 동작:
+     * 1. 회수 주기가 되지 않았으면 종료
+     * 2. 로비를 제외하고 유휴 시간이 지난 빈 룸을 닫음
+     * 3. 생성 락을 획득한 뒤 맵에 남아 있는 닫힌 룸을 제거
+     * 4. 전체 룸 통계 출력
+     */
+    void RoomManager::SweepIdleRooms()
+    {
+        const Int64 nowTick = ::GetTickCount64();
+        if (nowTick < mNextSweepTick)
+        {
+            return;
+        }
+        mNextSweepTick = nowTick + kSweepIntervalMs;
+
+        Vector<SharedPtr<Room>> closedRooms;
+        mRooms.ForEach([&closedRooms](RoomId id, const SharedPtr<Room>& room)
+                       {
+                           if ((id != kLobbyRoomId) && room->TryClose(kIdleTimeoutMs))
+                           {
+                               closedRooms.push_back(room);
+                           }
+                       });
+
+        if (!closedRooms.empty())
+        {
+            SrwLockWriteGuard guard(mCreateLock);
+
+            for (const auto& room : closedRooms)
+            {
+                // 그 사이 새 룸으로 교체되지 않았을 때만 제거
+                if (mRooms.Find(room->GetId()) == room)
+                {
+                    mRooms.Erase(room->GetId());
+                }
+            }
         }
 
-        gLogger->Info(TEXT_8("Room: Broadcasted message to all players"));
+        gLogger->Info(TEXT_8("RoomManager: Reclaimed {} idle rooms"), closedRooms.size());
+
+        LogStats();
+    }
 
-        const Int64 delayMs = nextTick - ::GetTickCount64();
+    void RoomManager::LogStats()
+    {
+        Int64 roomCount = 0;
+        RoomStats total;
+        mRooms.ForEach([&roomCount, &total](RoomId id, const SharedPtr<Room>& room)
+                       {
+                           const RoomStats stats = room->GetStats();
+                           ++roomCount;
+                           total.memberCount += stats.memberCount;
+                           total.broadcastCount += stats.broadcastCount;
+                           total.messageCount += stats.messageCount;
+                           total.byteCount += stats.byteCount;
+                       });
 
-        // 다음 루프 예약
-        ScheduleJob(delayMs, [self = shared_from_this(), buffer, loopMs]()
-                    {
-                        std::static_pointer_cast<Room>(self)->StartBroadcastLoop(buffer, loopMs);
-                    });
+        gLogger->Info(TEXT_8("RoomManager: Rooms={}, Members={}, Broadcasts={}, Messages={}, Bytes={}"),
+                      roomCount, total.memberCount, total.broadcastCount, total.messageCount, total.byteCount);
     }
 } // namespace game
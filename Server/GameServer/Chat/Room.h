@@ -2,21 +2,108 @@
 
 #pragma once
 
+#include "Core/Concurrency/Rcu.h"
+
 namespace game
 {
     class Player;
 
+    using RoomId = Int64;
+
+    struct RoomStats
+    {
+        Int64       memberCount = 0;
+        Int64       broadcastCount = 0;
+        Int64       messageCount = 0;
+        Int64       byteCount = 0;
+    };
+
+    // 브로드캐스트할 메시지의 압축 결과 (압축을 협상한 플레이어가 처음 나올 때 한 번만 압축)
+    struct CompressedBroadcast
+    {
+        Bool                                    isAttempted = false;
+        Vector<SharedPtr<core::SendBuffer>>     frames; // 압축 효과가 없으면 비어 있음
+        Int64                                   size = 0;
+    };
+
     class Room
         : public core::JobSerializer
     {
     public:
-        void        Enter(SharedPtr<Player> player);
+        Room(RoomId id);
+
+        Bool        Enter(SharedPtr<Player> player);
         void        Leave(Int64 playerId);
-        void        Broadcast(SharedPtr<core::SendBuffer> buffer, Int64 playerId = 0);
-        void        StartBroadcastLoop(SharedPtr<core::SendBuffer> buffer, Int64 loopMs);
+        void        Broadcast(Vector<SharedPtr<core::SendBuffer>> frames, Int64 playerId = 0);
+        core::Task  RunBroadcastLoop(Vector<SharedPtr<core::SendBuffer>> frames, Int64 loopMs);
+        Bool        TryClose(Int64 idleMs);
+
+        RoomId      GetId() const { return mId; }
+        Bool        IsClosed() const { return mMemberCount.load() == kClosedCount; }
+        RoomStats   GetStats() const;
+
+    private:
+        // 닫힌 룸의 멤버 수
+        static constexpr Int64      kClosedCount = -1;
+
+    private:
+        void        BroadcastCached(const Vector<SharedPtr<core::SendBuffer>>& frames, Int64 playerId, CompressedBroadcast& compressed);
+
+    private:
+        RoomId                                  mId;
+        core::RcuMap<Int64, SharedPtr<Player>>  mPlayers;
+
+        Atomic<Int64>               mMemberCount = 0;
+        Atomic<Int64>               mLastActiveTick;
+        Atomic<Int64>               mBroadcastCount = 0;
+        Atomic<Int64>               mMessageCount = 0;
+        Atomic<Int64>               mByteCount = 0;
+    };
+
+    /*
+     * RoomManager - 룸(채널) 관리 클래스
+     *
+     * 주요 기능:
+     * - 룸 ID로 락 없이 조회 (RcuMap 스냅샷)
+     * - 처음 요청될 때 룸을 생성하고 잡 워커 친화도를 지정 (ID는 [0, kMaxRoomCount) 범위만 허용)
+     * - 멤버가 없는 상태로 일정 시간이 지난 룸을 주기적으로 회수
+     * - 전체 룸의 멤버/브로드캐스트 통계 집계
+     */
+    class RoomManager
+    {
+    public:
+        static RoomManager& GetInstance()
+        {
+            static RoomManager sInstance;
+            return sInstance;
+        }
+
+        SharedPtr<Room>         FindRoom(RoomId id);
+        SharedPtr<Room>         GetOrCreateRoom(RoomId id);
+        Bool                    EnterRoom(RoomId id, SharedPtr<Player> player);
+        void                    SweepIdleRooms();
+
+        // 클라이언트가 보낸 ID로 룸이 무제한 생성되지 않도록 범위 검사
+        static Bool             IsValidRoomId(RoomId id) { return (id >= kLobbyRoomId) && (id < kMaxRoomCount); }
+
+    public:
+        // 회수 대상에서 제외되는 기본 룸
+        static constexpr RoomId     kLobbyRoomId = 0;
+        // 동시에 존재할 수 있는 룸 ID의 범위
+        static constexpr RoomId     kMaxRoomCount = 10'000;
+
+    private:
+        RoomManager() = default;
+
+        void                    LogStats();
+
+    private:
+        static constexpr Int64      kIdleTimeoutMs = 30'000;
+        static constexpr Int64      kSweepIntervalMs = 10'000;
 
     private:
-        RW_LOCK;
-        HashMap<Int64, SharedPtr<Player>>   mPlayers;
+        SRWLOCK                                     mCreateLock = SRWLOCK_INIT;
+        core::RcuMap<RoomId, SharedPtr<Room>>       mRooms;
+        Int64                                       mNextSweepTick = 0;
     };
 } // namespace game
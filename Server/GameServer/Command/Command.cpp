@@ -0,0 +1,134 @@
+﻿/*    GameServer/Command/Command.cpp    */
+
+#include "GameServer/Pch.h"
+#include "GameServer/Command/Command.h"
+#include "GameServer/Core/World.h"
+#include "GameServer/Network/Session.h"
+#include "Protocol/Packet/Utils.h"
+
+namespace game
+{
+    namespace
+    {
+        /**
+         * 세션의 플레이어를 방과 월드에서 제거합니다. 게임 루프 스레드에서만 호출합니다.
+         *
+         * 동작:
+         * 1. 세션의 플레이어/방 ID를 읽고 초기화 (입장한 적이 없으면 종료)
+         * 2. 방에서 퇴장, 월드에서 디스폰, 플레이어 매니저에서 제거
+         */
+        void LeaveCurrentRoom(ClientSession& clientSession, World& world)
+        {
+            const PlayerId playerId = clientSession.GetPlayerId();
+            const RoomId roomId = clientSession.GetRoomId();
+            if (playerId == 0)
+            {
+                return;
+            }
+
+            clientSession.SetPlayerId(0);
+            clientSession.SetRoomId(0);
+
+            // 방에서 퇴장
+            SharedPtr<Room> room = RoomManager::GetInstance().FindRoom(roomId);
+            if (room)
+            {
+                room->Leave(playerId);
+            }
+
+            // 월드에서 디스폰
+            world.DespawnPlayer(playerId);
+
+            // 플레이어 매니저에서 제거
+            PlayerManager::GetInstance().RemovePlayer(playerId);
+        }
+    } // namespace
+
+    /**
+     * 플레이어를 생성하여 방에 입장시킵니다.
+     *
+     * @param world 명령이 실행될 월드 객체
+     *
+     * 동작:
+     * 1. 범위를 벗어난 방 ID면 실패 응답 후 종료
+     * 2. 이미 다른 방에 입장한 세션이면 이전 방과 월드에서 먼저 퇴장
+     * 3. 플레이어 생성 및 매니저에 추가
+     * 4. 방 입장 (없으면 생성), 성공 시 세션에 방 ID 기록
+     * 5. 월드에 스폰
+     * 6. 방 입장 결과 패킷 전송
+     */
+    void EnterRoomCommand::Execute(World& world)
+    {
+        auto clientSession = std::static_pointer_cast<ClientSession>(session);
+
+        proto::S2C_EnterRoom enterRoom;
+        enterRoom.set_id(playerId);
+
+        if (!RoomManager::IsValidRoomId(roomId))
+        {
+            LOG_WARN(Game, TEXT_8("Player[{}]: Invalid room id: {}"), playerId, roomId);
+            enterRoom.set_success(false);
+            proto::PacketUtils::Send(session, enterRoom);
+            return;
+        }
+
+        // 방을 옮기는 경우 이전 방의 멤버와 월드의 엔티티를 남기지 않음
+        LeaveCurrentRoom(*clientSession, world);
+
+        // 플레이어 생성 및 매니저에 추가
+        auto player = std::make_shared<Player>(session, playerId);
+        clientSession->SetPlayerId(playerId);
+        PlayerManager::GetInstance().AddPlayer(player);
+
+        // 방 입장 (없으면 생성)
+        const Bool result = RoomManager::GetInstance().EnterRoom(roomId, player);
+        if (result)
+        {
+            clientSession->SetRoomId(roomId);
+        }
+
+        // 월드에 스폰
+        world.SpawnPlayer(std::move(player));
+
+        // 방 입장 처리 패킷 전송
+        enterRoom.set_success(result);
+        proto::PacketUtils::Send(session, enterRoom);
+    }
+
+    /**
+     * 플레이어를 방과 월드에서 제거합니다.
+     *
+     * @param world 명령이 실행될 월드 객체
+     *
+     * 연결 종료 시점(입출력 스레드)이 아니라 여기서 세션의 ID를 읽으므로 먼저 큐에 들어간 입장 명령의 결과가 반영됩니다.
+     */
+    void LeaveRoomCommand::Execute(World& world)
+    {
+        auto clientSession = std::static_pointer_cast<ClientSession>(session);
+        LeaveCurrentRoom(*clientSession, world);
+    }
+
+    /**
+     * 채팅 메시지를 방의 다른 플레이어에게 전송합니다.
+     *
+     * @param world 명령이 실행될 월드 객체
+     * @param message 텍스트 버퍼에 복사된 메시지 (명령 실행이 끝나면 무효)
+     */
+    void ChatCommand::Execute(World& world, String8View message)
+    {
+        auto clientSession = std::static_pointer_cast<ClientSession>(session);
+
+        SharedPtr<Room> room = RoomManager::GetInstance().FindRoom(clientSession->GetRoomId());
+        if (room == nullptr)
+        {
+            core::gLogger->Error(TEXT_8("Player[{}]: Chat without room"), playerId);
+            return;
+        }
+
+        // 룸의 잡 큐에서 모든 플레이어에게 메시지 전송
+        proto::S2C_Chat chat;
+        chat.set_id(playerId);
+        chat.set_message(message);
+        room->PushJob(&Room::Broadcast, proto::PacketUtils::MakeSendBuffers(chat, proto::PacketId::S2C_Chat), playerId);
+    }
+} // namespace game
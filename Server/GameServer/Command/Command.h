@@ -0,0 +1,55 @@
+﻿/*    GameServer/Command/Command.h    */
+
+#pragma once
+
+#include "GameServer/Entity/Player.h"
+#include "GameServer/Chat/Room.h"
+
+namespace game
+{
+    class World;
+
+    /*
+     * 게임 상태를 변경하는 명령 정의
+     *
+     * 특징:
+     * - 패킷 핸들러와 세션 이벤트는 게임 상태를 직접 변경하지 않고 명령으로 변환
+     * - 명령은 값 타입이며 Command(Variant)에 그대로 담겨 별도 힙 할당 없이 전달
+     * - 채팅 문자열처럼 길이가 정해지지 않은 데이터는 CommandQueue의 틱 단위 텍스트 버퍼에 복사하고 위치만 보관
+     * - 모든 명령은 게임 루프 스레드에서 정해진 시점에 일괄 실행
+     */
+
+    // 방 입장
+    struct EnterRoomCommand
+    {
+        SharedPtr<core::Session>    session;
+        PlayerId                    playerId;
+        RoomId                      roomId;
+
+        void                        Execute(World& world);
+    };
+
+    // 방 퇴장 (연결 종료), 플레이어/방 ID는 실행 시점에 세션에서 읽음
+    struct LeaveRoomCommand
+    {
+        SharedPtr<core::Session>    session;
+
+        void                        Execute(World& world);
+    };
+
+    // 채팅, 메시지는 CommandQueue::PushChat이 텍스트 버퍼에 복사하고 위치를 채움
+    struct ChatCommand
+    {
+        SharedPtr<core::Session>    session;
+        PlayerId                    playerId;
+        Int64                       messageOffset = 0;
+        Int64                       messageSize = 0;
+
+        void                        Execute(World& world, String8View message);
+
+        // 채팅 메시지의 최대 바이트 수 (넘으면 핸들러에서 거부)
+        static constexpr Int64      kMaxMessageSize = 512;
+    };
+
+    using Command = Variant<EnterRoomCommand, LeaveRoomCommand, ChatCommand>;
+} // namespace game
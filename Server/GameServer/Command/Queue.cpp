@@ -1,34 +1,66 @@
-﻿/*    GameLogic/Command/Queue.cpp    */
+﻿/*    GameServer/Command/Queue.cpp    */
 
-#include "GameLogic/Pch.h"
-#include "GameLogic/Command/Queue.h"
-#include "GameLogic/Core/World.h"
+#include "GameServer/Pch.h"
+#include "GameServer/Command/Queue.h"
+#include "GameServer/Core/World.h"
 
 namespace game
 {
-    void CommandQueue::Push(const SharedPtr<ICommand>& command)
+    void CommandQueue::Push(Command&& command)
     {
-        while (!mQueue.enqueue(command))
-        {
-            // 큐가 가득 찬 경우 대기합니다.
-            _mm_pause();
-        }
+        core::SrwLockWriteGuard guard(mLock);
+        mPending.push_back(std::move(command));
     }
 
-    Int64 CommandQueue::Execute(World& world)
+    void CommandQueue::PushChat(ChatCommand&& command, String8View message)
     {
-        Int64 executedCount = 0;
-        SharedPtr<ICommand> command;
+        core::SrwLockWriteGuard guard(mLock);
+        command.messageOffset = static_cast_64(mPendingText.size());
+        command.messageSize = static_cast_64(message.size());
+        mPendingText.insert(mPendingText.end(), message.begin(), message.end());
+        mPending.push_back(std::move(command));
+    }
 
-        while (mQueue.try_dequeue(command))
+    /**
+     * 동작:
+     * 1. 락을 잡고 추가된 명령/텍스트 버퍼와 실행 버퍼를 교체
+     * 2. 레코더가 있으면 명령을 기록
+     * 3. 추가된 순서대로 명령 실행 (채팅 명령에는 텍스트 버퍼의 메시지를 전달)
+     * 4. 실행 버퍼를 비우되 용량은 유지
+     */
+    Int64 CommandQueue::Execute(World& world, Int64 tick)
+    {
         {
-            if (command)
+            core::SrwLockWriteGuard guard(mLock);
+            mPending.swap(mExecuting);
+            mPendingText.swap(mExecutingText);
+        }
+
+        for (Command& command : mExecuting)
+        {
+            if (mRecorder)
             {
-                command->Execute(world);
-                ++executedCount;
+                mRecorder(tick, command);
             }
+
+            std::visit([this, &world](auto& typedCommand)
+                       {
+                           if constexpr (std::is_same_v<std::decay_t<decltype(typedCommand)>, ChatCommand>)
+                           {
+                               typedCommand.Execute(world, String8View(mExecutingText.data() + typedCommand.messageOffset, typedCommand.messageSize));
+                           }
+                           else
+                           {
+                               typedCommand.Execute(world);
+                           }
+                       },
+                       command);
         }
 
+        const Int64 executedCount = static_cast_64(mExecuting.size());
+        mExecuting.clear();
+        mExecutingText.clear();
+
         return executedCount;
     }
-}
+} // namespace game
@@ -1,46 +1,69 @@
-﻿/*    GameLogic/Command/Queue.h    */
+﻿/*    GameServer/Command/Queue.h    */
 
 #pragma once
 
+#include "GameServer/Command/Command.h"
+
 namespace game
 {
     class World;
 
-    class ICommand
+    /*
+     * CommandQueue - 게임 루프에서 일괄 실행할 명령 큐
+     *
+     * 주요 기능:
+     * - 여러 스레드(게임 루프, 입출력 워커)에서 명령 추가
+     * - 게임 루프의 정해진 시점에 쌓인 명령을 추가된 순서대로 일괄 실행
+     * - 레코더를 지정하면 실행되는 명령 스트림을 틱 번호와 함께 기록
+     *
+     * 특징:
+     * - 명령 버퍼 두 개를 교체하며 사용하여 버퍼 용량을 재사용 (틱마다 할당 없음)
+     * - 채팅 문자열은 명령 버퍼와 함께 교체되는 텍스트 버퍼에 이어 붙여 명령마다 할당하지 않음
+     * - 실행 중에 추가된 명령은 다음 실행 시점에 처리
+     */
+    class CommandQueue
     {
     public:
-        virtual ~ICommand() = default;
+        using Recorder = Function<void(Int64 tick, const Command& command)>;
 
+    public:
         /**
-         * 명령을 실행합니다.
+         * 명령을 큐에 추가합니다.
          *
-         * @param world 명령이 실행될 월드 객체
+         * @param command 추가할 명령
          */
-        virtual void Execute(World& world) = 0;
-    };
-
-    class CommandQueue
-    {
-    public:
-        CommandQueue() = default;
-        ~CommandQueue() = default;
+        void Push(Command&& command);
 
         /**
-         * 명령을 큐에 추가합니다.
+         * 채팅 명령을 큐에 추가합니다. 메시지는 텍스트 버퍼에 복사됩니다.
          *
-         * @param command 추가할 명령
+         * @param command 추가할 채팅 명령 (메시지 위치는 여기서 채움)
+         * @param message 채팅 메시지
          */
-        void Push(const SharedPtr<ICommand>& command);
+        void PushChat(ChatCommand&& command, String8View message);
 
         /**
-         * 큐에서 명령을 가져와 실행합니다.
+         * 쌓인 명령을 모두 실행합니다.
          *
          * @param world 명령이 실행될 월드 객체
+         * @param tick 현재 틱 번호 (기록용)
          * @return 실행된 명령의 수
          */
-        Int64 Execute(World& world);
+        Int64 Execute(World& world, Int64 tick);
+
+        /**
+         * 명령 레코더를 지정합니다. 게임 루프 스레드에서만 호출합니다.
+         *
+         * @param recorder 명령이 실행되기 직전에 호출될 함수 (nullptr이면 기록 중지)
+         */
+        void SetRecorder(Recorder recorder) { mRecorder = std::move(recorder); }
 
     private:
-        LockfreeQueue<SharedPtr<ICommand>> mQueue; // 명령 큐
+        SRWLOCK             mLock = SRWLOCK_INIT;
+        Vector<Command>     mPending; // 추가된 명령
+        Vector<Command>     mExecuting; // 실행할 명령
+        Vector<Char8>       mPendingText; // 추가된 채팅 명령의 메시지
+        Vector<Char8>       mExecutingText; // 실행할 채팅 명령의 메시지
+        Recorder            mRecorder; // 명령 레코더
     };
-}
+} // namespace game
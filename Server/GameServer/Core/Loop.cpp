@@ -3,22 +3,67 @@
 #include "GameServer/Pch.h"
 #include "GameServer/Core/Loop.h"
 #include "GameServer/Packet/Handler.h"
+#include "GameServer/Chat/Room.h"
 #include "Core/Network/Session.h"
+#include "Core/Network/Batch.h"
+#include "Core/Concurrency/Thread.h"
+#include "Core/Metric/Metric.h"
+#include "Protocol/Packet/Compression.h"
 
 namespace game
 {
+    Loop::Loop()
+        : mTickWait(&core::gMetricRegistry->AddHistogram(TEXT_8("game_packet_tick_wait_microseconds"), TEXT_8("Receive completion to start of the tick that processes the packet")))
+        , mQueueWait(&core::gMetricRegistry->AddHistogram(TEXT_8("game_packet_queue_wait_microseconds"), TEXT_8("Tick start or later receive completion to packet queue pop")))
+        , mHandlerTime(&core::gMetricRegistry->AddHistogram(TEXT_8("game_packet_handler_microseconds"), TEXT_8("Packet queue pop to handler exit")))
+    {
+        // 패킷 큐 깊이는 스크레이프 시점에 샘플링
+        mQueueDepthGauge = core::gMetricRegistry->AddGauge(TEXT_8("game_packet_queue_depth"), TEXT_8("Packets waiting in the game loop packet queue"),
+                                                           [this]()
+                                                           {
+                                                               return mPacketQueue.GetSize();
+                                                           });
+    }
+
+    Loop::~Loop()
+    {
+        if (mQueueDepthGauge != nullptr)
+        {
+            mQueueDepthGauge->ClearSampler();
+        }
+    }
+
     void Loop::Run()
     {
         Int64 tickCount = 0;
         auto lastLogTime = std::chrono::steady_clock::now();
 
+        // 존 워커 실행
+        mWorld.Start(core::gThreadManager->GetRoleConfig(core::ThreadRole::Zone).count);
+
         while (mRunning)
         {
             auto start = std::chrono::steady_clock::now();
+            mTickStartUs = core::GetSteadyNowUs();
 
-            ProcessPackets();
-            UpdateWorld();
-            HandleTimers();
+            // 틱 단위 임시 데이터 해제
+            if (core::tThreadArena != nullptr)
+            {
+                core::tThreadArena->Reset();
+            }
+
+            // 틱 동안의 송신은 세션마다 모아 틱 끝에 한 번에 송신 (지연 상한을 넘으면 단계 사이에서 송신)
+            {
+                core::SendBatchScope batch;
+
+                ProcessPackets();
+                core::SendBatch::FlushIfDue();
+                ApplyCommands();
+                core::SendBatch::FlushIfDue();
+                UpdateWorld();
+                core::SendBatch::FlushIfDue();
+                HandleTimers();
+            }
 
             ++tickCount;
 
@@ -27,7 +72,7 @@ namespace game
             auto elapsedSinceLastLog = std::chrono::duration_cast<MilliSec>(now - lastLogTime);
             if (elapsedSinceLastLog >= MilliSec(1000))
             {
-                core::gLogger->Info("Tick Count: {}", tickCount);
+                core::gLogger->Info("Tick Count: {}, World Update: {} us", tickCount, mWorld.GetLastUpdateUs());
                 tickCount = 0;
                 lastLogTime = now;
             }
@@ -41,6 +86,14 @@ namespace game
             }
             while (elapsed < TickInterval);
         }
+
+        // 존 워커 종료
+        mWorld.Stop();
+
+        if (mRecorder)
+        {
+            mRecorder->Close();
+        }
     }
 
     void Loop::Stop()
@@ -48,20 +101,125 @@ namespace game
         mRunning = false;
     }
 
-    Int64 Loop::PushPackets(const SharedPtr<core::Session>& owner, const Byte* buffer, Int64 numBytes)
+    Bool Loop::StartRecording(const String8& path)
     {
-        return mPacketQueue.Push(owner, buffer, numBytes);
+        auto recorder = std::make_unique<TickRecorder>();
+        if (!recorder->Open(path))
+        {
+            return false;
+        }
+
+        mRecorder = std::move(recorder);
+
+        // 연결 해제는 패킷이 아니라 명령으로만 들어오므로 실행되는 방 퇴장 명령을 기록
+        SetCommandRecorder([this](Int64 tick, const Command& command)
+                           {
+                               if (const auto* leave = std::get_if<LeaveRoomCommand>(&command))
+                               {
+                                   mRecorder->RecordDisconnect(leave->session->GetId());
+                               }
+                           });
+        return true;
+    }
+
+    /**
+     * 기록된 틱 파일을 재생합니다.
+     *
+     * 동작:
+     * 1. 틱 블록마다 복원한 패킷을 디스패처로 전달
+     * 2. 기록된 연결 해제마다 방 퇴장 명령 추가 (패킷으로 만든 명령 뒤에 실행)
+     * 3. 명령 적용과 월드 업데이트를 틱 간격 대기 없이 실행
+     * 4. 틱마다 쌓인 잡을 현재 스레드에서 모두 처리해 결과를 결정적으로 유지
+     * 5. 재생한 틱/패킷/연결 해제 수와 소요 시간 출력
+     *
+     * @return 파일 끝까지 재생했으면 true, 파일을 열지 못했거나 손상된 경우 false
+     */
+    Bool Loop::Replay(const String8& path)
+    {
+        TickReplayer replayer;
+        if (!replayer.Open(path))
+        {
+            return false;
+        }
+
+        Int64 tickCount = 0;
+        Int64 packetCount = 0;
+        Int64 disconnectCount = 0;
+        Int64 tick = 0;
+        Vector<SharedPtr<proto::RawPacket>> packets;
+        Vector<SharedPtr<core::Session>> disconnects;
+
+        mWorld.Start(core::gThreadManager->GetRoleConfig(core::ThreadRole::Zone).count);
+
+        auto start = std::chrono::steady_clock::now();
+
+        while (replayer.ReadTick(OUT tick, OUT packets, OUT disconnects))
+        {
+            for (const auto& packet : packets)
+            {
+                Bool result = C2S_PacketDispatcher::GetInstance().DispatchPacket(packet);
+                if (!result)
+                {
+                    core::gLogger->Error(TEXT_8("Session[{}]: Failed to replay packet with id: {}"), packet->GetOwner()->GetId(), packet->GetId());
+                }
+            }
+
+            for (const auto& session : disconnects)
+            {
+                PushCommand(LeaveRoomCommand{session});
+            }
+
+            ApplyCommands();
+            UpdateWorld();
+            core::gJobQueueManager->DrainQueues();
+
+            ++tickCount;
+            packetCount += static_cast_64(packets.size());
+            disconnectCount += static_cast_64(disconnects.size());
+        }
+
+        auto elapsed = std::chrono::duration_cast<MicroSec>(std::chrono::steady_clock::now() - start);
+
+        mWorld.Stop();
+
+        core::gLogger->Info(TEXT_8("Replay: Ticks={}, Packets={}, Disconnects={}, Elapsed={} us, Avg={} us/tick"),
+                            tickCount, packetCount, disconnectCount, elapsed.count(), (tickCount > 0) ? (elapsed.count() / tickCount) : 0);
+
+        if (replayer.IsCorrupted())
+        {
+            core::gLogger->Error(TEXT_8("Replay: Stopped at corrupted record after {} ticks"), tickCount);
+            return false;
+        }
+
+        return true;
+    }
+
+    Int64 Loop::PushPackets(const SharedPtr<core::Session>& owner, proto::PacketAssembler& assembler, const Byte* buffer, Int64 numBytes)
+    {
+        return mPacketQueue.Push(owner, assembler, buffer, numBytes);
     }
 
     void Loop::ProcessPackets()
     {
         auto start = std::chrono::steady_clock::now();
 
+        if (mRecorder)
+        {
+            mRecorder->BeginTick(mWorld.GetTick());
+        }
+
         SharedPtr<proto::RawPacket> packet;
         while (mPacketQueue.TryPop(packet))
         {
             ASSERT_CRASH_DEBUG(packet != nullptr, "NULL_PACKET_RECEIVED");
 
+            packet->SetPopUs(core::GetSteadyNowUs());
+
+            if (mRecorder)
+            {
+                mRecorder->Record(*packet);
+            }
+
             // 패킷을 핸들러로 전달하여 처리
             Bool result = C2S_PacketDispatcher::GetInstance().DispatchPacket(packet);
             if (!result)
@@ -69,6 +227,14 @@ namespace game
                 core::gLogger->Error(TEXT_8("Session[{}]: Failed to process packet with id: {}"), packet->GetOwner()->GetId(), packet->GetId());
             }
 
+            // 수신부터 핸들러 종료까지의 구간별 지연 기록
+            Int64 tickWaitUs = 0;
+            Int64 queueUs = 0;
+            GetIngressDelay(*packet, OUT tickWaitUs, OUT queueUs);
+            mTickWait->Record(tickWaitUs);
+            mQueueWait->Record(queueUs);
+            mHandlerTime->Record(core::GetSteadyNowUs() - packet->GetPopUs());
+
             // 최대 패킷 처리 시간을 넘겼는지 확인
             auto now = std::chrono::steady_clock::now();
             auto elapsed = std::chrono::duration_cast<MilliSec>(now - start);
@@ -80,9 +246,58 @@ namespace game
         }
     }
 
+    void Loop::GetIngressDelay(const proto::RawPacket& packet, OUT Int64& tickWaitUs, OUT Int64& queueUs) const
+    {
+        tickWaitUs = 0;
+        queueUs = 0;
+
+        // 재생한 패킷처럼 수신 시각이 없으면 측정하지 않음
+        if ((packet.GetReceiveUs() == 0) || (packet.GetPopUs() == 0))
+        {
+            return;
+        }
+
+        // 이전 틱의 패킷 처리 이후에 수신했으면 이번 틱 시작까지 대기
+        const Int64 readyUs = std::max(packet.GetReceiveUs(), mTickStartUs);
+        tickWaitUs = readyUs - packet.GetReceiveUs();
+        queueUs = std::max<Int64>(packet.GetPopUs() - readyUs, 0);
+    }
+
+    void Loop::ApplyCommands()
+    {
+        mCommandQueue.Execute(mWorld, mWorld.GetTick());
+
+        // 틱 블록은 패킷과 명령으로 실행된 연결 해제를 모두 담은 뒤 씀
+        if (mRecorder)
+        {
+            mRecorder->EndTick();
+        }
+    }
+
     void Loop::UpdateWorld()
-    {}
+    {
+        mWorld.Update();
+    }
 
     void Loop::HandleTimers()
-    {}
+    {
+        // 유휴 룸 회수
+        RoomManager::GetInstance().SweepIdleRooms();
+
+        // 락 프로파일, 스레드별 CPU 사용량, 송신량과 압축 통계 출력
+        const Int64 nowTick = ::GetTickCount64();
+        if (nowTick >= mNextStatsTick)
+        {
+            mNextStatsTick = nowTick + kStatsIntervalMs;
+            core::gLockProfiler->LogStats();
+            core::gThreadManager->LogStats();
+            core::gLogger->Info(TEXT_8("Egress: Sent={} bytes"), core::Session::GetTotalSentBytes());
+
+            const proto::PacketCompressor& compressor = proto::PacketCompressor::GetInstance();
+            if (compressor.IsEnabled())
+            {
+                compressor.LogStats();
+            }
+        }
+    }
 }
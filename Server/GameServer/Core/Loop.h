@@ -3,11 +3,15 @@
 #pragma once
 
 #include "GameServer/Core/World.h"
+#include "GameServer/Command/Queue.h"
+#include "GameServer/Core/Replay.h"
 #include "Protocol/Packet/Queue.h"
 
 namespace core
 {
     class Session;
+    class Histogram;
+    class Gauge;
 }
 
 namespace game
@@ -17,6 +21,7 @@ namespace game
     public:
         static constexpr MilliSec TickInterval = MilliSec(50); // 틱 간격
         static constexpr MilliSec MaxPacketProcessTime = MilliSec(10); // 최대 패킷 처리 시간
+        static constexpr Int64 kStatsIntervalMs = 10'000; // 락 프로파일, 스레드 통계 출력 간격
 
     public:
         static Loop& GetInstance()
@@ -25,6 +30,8 @@ namespace game
             return sInstance;
         }
 
+        ~Loop();
+
         Loop(const Loop&) = delete; // 복사 생성자 삭제
         Loop& operator=(const Loop&) = delete; // 대입 연산자 삭제
 
@@ -41,17 +48,74 @@ namespace game
         void Stop();
 
         /**
-         * 버퍼의 패킷들을 큐에 추가합니다.
+         * 버퍼의 프레임들을 재조립해 완성된 패킷을 큐에 추가합니다.
          *
          * @param owner 패킷 소유자 세션
-         * @param buffer 패킷 데이터 버퍼
+         * @param assembler 소유자 세션의 재조립 상태
+         * @param buffer 프레임 데이터 버퍼
          * @param numBytes 버퍼에 있는 데이터 크기 (바이트 단위)
-         * @return 버퍼의 패킷 중 큐로 추가된 패킷 크기의 합 (바이트 단위)
+         * @return 버퍼에서 처리한 프레임 크기의 합 (바이트 단위), 잘못된 프레임이 있으면 FAILURE
+         */
+        Int64 PushPackets(const SharedPtr<core::Session>& owner, proto::PacketAssembler& assembler, const Byte* buffer, Int64 numBytes);
+
+        /**
+         * 틱의 명령 실행 시점에 처리할 명령을 추가합니다.
+         *
+         * @param command 추가할 명령
+         */
+        void PushCommand(Command&& command) { mCommandQueue.Push(std::move(command)); }
+
+        /**
+         * 채팅 명령을 추가합니다. 메시지는 명령 큐의 텍스트 버퍼에 복사됩니다.
+         *
+         * @param command 추가할 채팅 명령
+         * @param message 채팅 메시지
+         */
+        void PushChatCommand(ChatCommand&& command, String8View message) { mCommandQueue.PushChat(std::move(command), message); }
+
+        /**
+         * 명령 레코더를 지정합니다.
+         *
+         * @param recorder 실행되는 명령을 전달받을 함수
          */
-        Int64 PushPackets(const SharedPtr<core::Session>& owner, const Byte* buffer, Int64 numBytes);
+        void SetCommandRecorder(CommandQueue::Recorder recorder) { mCommandQueue.SetRecorder(std::move(recorder)); }
+
+        /**
+         * 게임 루프가 처리하는 패킷과 연결 해제를 틱 단위로 기록합니다.
+         * 명령 레코더를 연결 해제 기록에 사용하므로 SetCommandRecorder와 함께 쓸 수 없습니다.
+         * Run() 이전에 호출해야 합니다.
+         *
+         * @param path 기록 파일 경로
+         * @return 기록 파일을 열었으면 true
+         */
+        Bool StartRecording(const String8& path);
+
+        /**
+         * 기록된 틱 파일을 소켓 없이 최대 속도로 재생합니다.
+         * Run() 대신 호출하며, 잡 워커가 실행되지 않은 상태여야 합니다.
+         *
+         * @param path 기록 파일 경로
+         * @return 재생을 끝까지 마쳤으면 true
+         */
+        Bool Replay(const String8& path);
+
+        /**
+         * 월드 객체를 반환합니다.
+         */
+        World& GetWorld() { return mWorld; }
+
+        /**
+         * 패킷이 수신된 뒤 핸들러에 전달되기까지의 대기 시간을 나눠 계산합니다.
+         * 패킷 처리 중인 루프 스레드에서만 호출합니다.
+         *
+         * @param packet 큐에서 꺼낸 패킷
+         * @param tickWaitUs 수신 완료부터 패킷을 처리하는 틱이 시작될 때까지의 시간
+         * @param queueUs 틱 시작(틱 도중 수신했으면 수신 완료)부터 큐에서 꺼낼 때까지의 시간
+         */
+        void GetIngressDelay(const proto::RawPacket& packet, OUT Int64& tickWaitUs, OUT Int64& queueUs) const;
 
     private:
-        Loop() = default; // 외부 생성 방지
+        Loop(); // 외부 생성 방지
 
         /**
          * 패킷을 처리합니다.
@@ -60,6 +124,11 @@ namespace game
          */
         void ProcessPackets();
 
+        /**
+         * 이번 틱에 쌓인 명령을 월드에 일괄 적용합니다.
+         */
+        void ApplyCommands();
+
         /**
          * 월드 객체를 업데이트합니다.
          */
@@ -73,6 +142,14 @@ namespace game
     private:
         World mWorld; // 월드 객체
         proto::PacketQueue mPacketQueue; // 패킷 큐
-        Bool mRunning = true; // 루프 실행 여부
+        CommandQueue mCommandQueue; // 명령 큐
+        UniquePtr<TickRecorder> mRecorder; // 틱 레코더 (기록 중이 아니면 nullptr)
+        Int64 mNextStatsTick = 0; // 다음 통계 출력 시각
+        Int64 mTickStartUs = 0; // 현재 틱 시작 시각
+        core::Histogram* mTickWait = nullptr; // 수신 완료 ~ 틱 시작
+        core::Histogram* mQueueWait = nullptr; // 틱 시작 ~ 큐에서 꺼냄
+        core::Histogram* mHandlerTime = nullptr; // 큐에서 꺼냄 ~ 핸들러 종료
+        core::Gauge* mQueueDepthGauge = nullptr; // 패킷 큐 깊이 (파괴 전에 샘플러 해제)
+        Atomic<Bool> mRunning = true; // 루프 실행 여부 (다른 스레드에서 Stop 호출)
     };
 }
@@ -0,0 +1,210 @@
+﻿/*    GameServer/Core/Replay.cpp    */
+
+#include "GameServer/Pch.h"
+#include "GameServer/Core/Replay.h"
+#include "GameServer/Network/Session.h"
+#include "Protocol/Packet/Type.h"
+
+namespace game
+{
+    namespace
+    {
+        template<typename T>
+        void AppendValue(Vector<Byte>& buffer, const T& value)
+        {
+            const Byte* bytes = reinterpret_cast<const Byte*>(&value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        template<typename T>
+        Bool ReadValue(std::ifstream& file, OUT T& value)
+        {
+            file.read(reinterpret_cast<char*>(&value), sizeof(T));
+            return file.gcount() == sizeof(T);
+        }
+    } // namespace
+
+    Bool TickRecorder::Open(const String8& path)
+    {
+        mFile.open(path, std::ios::binary | std::ios::trunc);
+        if (!mFile.is_open())
+        {
+            core::gLogger->Error(TEXT_8("TickRecorder: Failed to open {}"), path);
+            return false;
+        }
+
+        const TickLogHeader header;
+        mFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        core::gLogger->Info(TEXT_8("TickRecorder: Recording to {}"), path);
+        return true;
+    }
+
+    void TickRecorder::Close()
+    {
+        if (mFile.is_open())
+        {
+            mFile.close();
+        }
+    }
+
+    void TickRecorder::BeginTick(Int64 tick)
+    {
+        mTick = tick;
+        mRecordCount = 0;
+        mTickBuffer.clear();
+    }
+
+    void TickRecorder::Record(const proto::RawPacket& packet)
+    {
+        AppendValue(mTickBuffer, packet.GetOwner()->GetId());
+
+        const Byte* data = reinterpret_cast<const Byte*>(packet.GetHeader());
+        mTickBuffer.insert(mTickBuffer.end(), data, data + packet.GetSize());
+
+        ++mRecordCount;
+    }
+
+    void TickRecorder::RecordDisconnect(Int64 sessionId)
+    {
+        AppendValue(mTickBuffer, sessionId);
+
+        proto::PacketHeader header;
+        header.size = proto::kPacketHeaderSize;
+        header.id = static_cast<proto::PacketId>(TickLogHeader::kDisconnectRecordId);
+        header.flags = 0;
+        AppendValue(mTickBuffer, header);
+
+        ++mRecordCount;
+    }
+
+    /**
+     * 틱 동안 기록한 패킷과 연결 해제를 파일에 씁니다.
+     *
+     * 동작:
+     * 1. 기록한 레코드가 없으면 종료
+     * 2. 틱 번호와 레코드 수를 쓰고 모아 둔 레코드를 이어서 씀
+     */
+    void TickRecorder::EndTick()
+    {
+        if (mRecordCount == 0)
+        {
+            return;
+        }
+
+        mFile.write(reinterpret_cast<const char*>(&mTick), sizeof(mTick));
+        mFile.write(reinterpret_cast<const char*>(&mRecordCount), sizeof(mRecordCount));
+        mFile.write(reinterpret_cast<const char*>(mTickBuffer.data()), mTickBuffer.size());
+    }
+
+    Bool TickReplayer::Open(const String8& path)
+    {
+        mFile.open(path, std::ios::binary);
+        if (!mFile.is_open())
+        {
+            core::gLogger->Error(TEXT_8("TickReplayer: Failed to open {}"), path);
+            return false;
+        }
+
+        TickLogHeader header;
+        if (!ReadValue(mFile, OUT header) ||
+            (header.magic != TickLogHeader::kMagic) ||
+            (header.version < TickLogHeader::kMinVersion) ||
+            (header.version > TickLogHeader::kVersion))
+        {
+            core::gLogger->Error(TEXT_8("TickReplayer: Invalid tick log {}"), path);
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * 다음 틱 블록을 읽습니다.
+     *
+     * @param tick 기록된 틱 번호
+     * @param packets 복원된 패킷 목록
+     * @param disconnects 이 틱에 연결이 끊긴 재생용 세션 목록
+     * @return 틱 블록을 읽었으면 true, 파일 끝이거나 손상된 경우 false (손상이면 IsCorrupted()가 true)
+     *
+     * 동작:
+     * 1. 틱 경계에서 남은 바이트가 없으면 정상적인 파일 끝, 아니면 틱 번호와 레코드 수 읽기
+     * 2. 레코드마다 세션 ID와 헤더를 읽음
+     * 3. 연결 해제 레코드면 재생용 세션을 연결 해제 목록에 추가
+     * 4. 패킷 레코드면 헤더의 크기만큼 나머지 바이트를 읽고 재생용 세션을 소유자로 RawPacket 생성
+     */
+    Bool TickReplayer::ReadTick(OUT Int64& tick, OUT Vector<SharedPtr<proto::RawPacket>>& packets,
+                                OUT Vector<SharedPtr<core::Session>>& disconnects)
+    {
+        packets.clear();
+        disconnects.clear();
+
+        if (mFile.peek() == std::ifstream::traits_type::eof())
+        {
+            return false;
+        }
+
+        Int32 recordCount = 0;
+        if (!ReadValue(mFile, OUT tick) ||
+            !ReadValue(mFile, OUT recordCount) ||
+            (recordCount < 0))
+        {
+            core::gLogger->Error(TEXT_8("TickReplayer: Truncated tick header after tick {}"), tick);
+            mIsCorrupted = true;
+            return false;
+        }
+
+        packets.reserve(recordCount);
+        for (Int32 i = 0; i < recordCount; ++i)
+        {
+            Int64 sessionId = 0;
+            proto::PacketHeader header;
+            if (!ReadValue(mFile, OUT sessionId) ||
+                !ReadValue(mFile, OUT header) ||
+                (header.size < proto::kPacketHeaderSize) ||
+                (header.size > proto::kMaxMessageSize))
+            {
+                core::gLogger->Error(TEXT_8("TickReplayer: Corrupted packet record at tick {}"), tick);
+                mIsCorrupted = true;
+                return false;
+            }
+
+            if (static_cast_16(header.id) == TickLogHeader::kDisconnectRecordId)
+            {
+                disconnects.push_back(GetSession(sessionId));
+                continue;
+            }
+
+            mPacketBuffer.resize(header.size);
+            ::memcpy(mPacketBuffer.data(), &header, sizeof(header));
+
+            const Int64 payloadSize = header.size - proto::kPacketHeaderSize;
+            mFile.read(reinterpret_cast<char*>(mPacketBuffer.data() + sizeof(header)), payloadSize);
+            if (mFile.gcount() != payloadSize)
+            {
+                core::gLogger->Error(TEXT_8("TickReplayer: Truncated packet at tick {}"), tick);
+                mIsCorrupted = true;
+                return false;
+            }
+
+            packets.push_back(std::make_shared<proto::RawPacket>(GetSession(sessionId), mPacketBuffer.data()));
+        }
+
+        return true;
+    }
+
+    SharedPtr<core::Session> TickReplayer::GetSession(Int64 sessionId)
+    {
+        auto it = mSessions.find(sessionId);
+        if (it != mSessions.end())
+        {
+            return it->second;
+        }
+
+        auto session = std::make_shared<ClientSession>();
+        session->SetId(sessionId);
+        mSessions.emplace(sessionId, session);
+
+        return session;
+    }
+} // namespace game
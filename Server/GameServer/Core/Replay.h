@@ -0,0 +1,97 @@
+﻿/*    GameServer/Core/Replay.h    */
+
+#pragma once
+
+namespace core
+{
+    class Session;
+}
+
+namespace proto
+{
+    class RawPacket;
+}
+
+namespace game
+{
+    /*
+     * 틱 기록 파일 형식 (리틀 엔디언)
+     *
+     * - 파일 헤더: magic(UInt32) version(UInt32)
+     * - 틱 블록: tick(Int64) recordCount(Int32), 이어서 recordCount개의 레코드
+     * - 패킷 레코드: sessionId(Int64), 이어서 PacketHeader를 포함한 재조립된 패킷 원본 (크기는 헤더의 size)
+     * - 연결 해제 레코드: sessionId(Int64), 이어서 id가 kDisconnectRecordId이고 페이로드가 없는 PacketHeader
+     *
+     * 버전 2부터 PacketHeader의 size가 Int32이고 flags가 추가되었습니다.
+     * 버전 3부터 연결 해제 레코드가 추가되었습니다. (버전 2 파일도 그대로 읽을 수 있음)
+     *
+     * 레코드가 없는 틱은 기록하지 않습니다.
+     */
+    struct TickLogHeader
+    {
+        UInt32      magic = kMagic;
+        UInt32      version = kVersion;
+
+        static constexpr UInt32     kMagic = 0x5052'4B54; // "TKRP"
+        static constexpr UInt32     kVersion = 3;
+        static constexpr UInt32     kMinVersion = 2;
+        // 수신 프레임 검증에서 거부되는 음수 id라서 실제 패킷과 겹치지 않음
+        static constexpr Int16      kDisconnectRecordId = -1;
+    };
+
+    /*
+     * TickRecorder - 게임 루프가 꺼낸 패킷을 틱 단위로 파일에 기록
+     *
+     * 주요 기능:
+     * - 틱 동안 기록한 패킷을 메모리에 모았다가 틱이 끝날 때 한 번에 파일에 쓰기
+     * - 세션 ID와 패킷 원본만 기록하므로 재생 시 소켓 없이 같은 입력을 만들 수 있음
+     * - 연결 해제로 실행된 방 퇴장 명령을 연결 해제 레코드로 기록 (패킷이 아닌 입력)
+     *
+     * 스레드 규칙:
+     * - 게임 루프 스레드에서만 호출
+     */
+    class TickRecorder
+    {
+    public:
+        Bool                    Open(const String8& path);
+        void                    Close();
+
+        void                    BeginTick(Int64 tick);
+        void                    Record(const proto::RawPacket& packet);
+        void                    RecordDisconnect(Int64 sessionId);
+        void                    EndTick();
+
+    private:
+        std::ofstream           mFile;
+        Vector<Byte>            mTickBuffer;
+        Int64                   mTick = 0;
+        Int32                   mRecordCount = 0;
+    };
+
+    /*
+     * TickReplayer - 기록된 틱 파일을 읽어 패킷을 복원
+     *
+     * 주요 기능:
+     * - 틱 블록 단위로 읽어 RawPacket 목록과 연결이 끊긴 세션 목록으로 반환
+     * - ReadTick이 false를 반환하면 IsCorrupted()로 파일 끝과 손상(잘림 포함)을 구분
+     * - 기록된 세션 ID마다 연결되지 않은 ClientSession을 만들어 패킷 소유자로 지정
+     *   (연결되지 않은 세션의 송신은 버퍼만 버리고 끝남)
+     */
+    class TickReplayer
+    {
+    public:
+        Bool                    Open(const String8& path);
+        Bool                    ReadTick(OUT Int64& tick, OUT Vector<SharedPtr<proto::RawPacket>>& packets,
+                                         OUT Vector<SharedPtr<core::Session>>& disconnects);
+        Bool                    IsCorrupted() const { return mIsCorrupted; }
+
+    private:
+        SharedPtr<core::Session>    GetSession(Int64 sessionId);
+
+    private:
+        std::ifstream                               mFile;
+        Vector<Byte>                                mPacketBuffer;
+        HashMap<Int64, SharedPtr<core::Session>>    mSessions;
+        Bool                                        mIsCorrupted = false;
+    };
+} // namespace game
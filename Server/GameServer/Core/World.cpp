@@ -2,6 +2,331 @@
 
 #include "GameServer/Pch.h"
 #include "GameServer/Core/World.h"
+#include "Core/Concurrency/Thread.h"
 
 namespace game
-{ }
+{
+    World::World()
+    {
+        mZones.reserve(kZoneCount);
+        for (ZoneId id = 0; id < kZoneCount; ++id)
+        {
+            mZones.push_back(std::make_unique<Zone>(id, kZoneCount));
+        }
+    }
+
+    /**
+     * 존 워커 스레드를 실행합니다.
+     *
+     * @param workerCount 워커 스레드 수 (존 수보다 많으면 존 수로 제한)
+     *
+     * 동작:
+     * 1. 워커 수를 기록하고 실행 상태로 변경
+     * 2. 워커마다 스레드를 생성하여 틱 시작 신호를 대기
+     */
+    void World::Start(Int32 workerCount)
+    {
+        workerCount = std::clamp(workerCount, 1, kZoneCount);
+        {
+            core::SrwLockWriteGuard guard(mLock);
+            mWorkerCount = workerCount;
+            mRunning = true;
+        }
+
+        for (Int32 i = 0; i < workerCount; ++i)
+        {
+            core::gThreadManager->Launch(core::ThreadRole::Zone, [this, i]()
+                                         {
+                                             RunWorker(i);
+                                         });
+        }
+
+        core::gLogger->Info(TEXT_8("World: Started {} zone workers for {} zones"), workerCount, kZoneCount);
+    }
+
+    void World::Stop()
+    {
+        {
+            core::SrwLockWriteGuard guard(mLock);
+            mRunning = false;
+            mWorkerCount = 0;
+        }
+        ::WakeAllConditionVariable(&mStartCondVar);
+    }
+
+    /**
+     * 월드의 한 틱을 처리합니다. 게임 루프 스레드에서 호출됩니다.
+     *
+     * 동작:
+     * 1. 큐에 쌓인 스폰/디스폰 요청을 각 존에 반영
+     * 2. 틱 번호를 증가시키고 모든 워커를 깨움 (워커가 없으면 현재 스레드에서 갱신)
+     * 3. 모든 워커가 담당 존 갱신을 마칠 때까지 배리어에서 대기
+     * 4. 존 ID 순서대로 핸드오프를 반영
+     */
+    void World::Update()
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        ApplyMessages();
+
+        Int32 workerCount = 0;
+        {
+            core::SrwLockWriteGuard guard(mLock);
+            workerCount = mWorkerCount;
+            if (workerCount > 0)
+            {
+                ++mTick;
+                mPendingWorkerCount = workerCount;
+            }
+        }
+
+        if (workerCount > 0)
+        {
+            ::WakeAllConditionVariable(&mStartCondVar);
+
+            // 틱 종료 배리어
+            core::SrwLockWriteGuard guard(mLock);
+            while (mPendingWorkerCount > 0)
+            {
+                ::SleepConditionVariableSRW(&mDoneCondVar, &mLock, INFINITE, 0);
+            }
+        }
+        else
+        {
+            ++mTick;
+            UpdateZones(mTick, 0, 1);
+        }
+
+        ApplyHandoffs();
+
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        mLastUpdateUs = std::chrono::duration_cast<MicroSec>(elapsed).count();
+    }
+
+    void World::SpawnPlayer(SharedPtr<Player> player)
+    {
+        const PlayerId playerId = player->GetId();
+        mMessages.enqueue({ZoneMessage::Type::Spawn, playerId, std::move(player)});
+    }
+
+    void World::DespawnPlayer(PlayerId playerId)
+    {
+        mMessages.enqueue({ZoneMessage::Type::Despawn, playerId, nullptr});
+    }
+
+    /**
+     * 존 워커 스레드의 본체입니다.
+     *
+     * @param workerIndex 워커 인덱스
+     *
+     * 동작:
+     * 1. 새 틱 번호가 게시될 때까지 대기
+     * 2. 담당 존(존 ID % 워커 수 == 워커 인덱스)을 갱신
+     * 3. 남은 워커 수를 줄이고, 마지막 워커면 게임 루프 스레드를 깨움
+     * 4. 실행 상태가 해제되면 종료
+     */
+    void World::RunWorker(Int32 workerIndex)
+    {
+        Int64 lastTick = 0;
+
+        while (true)
+        {
+            Int32 workerCount = 0;
+            {
+                core::SrwLockWriteGuard guard(mLock);
+                while (mRunning && (mTick == lastTick))
+                {
+                    ::SleepConditionVariableSRW(&mStartCondVar, &mLock, INFINITE, 0);
+                }
+
+                if (!mRunning)
+                {
+                    break;
+                }
+
+                lastTick = mTick;
+                workerCount = mWorkerCount;
+            }
+
+            UpdateZones(lastTick, workerIndex, workerCount);
+
+            Bool lastWorker = false;
+            {
+                core::SrwLockWriteGuard guard(mLock);
+                lastWorker = (--mPendingWorkerCount == 0);
+            }
+
+            if (lastWorker)
+            {
+                ::WakeConditionVariable(&mDoneCondVar);
+            }
+        }
+    }
+
+    void World::UpdateZones(Int64 tick, Int32 workerIndex, Int32 workerCount)
+    {
+        for (ZoneId id = workerIndex; id < kZoneCount; id += workerCount)
+        {
+            mZones[id]->Update(tick);
+        }
+    }
+
+    /**
+     * 스폰/디스폰 요청을 존에 반영합니다. 틱 사이에만 호출됩니다.
+     *
+     * 동작:
+     * 1. 메시지 큐를 비우면서 스폰은 플레이어 ID로 정한 존의 가운데에 입장시킴
+     *    (속도도 플레이어 ID로 정해서 같은 입력이면 항상 같은 이동 결과)
+     * 2. 디스폰은 현재 속한 존에서 퇴장시킴
+     */
+    void World::ApplyMessages()
+    {
+        ZoneMessage message;
+        while (mMessages.try_dequeue(message))
+        {
+            switch (message.type)
+            {
+            case ZoneMessage::Type::Spawn:
+            {
+                const ZoneId zoneId = static_cast_32(message.playerId % kZoneCount + kZoneCount) % kZoneCount;
+                if (mPlayerZones.insert({message.playerId, zoneId}).second)
+                {
+                    const Float32 velocityX = static_cast<Float32>(message.playerId % 9 - 4) * kMaxSpeed / 4.0f;
+                    message.player->SetMotion(mZones[zoneId]->GetMinX() + Zone::kZoneWidth / 2.0f, velocityX);
+                    mZones[zoneId]->Enter(std::move(message.player));
+                }
+                break;
+            }
+            case ZoneMessage::Type::Despawn:
+            {
+                auto it = mPlayerZones.find(message.playerId);
+                if (it != mPlayerZones.end())
+                {
+                    mZones[it->second]->Leave(message.playerId);
+                    mPlayerZones.erase(it);
+                }
+                break;
+            }
+            }
+        }
+    }
+
+    /**
+     * 이번 틱에 요청된 존 간 이동을 반영합니다.
+     *
+     * 동작:
+     * 1. 존 ID 순서대로 각 존의 핸드오프 요청을 수집 (스레드 스케줄링과 무관한 결정적 순서)
+     *    틱 안에서만 쓰는 배열이므로 게임 루프 스레드의 아레나에서 할당 (아레나가 없거나 부족하면 힙 사용)
+     * 2. 원래 존에서 퇴장시키고 대상 존에 입장시킴
+     */
+    void World::ApplyHandoffs()
+    {
+        Int64 handoffCount = 0;
+        for (const auto& zone : mZones)
+        {
+            handoffCount += zone->GetHandoffCount();
+        }
+
+        if (handoffCount == 0)
+        {
+            return;
+        }
+
+        ZoneHandoff* handoffs = (core::tThreadArena != nullptr) ? core::tThreadArena->AllocArray<ZoneHandoff>(handoffCount) : nullptr;
+        Vector<ZoneHandoff> heapHandoffs;
+        if (handoffs == nullptr)
+        {
+            heapHandoffs.resize(handoffCount);
+            handoffs = heapHandoffs.data();
+        }
+
+        Int64 offset = 0;
+        for (auto& zone : mZones)
+        {
+            offset += zone->TakeHandoffs(OUT handoffs + offset);
+        }
+
+        for (Int64 i = 0; i < handoffCount; ++i)
+        {
+            const ZoneHandoff& handoff = handoffs[i];
+            auto it = mPlayerZones.find(handoff.playerId);
+            if ((it == mPlayerZones.end()) || (handoff.targetZoneId < 0) || (handoff.targetZoneId >= kZoneCount))
+            {
+                continue;
+            }
+
+            SharedPtr<Player> player = mZones[it->second]->Leave(handoff.playerId);
+            if (player)
+            {
+                mZones[handoff.targetZoneId]->Enter(std::move(player));
+                it->second = handoff.targetZoneId;
+            }
+        }
+
+        mHandoffCount += handoffCount;
+    }
+
+    /**
+     * 존 병렬 갱신의 확장성을 측정합니다.
+     *
+     * @param entityCount 월드에 스폰할 플레이어 수 (세션 없이 생성)
+     * @param tickCount 워커 수마다 측정할 틱 수
+     *
+     * 동작:
+     * 1. 워커 수를 1부터 두 배씩 늘려 가며 (존 수와 논리 프로세서 수 이하) 새 월드를 생성
+     * 2. 같은 엔티티를 스폰하고 첫 틱(스폰 반영)을 제외한 틱마다 Update 시간을 기록
+     * 3. 워커 수별 평균/p99 틱 시간, 1 워커 대비 속도 향상, 틱당 핸드오프 수 출력
+     */
+    void World::RunScalingBenchmark(Int64 entityCount, Int64 tickCount)
+    {
+        const Int32 processorCount = std::max(static_cast_32(std::thread::hardware_concurrency()), 1);
+        const Int32 maxWorkerCount = std::min(kZoneCount, processorCount);
+
+        core::gLogger->Info(TEXT_8("ZoneBenchmark: Entities={}, Ticks={}, Zones={}, Processors={}"),
+                            entityCount, tickCount, kZoneCount, processorCount);
+
+        Float64 baseAvgUs = 0.0;
+
+        for (Int32 workerCount = 1; workerCount <= maxWorkerCount; workerCount *= 2)
+        {
+            // 워커는 시작할 때의 틱 번호를 0으로 가정하므로 워커 수마다 새 월드 사용
+            auto world = std::make_unique<World>();
+            for (PlayerId id = 1; id <= entityCount; ++id)
+            {
+                world->SpawnPlayer(std::make_shared<Player>(nullptr, id));
+            }
+
+            world->Start(workerCount);
+            world->Update();
+
+            const Int64 handoffBase = world->mHandoffCount;
+
+            Vector<Int64> tickUs;
+            tickUs.reserve(tickCount);
+            Int64 totalUs = 0;
+            for (Int64 i = 0; i < tickCount; ++i)
+            {
+                world->Update();
+                tickUs.push_back(world->GetLastUpdateUs());
+                totalUs += world->GetLastUpdateUs();
+            }
+
+            world->Stop();
+            core::gThreadManager->Join(core::ThreadRole::Zone);
+
+            std::sort(tickUs.begin(), tickUs.end());
+            const Float64 avgUs = static_cast<Float64>(totalUs) /
+                                  static_cast<Float64>(std::max<Int64>(tickCount, 1));
+            const Int64 p99Us = tickUs.empty() ? 0 : tickUs[static_cast<size_t>((tickUs.size() - 1) * 99 / 100)];
+
+            if (workerCount == 1)
+            {
+                baseAvgUs = avgUs;
+            }
+
+            core::gLogger->Info(TEXT_8("ZoneBenchmark: Workers={}, Avg={:.1f} us, P99={} us, Speedup={:.2f}x, Handoffs/tick={:.1f}"),
+                                workerCount, avgUs, p99Us, (avgUs > 0.0) ? (baseAvgUs / avgUs) : 0.0,
+                                static_cast<Float64>(world->mHandoffCount - handoffBase) / static_cast<Float64>(std::max<Int64>(tickCount, 1)));
+        }
+    }
+} // namespace game
@@ -2,9 +2,75 @@
 
 #pragma once
 
+#include "GameServer/Core/Zone.h"
+
 namespace game
 {
+    /*
+     * World - 존 단위로 분할된 게임 월드
+     *
+     * 주요 기능:
+     * - 월드를 고정 개수의 존으로 나누고, 존을 워커 스레드에 정적으로 분배
+     * - 매 틱 모든 워커가 담당 존을 병렬로 갱신한 뒤 배리어에서 합류
+     * - 존 간 엔티티 이동은 배리어 이후 존 ID 순서대로 반영하여 결정적 결과 보장
+     * - 스폰/디스폰 요청은 어느 스레드에서나 메시지 큐로 전달
+     */
     class World
     {
+    public:
+        static constexpr Int32      kZoneCount = 16;
+        static constexpr Float32    kMaxSpeed = 2.0f; // 틱당 최대 이동 거리
+
+    public:
+        World();
+
+        void                Start(Int32 workerCount);
+        void                Stop();
+        void                Update();
+
+        void                SpawnPlayer(SharedPtr<Player> player);
+        void                DespawnPlayer(PlayerId playerId);
+
+        Int64               GetTick() const { return mTick; }
+        Int64               GetLastUpdateUs() const { return mLastUpdateUs; }
+
+    public:
+        // 고정된 엔티티 수로 워커 수를 늘려 가며 틱 시간을 측정 (네트워크 없이 메인 스레드에서 실행)
+        static void         RunScalingBenchmark(Int64 entityCount, Int64 tickCount);
+
+    private:
+        struct ZoneMessage
+        {
+            enum class Type : Int8
+            {
+                Spawn,
+                Despawn,
+            };
+
+            Type                type;
+            PlayerId            playerId;
+            SharedPtr<Player>   player;
+        };
+
+        void                RunWorker(Int32 workerIndex);
+        void                UpdateZones(Int64 tick, Int32 workerIndex, Int32 workerCount);
+        void                ApplyMessages();
+        void                ApplyHandoffs();
+
+    private:
+        Vector<UniquePtr<Zone>>             mZones;
+        HashMap<PlayerId, ZoneId>           mPlayerZones;
+        LockfreeQueue<ZoneMessage>          mMessages;
+        Int64                               mLastUpdateUs = 0;
+        Int64                               mHandoffCount = 0;
+
+        // 틱 시작/종료 배리어
+        SRWLOCK                             mLock = SRWLOCK_INIT;
+        CONDITION_VARIABLE                  mStartCondVar = CONDITION_VARIABLE_INIT;
+        CONDITION_VARIABLE                  mDoneCondVar = CONDITION_VARIABLE_INIT;
+        Int64                               mTick = 0;
+        Int32                               mWorkerCount = 0;
+        Int32                               mPendingWorkerCount = 0;
+        Bool                                mRunning = false;
     };
-}
+} // namespace game
@@ -0,0 +1,113 @@
+﻿/*    GameServer/Core/Zone.cpp    */
+
+#include "GameServer/Pch.h"
+#include "GameServer/Core/Zone.h"
+
+namespace game
+{
+    Zone::Zone(ZoneId id, Int32 zoneCount)
+        : mId(id)
+        , mZoneCount(zoneCount)
+    {}
+
+    /**
+     * 존의 한 틱을 처리합니다.
+     *
+     * @param tick 현재 틱 번호
+     *
+     * 동작:
+     * 1. 존에 속한 플레이어를 속도만큼 이동 (월드 경계를 넘으면 반사)
+     * 2. 이동한 위치가 다른 존의 영역이면 RequestHandoff로 기록 (반영은 배리어 이후)
+     * 3. 처리 시간을 기록
+     *
+     * 이 존의 워커에서만 실행되므로 mPlayers와 플레이어의 이동 상태에 락 없이 접근합니다.
+     */
+    void Zone::Update(Int64 tick)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        const Float32 worldWidth = static_cast<Float32>(mZoneCount) * kZoneWidth;
+
+        for (auto& [playerId, player] : mPlayers)
+        {
+            Float32 positionX = player->GetPositionX() + player->GetVelocityX();
+            Float32 velocityX = player->GetVelocityX();
+
+            if (positionX < 0.0f)
+            {
+                positionX = -positionX;
+                velocityX = -velocityX;
+            }
+            else if (positionX >= worldWidth)
+            {
+                positionX = worldWidth - (positionX - worldWidth);
+                velocityX = -velocityX;
+            }
+
+            player->SetMotion(positionX, velocityX);
+
+            const ZoneId targetZoneId = GetZoneIdAt(positionX);
+            if (targetZoneId != mId)
+            {
+                RequestHandoff(playerId, targetZoneId);
+            }
+        }
+
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        mLastUpdateUs = std::chrono::duration_cast<MicroSec>(elapsed).count();
+    }
+
+    void Zone::RequestHandoff(PlayerId playerId, ZoneId targetZoneId)
+    {
+        if (targetZoneId == mId)
+        {
+            return;
+        }
+
+        mHandoffs.push_back({playerId, targetZoneId});
+    }
+
+    void Zone::Enter(SharedPtr<Player> player)
+    {
+        const PlayerId playerId = player->GetId();
+        if (!mPlayers.insert({playerId, std::move(player)}).second)
+        {
+            core::gLogger->Error(TEXT_8("Player[{}]: Already exists in zone[{}]"), playerId, mId);
+        }
+    }
+
+    SharedPtr<Player> Zone::Leave(PlayerId playerId)
+    {
+        auto it = mPlayers.find(playerId);
+        if (it == mPlayers.end())
+        {
+            return nullptr;
+        }
+
+        SharedPtr<Player> player = std::move(it->second);
+        mPlayers.erase(it);
+
+        return player;
+    }
+
+    /**
+     * 이번 틱의 핸드오프 요청을 복사하고 비웁니다.
+     *
+     * @param handoffs 요청을 복사할 배열 (GetHandoffCount() 이상의 크기)
+     * @return 복사한 요청 수
+     */
+    Int64 Zone::TakeHandoffs(OUT ZoneHandoff* handoffs)
+    {
+        std::copy(mHandoffs.begin(), mHandoffs.end(), handoffs);
+        const Int64 handoffCount = static_cast_64(mHandoffs.size());
+        mHandoffs.clear();
+
+        return handoffCount;
+    }
+
+    ZoneId Zone::GetZoneIdAt(Float32 positionX) const
+    {
+        const ZoneId zoneId = static_cast<ZoneId>(positionX / kZoneWidth);
+        return std::clamp(zoneId, 0, mZoneCount - 1);
+    }
+} // namespace game
@@ -0,0 +1,63 @@
+﻿/*    GameServer/Core/Zone.h    */
+
+#pragma once
+
+#include "GameServer/Entity/Player.h"
+
+namespace game
+{
+    using ZoneId = Int32;
+
+    // 다른 존으로 옮겨갈 엔티티 정보
+    struct ZoneHandoff
+    {
+        PlayerId    playerId;
+        ZoneId      targetZoneId;
+    };
+
+    /*
+     * Zone - 월드를 분할한 독립 시뮬레이션 단위
+     *
+     * 월드는 x축을 따라 kZoneWidth 폭의 존으로 나뉘며, 존 ID가 곧 왼쪽부터의 순서입니다.
+     *
+     * 주요 기능:
+     * - 존에 속한 엔티티를 소유하고 틱마다 이동시킴 (월드 경계에서는 반사)
+     * - 다른 존의 영역으로 나간 엔티티는 직접 옮기지 않고 핸드오프 요청으로 기록
+     *
+     * 스레드 규칙:
+     * - Update와 RequestHandoff는 존을 담당하는 워커 스레드에서만 호출
+     * - Enter, Leave, TakeHandoffs는 틱 사이(배리어 이후) 게임 루프 스레드에서만 호출
+     * - 따라서 존 내부 상태는 락 없이 접근
+     */
+    class Zone
+    {
+    public:
+        static constexpr Float32    kZoneWidth = 64.0f;
+
+    public:
+        Zone(ZoneId id, Int32 zoneCount);
+
+        void                    Update(Int64 tick);
+        void                    RequestHandoff(PlayerId playerId, ZoneId targetZoneId);
+
+        void                    Enter(SharedPtr<Player> player);
+        SharedPtr<Player>       Leave(PlayerId playerId);
+        Int64                   TakeHandoffs(OUT ZoneHandoff* handoffs);
+
+        ZoneId                  GetId() const { return mId; }
+        Int64                   GetPlayerCount() const { return static_cast_64(mPlayers.size()); }
+        Int64                   GetHandoffCount() const { return static_cast_64(mHandoffs.size()); }
+        Int64                   GetLastUpdateUs() const { return mLastUpdateUs; }
+        Float32                 GetMinX() const { return static_cast<Float32>(mId) * kZoneWidth; }
+
+    private:
+        ZoneId                  GetZoneIdAt(Float32 positionX) const;
+
+    private:
+        ZoneId                                  mId;
+        Int32                                   mZoneCount;
+        HashMap<PlayerId, SharedPtr<Player>>    mPlayers;
+        Vector<ZoneHandoff>                     mHandoffs;
+        Int64                                   mLastUpdateUs = 0;
+    };
+} // namespace game
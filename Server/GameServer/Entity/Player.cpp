@@ -22,43 +22,53 @@ namespace game
         mSession->SendAsync(std::move(buffer));
     }
 
-    void Player::StartSendLoop(SharedPtr<SendBuffer> buffer, Int64 loopMs)
+    void Player::SendAsync(const Vector<SharedPtr<SendBuffer>>& buffers)
     {
-        const Int64 nextTick = ::GetTickCount64() + loopMs;
-
-        // 매니저에 없으면 반복 종료
-        if (PlayerManager::GetInstance().FindPlayer(mId) == nullptr)
-        {
-            return;
-        }
-
-        // 송신 버퍼 전송
-        SendAsync(buffer);
+        mSession->SendAsync(buffers);
+    }
 
-        // 지연 시간 계산
-        Int64 delayMs = nextTick - ::GetTickCount64();
-        if (delayMs < 0)
+    /**
+     * 주기적으로 송신 버퍼를 전송합니다. Spawn()으로 시작합니다.
+     *
+     * @param buffer 전송할 송신 버퍼
+     * @param loopMs 전송 주기(밀리초)
+     *
+     * 동작:
+     * 1. 매니저에 없거나 송신이 실패하면 종료
+     * 2. 송신 완료까지 대기한 뒤 남은 주기만큼 대기
+     */
+    Task Player::RunSendLoop(SharedPtr<SendBuffer> buffer, Int64 loopMs)
+    {
+        while (PlayerManager::GetInstance().FindPlayer(mId) != nullptr)
         {
-            gLogger->Warn(TEXT_8("Player[{}]: Send loop delay is negative"), mId);
-            delayMs = 0;
+            const Int64 nextTick = ::GetTickCount64() + loopMs;
+
+            // 송신 버퍼 전송 후 완료까지 대기
+            if (!co_await mSession->SendAndWait(buffer))
+            {
+                co_return;
+            }
+
+            // 지연 시간 계산
+            Int64 delayMs = nextTick - ::GetTickCount64();
+            if (delayMs < 0)
+            {
+                gLogger->Warn(TEXT_8("Player[{}]: Send loop delay is negative"), mId);
+                delayMs = 0;
+            }
+
+            co_await SleepFor(delayMs);
         }
-
-        // 다음 루프 예약
-        ScheduleJob(delayMs, &Player::StartSendLoop, std::move(buffer), loopMs);
     }
 
     void PlayerManager::AddPlayer(SharedPtr<Player> player)
     {
-        Bool result = true;
-        {
-            WRITE_GUARD;
-            // 플레이어 추가
-            result = (mPlayers.insert({player->GetId(), player}).second);
-        }
+        // 플레이어 추가
+        const Bool result = mPlayers.Insert(player->GetId(), player);
 
         if (result)
         {
-            gLogger->Info(TEXT_8("Player[{}]: Added to manager"), player->GetId());
+            LOG_INFO(Game, TEXT_8("Player[{}]: Added to manager"), player->GetId());
         }
         else
         {
@@ -68,16 +78,12 @@ namespace game
 
     void PlayerManager::RemovePlayer(PlayerId id)
     {
-        Bool result = true;
-        {
-            WRITE_GUARD;
-            // 플레이어 제거
-            result = (mPlayers.erase(id) > 0);
-        }
+        // 플레이어 제거
+        const Bool result = mPlayers.Erase(id);
 
         if (result)
         {
-            gLogger->Info(TEXT_8("Player[{}]: Removed from manager"), id);
+            LOG_INFO(Game, TEXT_8("Player[{}]: Removed from manager"), id);
         }
         else
         {
@@ -87,16 +93,8 @@ namespace game
 
     SharedPtr<Player> PlayerManager::FindPlayer(PlayerId id)
     {
-        WRITE_GUARD;
-
-        // 플레이어 찾기
-        auto it = mPlayers.find(id);
-        if (it != mPlayers.end())
-        {
-            return it->second;
-        }
-
-        return nullptr;
+        // 락 없이 현재 스냅샷에서 플레이어 찾기
+        return mPlayers.Find(id);
     }
 
     Atomic<PlayerId> Player::sNextId = 1;
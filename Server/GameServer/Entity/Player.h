@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Core/Network/Session.h"
+#include "Core/Concurrency/Rcu.h"
 
 namespace game
 {
@@ -16,12 +17,21 @@ namespace game
         Player(SharedPtr<core::Session> session, PlayerId id);
 
         void                    SendAsync(SharedPtr<core::SendBuffer> buffer);
-        void                    StartSendLoop(SharedPtr<core::SendBuffer> buffer, Int64 loopMs);
+        void                    SendAsync(const Vector<SharedPtr<core::SendBuffer>>& buffers);
+        core::Task              RunSendLoop(SharedPtr<core::SendBuffer> buffer, Int64 loopMs);
         PlayerId                GetId() const { return mId; }
+        Bool                    IsCompressionEnabled() const { return mSession->IsCompressionEnabled(); }
+
+        // 존 시뮬레이션 상태 (틱 동안에는 소속 존의 워커, 틱 사이에는 게임 루프 스레드에서만 접근)
+        Float32                 GetPositionX() const { return mPositionX; }
+        Float32                 GetVelocityX() const { return mVelocityX; }
+        void                    SetMotion(Float32 positionX, Float32 velocityX) { mPositionX = positionX; mVelocityX = velocityX; }
 
     private:
         SharedPtr<core::Session> mSession;
         PlayerId mId;
+        Float32 mPositionX = 0.0f; // 월드 x 좌표
+        Float32 mVelocityX = 0.0f; // 틱당 이동 거리
 
         static Atomic<PlayerId> sNextId;
     };
@@ -43,7 +53,6 @@ namespace game
         PlayerManager() = default;
 
     private:
-        RW_LOCK;
-        HashMap<PlayerId, SharedPtr<Player>>   mPlayers;
+        core::RcuMap<PlayerId, SharedPtr<Player>>  mPlayers;
     };
 } // namespace game
@@ -4,69 +4,385 @@
 #include "Core/Concurrency/Thread.h"
 #include "Core/Io/Dispatcher.h"
 #include "Core/Network/Service.h"
+#include "Core/Network/Batch.h"
+#include "Core/Metric/Exporter.h"
 #include "GameServer/Network/Session.h"
 #include "GameServer/Chat/Room.h"
 #include "GameServer/Packet/Handler.h"
 #include "Protocol/Packet/Utils.h"
+#include "Protocol/Packet/Compression.h"
 #include "GameServer/Core/Loop.h"
 
 core::Service::Config gConfig =
 {
     core::NetAddress(TEXT_16("127.0.0.1"), 7777),
     std::make_shared<core::IoEventDispatcher>(),
-    std::make_shared<game::ClientSession>,
+    core::MakeSessionFactory<game::ClientSession>(),
     1000,
 };
 
-int main()
+// 종료 요청 신호 (Ctrl+C, Ctrl+Break, 콘솔 닫기)
+HANDLE gShutdownEvent = ::CreateEventW(nullptr, TRUE, FALSE, nullptr);
+// 종료 절차 완료 신호
+HANDLE gShutdownDoneEvent = ::CreateEventW(nullptr, TRUE, FALSE, nullptr);
+
+// 로컬 관리 포트의 메트릭 엔드포인트
+core::MetricExporter gMetricExporter;
+
+// 콘솔을 닫으면 핸들러가 반환된 직후 프로세스가 종료되므로 종료 절차를 기다리는 최대 시간
+constexpr DWORD kCloseWaitMs = 4'500;
+
+// 존 확장성 측정에서 워커 수마다 측정하는 틱 수
+constexpr Int64 kZoneBenchTickCount = 500;
+
+/**
+ * 실행 인자
+ *
+ * --record <path>          게임 루프가 처리하는 패킷을 틱 단위로 기록
+ * --replay <path>          네트워크 없이 기록된 틱 파일을 재생한 뒤 종료
+ * --zone-bench <entities>  네트워크 없이 엔티티 수를 고정하고 존 워커 수별 틱 시간을 측정한 뒤 종료
+ * --threads <role>=<count> 역할별 스레드 수 지정 (예: --threads io=8), 반복 가능
+ * --pin                    모든 역할의 스레드를 논리 프로세서 하나에 고정
+ * --log <module>=<level>   모듈별 로그 레벨 지정 (예: --log network=debug, --log all=warn), 반복 가능
+ * --log-file <path>        모듈별 로그 레벨 파일을 감시해 변경 시 재시작 없이 적용
+ * --metrics-port <port>    127.0.0.1:<port>/metrics 에서 메트릭 제공 (기본 9100, 0이면 비활성화)
+ * --compression            C2S_Hello로 압축을 요청한 클라이언트에 zstd 압축 허용
+ * --dictionary <path>      압축 사전 파일 로드 (클라이언트와 같은 사전이어야 압축 협상 성공)
+ * --compress-threshold <bytes>  이 크기 이상인 페이로드만 압축 (기본 64)
+ * --send-batch-us <us>     틱/잡 처리 동안의 송신을 세션마다 묶어 보내고, 묶인 송신의 최대 지연을 지정 (기본 0: 즉시 송신)
+ * --max-sessions <count>   동시에 유지할 최대 세션 수 (기본 1000, 룸 부하 테스트는 10000)
+ * --listeners <count>      7777부터 연속된 포트에 리슨 소켓을 count개 생성 (기본 1, 클라이언트도 같은 수로 지정)
+ * --accept-workers         리스너마다 전용 디스패처와 입출력 워커 하나를 두어 연결 수락을 세션 송수신과 분리
+ * --max-pending-accepts <count>  리스너마다 미리 걸어 두는 AcceptEx 수의 상한 (기본 256, 도착률에 맞춰 조정)
+ */
+struct Options
 {
+    String8     recordPath;
+    String8     replayPath;
+    Int64       zoneBenchEntities = 0;
+    UInt16      metricsPort = 9100;
+    Bool        acceptWorkers = false;
+};
+
+void ParseThreadOption(String8View option)
+{
+    const auto separator = option.find('=');
+    core::ThreadRole role;
+    if ((separator == String8View::npos) ||
+        !core::ThreadManager::FindRole(option.substr(0, separator), OUT role))
+    {
+        core::gLogger->Warn(TEXT_8("Invalid thread option: {}"), option);
+        return;
+    }
+
+    core::ThreadRoleConfig config = core::gThreadManager->GetRoleConfig(role);
+    config.count = std::max(std::atoi(String8(option.substr(separator + 1)).c_str()), 1);
+    core::gThreadManager->SetRoleConfig(role, config);
+}
+
+// 0 ~ 65535 범위의 10진수 포트만 허용 (실패하면 port를 바꾸지 않음)
+Bool ParsePort(const Char8* text, OUT UInt16& port)
+{
+    Char8* end = nullptr;
+    errno = 0;
+    const Int64 value = std::strtoll(text, &end, 10);
+    if ((end == text) || (*end != '\0') || (errno != 0) || (value < 0) || (value > std::numeric_limits<UInt16>::max()))
+    {
+        return false;
+    }
+
+    port = static_cast<UInt16>(value);
+    return true;
+}
+
+void PinAllRoles()
+{
+    for (Int32 i = 0; i < static_cast<Int32>(core::ThreadRole::Count); ++i)
+    {
+        const auto role = static_cast<core::ThreadRole>(i);
+        core::ThreadRoleConfig config = core::gThreadManager->GetRoleConfig(role);
+        config.pinned = true;
+        core::gThreadManager->SetRoleConfig(role, config);
+    }
+}
+
+Options ParseOptions(int argc, char* argv[])
+{
+    Options options;
+    for (int i = 1; i < argc; ++i)
+    {
+        const String8View arg = argv[i];
+        if (arg == "--pin")
+        {
+            PinAllRoles();
+        }
+        else if (arg == "--compression")
+        {
+            proto::PacketCompressor::GetInstance().SetEnabled(true);
+        }
+        else if (arg == "--accept-workers")
+        {
+            options.acceptWorkers = true;
+        }
+        else if (i + 1 == argc)
+        {
+            break;
+        }
+        else if (arg == "--threads")
+        {
+            ParseThreadOption(argv[++i]);
+        }
+        else if (arg == "--log")
+        {
+            if (!core::gLogger->ApplyLevelOption(argv[++i]))
+            {
+                core::gLogger->Warn(TEXT_8("Invalid log option: {}"), argv[i]);
+            }
+        }
+        else if (arg == "--log-file")
+        {
+            core::gLogger->WatchLevelFile(argv[++i]);
+        }
+        else if (arg == "--record")
+        {
+            options.recordPath = argv[++i];
+        }
+        else if (arg == "--replay")
+        {
+            options.replayPath = argv[++i];
+        }
+        else if (arg == "--zone-bench")
+        {
+            options.zoneBenchEntities = std::max<Int64>(std::atoll(argv[++i]), 1);
+        }
+        else if (arg == "--metrics-port")
+        {
+            if (!ParsePort(argv[++i], OUT options.metricsPort))
+            {
+                core::gLogger->Warn(TEXT_8("Invalid metrics port: {} (using {})"), argv[i], options.metricsPort);
+            }
+        }
+        else if (arg == "--dictionary")
+        {
+            proto::PacketCompressor::GetInstance().LoadDictionary(argv[++i]);
+        }
+        else if (arg == "--compress-threshold")
+        {
+            proto::PacketCompressor::GetInstance().SetThreshold(std::atoll(argv[++i]));
+        }
+        else if (arg == "--send-batch-us")
+        {
+            core::SendBatch::Configure(std::atoll(argv[++i]));
+        }
+        else if (arg == "--max-sessions")
+        {
+            gConfig.maxSessionCount = std::max<Int64>(std::atoll(argv[++i]), 1);
+        }
+        else if (arg == "--listeners")
+        {
+            gConfig.listenerCount = std::max<Int64>(std::atoll(argv[++i]), 1);
+        }
+        else if (arg == "--max-pending-accepts")
+        {
+            gConfig.maxPendingAccepts = std::max<Int64>(std::atoll(argv[++i]), 1);
+        }
+    }
+
+    return options;
+}
+
+BOOL WINAPI HandleConsoleCtrl(DWORD ctrlType)
+{
+    switch (ctrlType)
+    {
+    case CTRL_C_EVENT:
+    case CTRL_BREAK_EVENT:
+        ::SetEvent(gShutdownEvent);
+        return TRUE;
+    case CTRL_CLOSE_EVENT:
+        ::SetEvent(gShutdownEvent);
+        ::WaitForSingleObject(gShutdownDoneEvent, kCloseWaitMs);
+        return TRUE;
+    default:
+        return FALSE;
+    }
+}
+
+/**
+ * 서버를 단계별로 종료하고 단계별 소요 시간을 기록합니다.
+ *
+ * 동작:
+ * 1. 새 연결 수락 중지
+ * 2. 게임 루프와 존 워커 중지
+ * 3. 잡 타이머 중지 (실행 시간이 된 잡까지 분배하고 남은 예약은 폐기)
+ * 4. 잡 워커가 남은 잡 큐를 모두 비운 뒤 종료
+ * 5. 대기 중인 송신을 기한 내에 마무리하고 모든 세션 연결 해제
+ * 6. 입출력 워커와 연결 수락 워커 중지
+ * 7. 메트릭 엔드포인트 중지 (종료 중에도 스크레이프 가능)
+ */
+void Shutdown(const SharedPtr<core::ServerService>& service)
+{
+    using Clock = std::chrono::steady_clock;
+
+    const auto begin = Clock::now();
+    auto phaseBegin = begin;
+    auto endPhase = [&phaseBegin](const Char8* phase)
+                    {
+                        const auto now = Clock::now();
+                        core::gLogger->Info(TEXT_8("Shutdown: {} took {} ms"), phase,
+                                            std::chrono::duration_cast<MilliSec>(now - phaseBegin).count());
+                        phaseBegin = now;
+                    };
+
+    core::gLogger->Info(TEXT_8("Shutdown: Started"));
+
+    service->StopAccept();
+    endPhase(TEXT_8("Stop accept"));
+
+    game::Loop::GetInstance().Stop();
+    core::gThreadManager->Join(core::ThreadRole::Loop);
+    core::gThreadManager->Join(core::ThreadRole::Zone);
+    endPhase(TEXT_8("Stop loop"));
+
+    core::gJobTimer->Stop();
+    core::gThreadManager->Join(core::ThreadRole::Timer);
+    endPhase(TEXT_8("Stop job timer"));
+
+    core::gJobQueueManager->Stop();
+    core::gThreadManager->Join(core::ThreadRole::Job);
+    endPhase(TEXT_8("Drain job queues"));
+
+    // 송신 마무리 후 연결 해제 완료까지 대기 (입출력 워커 중지 전)
+    service->Stop();
+    endPhase(TEXT_8("Drain sessions"));
+
+    service->GetIoEventDispatcher()->Stop();
+    for (const auto& dispatcher : service->GetConfig().acceptDispatchers)
+    {
+        dispatcher->Stop();
+    }
+    core::gThreadManager->Join();
+    endPhase(TEXT_8("Stop io workers"));
+
+    gMetricExporter.Stop();
+
+    core::gLogger->Info(TEXT_8("Shutdown: Completed in {} ms"),
+                        std::chrono::duration_cast<MilliSec>(Clock::now() - begin).count());
+}
+
+int main(int argc, char* argv[])
+{
+    const Options options = ParseOptions(argc, argv);
+
+    // 기록된 틱 재생 (소켓과 잡 워커 없이 메인 스레드에서 실행)
+    if (!options.replayPath.empty())
+    {
+        const Bool result = game::Loop::GetInstance().Replay(options.replayPath);
+        core::gThreadManager->Join();
+
+        return result ? 0 : 1;
+    }
+
+    // 존 병렬 갱신 확장성 측정 (소켓 없이 메인 스레드와 존 워커만 사용)
+    if (options.zoneBenchEntities > 0)
+    {
+        game::World::RunScalingBenchmark(options.zoneBenchEntities, kZoneBenchTickCount);
+        core::gThreadManager->Join();
+
+        return 0;
+    }
+
+    // 기록 파일을 열지 못하면 서버를 시작하지 않음 (오류는 TickRecorder가 출력)
+    if (!options.recordPath.empty())
+    {
+        const Bool isRecording = game::Loop::GetInstance().StartRecording(options.recordPath);
+        if (!isRecording)
+        {
+            return 1;
+        }
+    }
+
+    ::SetConsoleCtrlHandler(HandleConsoleCtrl, TRUE);
+
+    // 리스너마다 연결 수락 전용 디스패처 생성
+    if (options.acceptWorkers)
+    {
+        for (Int64 i = 0; i < gConfig.listenerCount; ++i)
+        {
+            gConfig.acceptDispatchers.push_back(std::make_shared<core::IoEventDispatcher>());
+        }
+    }
+
     // 서버 서비스 생성 및 실행
     auto service = std::make_shared<core::ServerService>(gConfig);
     ASSERT_CRASH(SUCCESS == service->Run(), "SERVER_SERVICE_RUN_FAILED");
 
+    // 메트릭 엔드포인트 실행 (실패해도 서버는 계속 실행)
+    if (options.metricsPort != 0)
+    {
+        const Int64 result = gMetricExporter.Start(options.metricsPort);
+        if (result != SUCCESS)
+        {
+            core::gLogger->Warn(TEXT_8("MetricExporter: Failed to listen on port {}: {}"), options.metricsPort, result);
+        }
+    }
+
     // 게임 루프 실행
-    core::gThreadManager->Launch([]
+    core::gThreadManager->Launch(core::ThreadRole::Loop, []
                            {
                                game::Loop::GetInstance().Run();
                            });
 
     // 입출력 워커 실행
-    for (Int64 i = 0; i < 4; ++i)
+    for (Int32 i = 0; i < core::gThreadManager->GetRoleConfig(core::ThreadRole::Io).count; ++i)
     {
-        core::gThreadManager->Launch([service]
+        core::gThreadManager->Launch(core::ThreadRole::Io, [service]
                                {
-                                   while (true)
+                                   while (service->GetIoEventDispatcher()->IsRunning())
                                    {
                                        Int64 result = service->GetIoEventDispatcher()->Dispatch();
                                    }
                                });
     }
 
+    // 연결 수락 워커 실행 (디스패처마다 하나)
+    for (const auto& dispatcher : gConfig.acceptDispatchers)
+    {
+        core::gThreadManager->Launch(core::ThreadRole::Io, [dispatcher]
+                               {
+                                   while (dispatcher->IsRunning())
+                                   {
+                                       Int64 result = dispatcher->Dispatch();
+                                   }
+                               });
+    }
+
     // 잡 워커 실행
-    for (Int64 i = 0; i < 3; ++i)
+    for (Int32 i = 0; i < core::gThreadManager->GetRoleConfig(core::ThreadRole::Job).count; ++i)
     {
-        core::gThreadManager->Launch([]
+        core::gThreadManager->Launch(core::ThreadRole::Job, []
                                {
                                    core::gJobQueueManager->FlushQueues();
                                });
     }
 
     // 잡 타이머 실행
-    core::gThreadManager->Launch([]
+    core::gThreadManager->Launch(core::ThreadRole::Timer, []
                            {
                                core::gJobTimer->Run();
                            });
 
-    // 룸 브로드캐스트 루프 실행
+    // 로비 브로드캐스트 루프 실행
     proto::S2C_Chat chat;
     chat.set_id(0);
     chat.set_message(TEXT_8("Hello World!"));
-    game::gRoom->StartBroadcastLoop(proto::PacketUtils::MakeSendBuffer(chat, proto::PacketId::S2C_Chat), 100);
+    auto lobby = game::RoomManager::GetInstance().GetOrCreateRoom(game::RoomManager::kLobbyRoomId);
+    lobby->Spawn(lobby->RunBroadcastLoop(proto::PacketUtils::MakeSendBuffers(chat, proto::PacketId::S2C_Chat), 100));
 
-    core::gThreadManager->Join();
-
-    // 서버 서비스 서비스 중지
-    service->Stop();
+    // 종료 요청까지 대기한 뒤 서버 종료
+    ::WaitForSingleObject(gShutdownEvent, INFINITE);
+    Shutdown(service);
+    ::SetEvent(gShutdownDoneEvent);
 
     return 0;
 }
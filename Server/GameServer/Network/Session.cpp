@@ -3,41 +3,41 @@
 #include "GameServer/Pch.h"
 #include "GameServer/Network/Session.h"
 #include "GameServer/Packet/Handler.h"
-#include "GameServer/Chat/Room.h"
-#include "GameServer/Entity/Player.h"
 #include "GameServer/Core/Loop.h"
 
 namespace game
 {
     ClientSession::~ClientSession()
     {
-        core::gLogger->Info(TEXT_8("Session[{}]: Destroyed"), GetId());
+        LOG_DEBUG(Network, TEXT_8("Session[{}]: Destroyed"), GetId());
     }
 
     void ClientSession::OnConnected()
     {
-        core::gLogger->Info(TEXT_8("Session[{}]: Connected to client"), GetId());
+        LOG_INFO(Network, TEXT_8("Session[{}]: Connected to client"), GetId());
     }
 
     void ClientSession::OnDisconnected(String8 cause)
     {
-        core::gLogger->Warn(TEXT_8("Session[{}]: Disconnected from client: {}"), GetId(), cause);
+        LOG_WARN(Network, TEXT_8("Session[{}]: Disconnected from client: {}"), GetId(), cause);
 
-        // 방에서 퇴장
-        gRoom->Leave(GetPlayerId());
-
-        // 플레이어 매니저에서 제거
-        PlayerManager::GetInstance().RemovePlayer(GetPlayerId());
-        SetPlayerId(0);
+        // 방 퇴장 명령 전달 (플레이어/방 ID는 게임 루프 스레드에서 읽음)
+        game::Loop::GetInstance().PushCommand(LeaveRoomCommand{GetSession()});
     }
 
     Int64 ClientSession::OnReceived(const Byte* buffer, Int64 numBytes)
     {
-        return game::Loop::GetInstance().PushPackets(GetSession(), buffer, numBytes);
+        return game::Loop::GetInstance().PushPackets(GetSession(), mAssembler, buffer, numBytes);
     }
 
     void ClientSession::OnSent(Int64 numBytes)
     {}
 
-    SharedPtr<Room>     gRoom = std::make_shared<Room>();
+    void ClientSession::OnReset()
+    {
+        mPlayerId = 0;
+        mRoomId = 0;
+        mLastEgressUs.store(0, std::memory_order_relaxed);
+        mAssembler.Reset();
+    }
 } // namespace game
@@ -3,11 +3,10 @@
 #pragma once
 
 #include "Core/Network/Session.h"
+#include "Protocol/Packet/Assembler.h"
 
 namespace game
 {
-    class Room;
-
     class ClientSession
         : public core::Session
     {
@@ -16,16 +15,24 @@ namespace game
 
         void                SetPlayerId(Int64 id) { mPlayerId = id; }
         Int64               GetPlayerId() const { return mPlayerId; }
+        void                SetRoomId(Int64 id) { mRoomId = id; }
+        Int64               GetRoomId() const { return mRoomId; }
+        void                SetLastEgressUs(Int64 us) { mLastEgressUs.store(us, std::memory_order_relaxed); }
+        Int64               GetLastEgressUs() const { return mLastEgressUs.load(std::memory_order_relaxed); }
+        void                SetCompressedFramesAllowed(Bool allowed) { mAssembler.SetCompressionAllowed(allowed); }
 
     protected:
         virtual void        OnConnected() override;
         virtual void        OnDisconnected(String8 cause) override;
         virtual Int64       OnReceived(const Byte* buffer, Int64 numBytes) override;
         virtual void        OnSent(Int64 numBytes) override;
+        virtual void        OnReset() override;
 
     private:
+        // 게임 루프 스레드(명령 실행)에서만 접근, 세션을 재사용할 때는 아무 명령도 세션을 참조하지 않음
         Int64               mPlayerId = 0;
+        Int64               mRoomId = 0;
+        Atomic<Int64>       mLastEgressUs = 0;  // 직전 퐁의 핸들러 종료부터 송신 완료까지 걸린 시간
+        proto::PacketAssembler  mAssembler;     // 수신 프레임 재조립 (수신 완료 처리에서만 사용)
     };
-
-    extern SharedPtr<game::Room>    gRoom;
 } // namespace game
@@ -2,39 +2,126 @@
 
 #include "GameServer/Pch.h"
 #include "GameServer/Packet/Handler.h"
+#include "GameServer/Core/Loop.h"
 #include "GameServer/Network/Session.h"
 #include "Protocol/Packet/Utils.h"
-#include "GameServer/Chat/Room.h"
-#include "GameServer/Entity/Player.h"
+#include "Protocol/Packet/Compression.h"
+#include "Core/Metric/Metric.h"
 
 namespace game
 {
     Bool C2S_PacketDispatcher::Handle_C2S_EnterRoom(const SharedPtr<core::Session>& owner, const proto::C2S_EnterRoom& payload)
     {
-        // 플레이어 생성 및 매니저에 추가
-        auto player = std::make_shared<Player>(owner, payload.id());
-        std::static_pointer_cast<ClientSession>(owner)->SetPlayerId(payload.id());
-        PlayerManager::GetInstance().AddPlayer(player);
+        // 방 입장 명령으로 변환
+        Loop::GetInstance().PushCommand(EnterRoomCommand{owner, payload.id(), payload.room_id()});
 
-        // 방 입장
-        gRoom->Enter(std::move(player));
+        return true;
+    }
+
+    Bool C2S_PacketDispatcher::Handle_C2S_Chat(const SharedPtr<core::Session>& owner, const proto::C2S_Chat& payload)
+    {
+        // 클라이언트가 보낸 길이를 그대로 브로드캐스트하지 않도록 거부
+        if (static_cast_64(payload.message().size()) > ChatCommand::kMaxMessageSize)
+        {
+            LOG_WARN(Game, TEXT_8("Session[{}]: Chat message too long: {}"), owner->GetId(), payload.message().size());
+            return false;
+        }
 
-        // 방 입장 처리 패킷 전송
-        proto::S2C_EnterRoom enterRoom;
-        enterRoom.set_id(payload.id());
-        enterRoom.set_success(true);
-        proto::PacketUtils::Send(owner, enterRoom);
+        // 채팅 명령으로 변환
+        Loop::GetInstance().PushChatCommand(ChatCommand{owner, payload.id()}, payload.message());
 
         return true;
     }
 
-    Bool C2S_PacketDispatcher::Handle_C2S_Chat(const SharedPtr<core::Session>& owner, const proto::C2S_Chat& payload)
+    /**
+     * 압축 협상 요청에 응답합니다.
+     *
+     * 동작:
+     * 1. 요청한 압축 방식과 사전 ID가 서버 설정과 맞으면 압축을 허용
+     * 2. 허용하면 응답 전에 압축된 프레임 수신을 허용 (응답을 받은 클라이언트는 바로 압축해 보낼 수 있음)
+     * 3. 허용 여부를 S2C_Hello로 응답 (허용하지 않으면 compression은 None)
+     * 4. 응답을 보낸 뒤 세션의 압축을 활성화 (응답 자체는 압축하지 않음)
+     */
+    Bool C2S_PacketDispatcher::Handle_C2S_Hello(const SharedPtr<core::Session>& owner, const proto::C2S_Hello& payload)
     {
-        // 룸의 모든 플레이어에게 메시지 전송
-        proto::S2C_Chat chat;
-        chat.set_id(payload.id());
-        chat.set_message(payload.message());
-        gRoom->Broadcast(proto::PacketUtils::MakeSendBuffer(chat, proto::PacketId::S2C_Chat), payload.id());
+        const proto::PacketCompressor& compressor = proto::PacketCompressor::GetInstance();
+        const auto type = static_cast<proto::CompressionType>(payload.compression());
+        const Bool isAccepted = compressor.IsCompatible(type, payload.dictionary_id());
+
+        if (isAccepted)
+        {
+            std::static_pointer_cast<ClientSession>(owner)->SetCompressedFramesAllowed(true);
+        }
+
+        proto::S2C_Hello hello;
+        hello.set_compression(static_cast_64(isAccepted ? type : proto::CompressionType::None));
+        hello.set_dictionary_id(compressor.GetDictionaryId());
+        proto::PacketUtils::Send(owner, hello);
+
+        owner->SetCompressionEnabled(isAccepted);
+
+        LOG_DEBUG(Network, TEXT_8("Session[{}]: Compression {} (requested={}, dictionary={})"),
+                  owner->GetId(), isAccepted ? TEXT_8("enabled") : TEXT_8("rejected"), payload.compression(), payload.dictionary_id());
+
+        return true;
+    }
+
+    /**
+     * 지연 측정 핑에 바로 퐁으로 응답합니다.
+     *
+     * 동작:
+     * 1. 수신 완료/틱 시작/큐에서 꺼낸 시각으로 틱 대기와 큐 대기 시간 계산
+     * 2. 핸들러 종료 시각까지의 처리 시간과 직전 퐁의 송신 시간을 담아 퐁 전송
+     * 3. 퐁을 담은 송신이 완료되면 송신 시간을 세션에 기록해 다음 퐁에 실어 보냄
+     *
+     * 클라이언트는 왕복 시간에서 서버 구간을 빼 커널/네트워크 구간을 계산합니다.
+     * 시각이 아니라 구간 길이만 보내므로 서버와 클라이언트의 시계가 달라도 됩니다.
+     */
+    Bool C2S_PacketDispatcher::Handle_C2S_Ping(const SharedPtr<core::Session>& owner, const proto::C2S_Ping& payload)
+    {
+        static core::Histogram& sEgressTime = core::gMetricRegistry->AddHistogram(TEXT_8("game_pong_egress_microseconds"),
+                                                                                  TEXT_8("Pong handler exit to send completion"));
+
+        const proto::RawPacket* packet = GetCurrentPacket();
+        ASSERT_CRASH_DEBUG(packet != nullptr, "NO_CURRENT_PACKET");
+
+        Int64 tickWaitUs = 0;
+        Int64 queueUs = 0;
+        Loop::GetInstance().GetIngressDelay(*packet, OUT tickWaitUs, OUT queueUs);
+
+        auto session = std::static_pointer_cast<ClientSession>(owner);
+
+        proto::S2C_Pong pong;
+        pong.set_sequence(payload.sequence());
+        pong.set_client_send_us(payload.client_send_us());
+        pong.set_tick_wait_us(tickWaitUs);
+        pong.set_queue_us(queueUs);
+        pong.set_egress_us(session->GetLastEgressUs());
+
+        const Int64 handlerExitUs = core::GetSteadyNowUs();
+        if (packet->GetPopUs() > 0)
+        {
+            pong.set_handler_us(handlerExitUs - packet->GetPopUs());
+        }
+
+        // 퐁은 한 프레임에 들어가므로 압축하지 않고 그 버퍼의 송신 완료만 기다림
+        SharedPtr<core::SendBuffer> buffer = proto::PacketUtils::MakeSendBuffer(pong, proto::PacketId::S2C_Pong);
+        if (buffer == nullptr)
+        {
+            return false;
+        }
+
+        owner->SendAndNotify(std::move(buffer), [session, handlerExitUs](Bool sent)
+                             {
+                                 if (!sent)
+                                 {
+                                     return;
+                                 }
+
+                                 const Int64 egressUs = core::GetSteadyNowUs() - handlerExitUs;
+                                 session->SetLastEgressUs(egressUs);
+                                 sEgressTime.Record(egressUs);
+                             });
 
         return true;
     }
@@ -25,10 +25,14 @@ namespace game
             
             RegisterHandler<C2S_EnterRoom>(&Handle_C2S_EnterRoom, PacketId::C2S_EnterRoom);
             RegisterHandler<C2S_Chat>(&Handle_C2S_Chat, PacketId::C2S_Chat);
+            RegisterHandler<C2S_Ping>(&Handle_C2S_Ping, PacketId::C2S_Ping);
+            RegisterHandler<C2S_Hello>(&Handle_C2S_Hello, PacketId::C2S_Hello);
         }
 
     private:    // 모든 페이로드 핸들러
         static Bool     Handle_C2S_EnterRoom(const SharedPtr<core::Session>& owner, const proto::C2S_EnterRoom& payload);
         static Bool     Handle_C2S_Chat(const SharedPtr<core::Session>& owner, const proto::C2S_Chat& payload);
+        static Bool     Handle_C2S_Ping(const SharedPtr<core::Session>& owner, const proto::C2S_Ping& payload);
+        static Bool     Handle_C2S_Hello(const SharedPtr<core::Session>& owner, const proto::C2S_Hello& payload);
     };
 } // namespace game
\ No newline at end of file
@@ -0,0 +1,153 @@
+﻿/*    Protocol/Packet/Assembler.cpp    */
+
+#include "Protocol/Pch.h"
+#include "Protocol/Packet/Assembler.h"
+#include "Protocol/Packet/Compression.h"
+#include "Core/Network/Session.h"
+
+namespace proto
+{
+    Atomic<Int64> PacketAssembler::sTotalAssemblySize = 0;
+
+    PacketAssembler::~PacketAssembler()
+    {
+        Reset();
+    }
+
+    Bool PacketAssembler::IsValidFrame(const PacketHeader& header)
+    {
+        if ((header.size < kPacketHeaderSize) || (header.size > kMaxFrameSize))
+        {
+            return false;
+        }
+
+        // 디스패처의 핸들러 테이블은 [0, Int16 최대값] 범위만 가짐
+        if (static_cast_16(header.id) < 0)
+        {
+            return false;
+        }
+
+        return ((header.flags & ~PacketHeader::kValidFlags) == 0);
+    }
+
+    /**
+     * 동작:
+     * 1. 재조립 중인 메시지가 없고 압축되지 않은 마지막 프레임이면 프레임을 그대로 패킷으로 생성
+     *    (압축을 협상하지 않은 세션의 압축된 프레임은 해제하지 않고 실패)
+     * 2. 이어지는 프레임은 비어 있지 않아야 하고, 재조립 중인 메시지와 id, 압축 여부가 같아야 함
+     * 3. 페이로드를 붙였을 때 kMaxMessageSize를 넘거나 전체 재조립 한도를 넘으면 실패
+     * 4. 마지막 프레임이면 압축된 메시지는 해제하고, 헤더의 크기를 메시지 전체 크기로 바꾸고 패킷 생성
+     */
+    Int64 PacketAssembler::Assemble(const SharedPtr<core::Session>& owner, const Byte* frame, OUT SharedPtr<RawPacket>& packet)
+    {
+        const PacketHeader* header = reinterpret_cast<const PacketHeader*>(frame);
+        const Bool hasMoreFragments = ((header->flags & PacketHeader::kFlagMoreFragments) != 0);
+        const Bool isCompressed = ((header->flags & PacketHeader::kFlagCompressed) != 0);
+        const Int32 payloadSize = header->size - kPacketHeaderSize;
+
+        packet = nullptr;
+
+        // 조각나지 않은 메시지
+        if (mMessage.empty() && !hasMoreFragments && !isCompressed)
+        {
+            packet = std::make_shared<RawPacket>(owner, frame);
+            return SUCCESS;
+        }
+
+        // 압축을 협상하지 않은 세션이 해제 비용을 유발하지 못하도록 거부
+        if (isCompressed && !mIsCompressionAllowed.load(std::memory_order_acquire))
+        {
+            return FAILURE;
+        }
+
+        // 내용 없이 이어지는 프레임으로 재조립을 끝없이 유지하는 것을 막음
+        if (hasMoreFragments && (payloadSize == 0))
+        {
+            return FAILURE;
+        }
+
+        const Int64 headerSize = mMessage.empty() ? kPacketHeaderSize : 0;
+        if (!mMessage.empty())
+        {
+            const PacketHeader* messageHeader = reinterpret_cast<const PacketHeader*>(mMessage.data());
+            if ((messageHeader->id != header->id) ||
+                ((messageHeader->flags & PacketHeader::kFlagCompressed) != (header->flags & PacketHeader::kFlagCompressed)))
+            {
+                return FAILURE;
+            }
+        }
+
+        if (static_cast_64(mMessage.size()) + headerSize + payloadSize > kMaxMessageSize)
+        {
+            return FAILURE;
+        }
+
+        if (!Reserve(headerSize + payloadSize))
+        {
+            LOG_WARN(Network, TEXT_8("Session[{}]: Total reassembly limit reached ({} bytes)"), owner->GetId(), GetTotalAssemblySize());
+            return FAILURE;
+        }
+
+        if (headerSize > 0)
+        {
+            mMessage.assign(frame, frame + kPacketHeaderSize);
+        }
+
+        mMessage.insert(mMessage.end(), frame + kPacketHeaderSize, frame + header->size);
+
+        if (hasMoreFragments)
+        {
+            return SUCCESS;
+        }
+
+        if (isCompressed)
+        {
+            // 해제한 메시지의 헤더는 크기와 플래그가 설정되어 있음
+            if (PacketCompressor::GetInstance().Decompress(mMessage) == FAILURE)
+            {
+                return FAILURE;
+            }
+        }
+        else
+        {
+            PacketHeader* messageHeader = reinterpret_cast<PacketHeader*>(mMessage.data());
+            messageHeader->size = static_cast_32(mMessage.size());
+            messageHeader->flags = 0;
+        }
+
+        packet = std::make_shared<RawPacket>(owner, std::move(mMessage));
+        ReleaseMessage();
+
+        return SUCCESS;
+    }
+
+    void PacketAssembler::Reset()
+    {
+        ReleaseMessage();
+        mIsCompressionAllowed.store(false, std::memory_order_relaxed);
+    }
+
+    void PacketAssembler::ReleaseMessage()
+    {
+        mMessage.clear();
+
+        if (mReservedSize > 0)
+        {
+            sTotalAssemblySize.fetch_sub(mReservedSize, std::memory_order_relaxed);
+            mReservedSize = 0;
+        }
+    }
+
+    Bool PacketAssembler::Reserve(Int64 size)
+    {
+        const Int64 total = sTotalAssemblySize.fetch_add(size, std::memory_order_relaxed) + size;
+        if (total > kMaxTotalAssemblySize)
+        {
+            sTotalAssemblySize.fetch_sub(size, std::memory_order_relaxed);
+            return false;
+        }
+
+        mReservedSize += size;
+        return true;
+    }
+} // namespace proto
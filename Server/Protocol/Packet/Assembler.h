@@ -0,0 +1,74 @@
+﻿/*    Protocol/Packet/Assembler.h    */
+
+#pragma once
+
+#include "Protocol/Packet/Type.h"
+
+namespace proto
+{
+    /*
+     * PacketAssembler - 세션별 수신 프레임 검증 및 메시지 재조립
+     *
+     * 주요 기능:
+     * - 프레임 헤더의 크기/플래그를 검증해 잘못된 길이를 가진 프레임을 거부
+     * - 조각나지 않은 프레임은 바로 패킷으로 변환
+     * - 조각난 프레임은 마지막 프레임이 도착할 때까지 페이로드를 이어 붙인 뒤 하나의 패킷으로 변환
+     * - 압축된 메시지는 완성된 뒤 PacketCompressor로 해제해 압축하지 않은 패킷과 같은 형태로 변환
+     *   (압축 협상 전에는 압축된 프레임을 프로토콜 위반으로 거부)
+     * - 모든 세션이 재조립 중인 메시지의 크기 합을 kMaxTotalAssemblySize로 제한
+     *
+     * 스레드 규칙:
+     * - 세션의 수신 완료 처리에서만 호출 (세션마다 수신 등록은 하나이므로 동시에 호출되지 않음)
+     * - SetCompressionAllowed는 압축을 협상하는 스레드에서 호출 (원자적 플래그)
+     */
+    class PacketAssembler
+    {
+    public:
+        PacketAssembler() = default;
+        ~PacketAssembler();
+
+        PacketAssembler(const PacketAssembler&) = delete;
+        PacketAssembler& operator=(const PacketAssembler&) = delete;
+
+        /**
+         * 프레임 헤더가 유효한지 검사합니다.
+         *
+         * @param header 검사할 프레임 헤더
+         * @return 크기가 [kPacketHeaderSize, kMaxFrameSize] 범위이고, id가 음수가 아니고, 알 수 없는 플래그가 없으면 true
+         */
+        static Bool     IsValidFrame(const PacketHeader& header);
+
+        /**
+         * 수신한 프레임을 재조립 중인 메시지에 추가합니다.
+         *
+         * @param owner 패킷 소유자 세션
+         * @param frame 전체가 수신된 프레임 (IsValidFrame으로 검증된 헤더)
+         * @param packet 메시지가 완성되면 생성된 패킷, 아니면 nullptr
+         * @return 성공하면 SUCCESS, 프로토콜 위반이거나 전체 재조립 한도를 넘거나 해제에 실패하면 FAILURE (연결을 끊어야 함)
+         */
+        Int64           Assemble(const SharedPtr<core::Session>& owner, const Byte* frame, OUT SharedPtr<RawPacket>& packet);
+
+        // 재조립 중인 메시지를 버리고 압축 허용을 해제 (세션을 다시 사용할 때 호출)
+        void            Reset();
+
+        // 압축된 프레임 수신 허용 (서버는 압축을 허용한 응답 전에, 클라이언트는 압축을 요청할 때 설정)
+        void            SetCompressionAllowed(Bool allowed) { mIsCompressionAllowed.store(allowed, std::memory_order_release); }
+
+    public:
+        // 모든 세션이 재조립 중인 메시지 크기의 합 (세션마다 kMaxMessageSize까지 쌓이는 것을 제한)
+        static constexpr Int64  kMaxTotalAssemblySize = 0x1000'0000; // 256MB
+
+        static Int64    GetTotalAssemblySize() { return sTotalAssemblySize.load(std::memory_order_relaxed); }
+
+    private:
+        Bool            Reserve(Int64 size);
+        void            ReleaseMessage(); // 완성했거나 버린 메시지의 버퍼와 예약을 반환
+
+    private:
+        static Atomic<Int64>    sTotalAssemblySize;
+
+        Vector<Byte>    mMessage; // 재조립 중인 메시지 (첫 프레임의 헤더 포함)
+        Int64           mReservedSize = 0; // sTotalAssemblySize에 더한 이 세션의 몫
+        Atomic<Bool>    mIsCompressionAllowed = false;
+    };
+} // namespace proto
@@ -0,0 +1,298 @@
+﻿/*    Protocol/Packet/Compression.cpp    */
+
+#include "Protocol/Pch.h"
+#include "Protocol/Packet/Compression.h"
+#include "Protocol/Packet/Stream.h"
+#include "Core/Network/Buffer.h"
+#include "Core/Metric/Metric.h"
+#include <zstd.h>
+#include <zdict.h>
+
+namespace proto
+{
+    namespace
+    {
+        // 스레드별 zstd 컨텍스트 (처음 사용할 때 생성하고 스레드 종료 시 해제)
+        struct ZstdContext
+        {
+            ~ZstdContext()
+            {
+                ::ZSTD_freeCCtx(compress);
+                ::ZSTD_freeDCtx(decompress);
+            }
+
+            ZSTD_CCtx* GetCompress()
+            {
+                if (compress == nullptr)
+                {
+                    compress = ::ZSTD_createCCtx();
+                }
+                return compress;
+            }
+
+            ZSTD_DCtx* GetDecompress()
+            {
+                if (decompress == nullptr)
+                {
+                    decompress = ::ZSTD_createDCtx();
+                }
+                return decompress;
+            }
+
+            ZSTD_CCtx*      compress = nullptr;
+            ZSTD_DCtx*      decompress = nullptr;
+            Vector<Byte>    scratch; // 프레임 하나에 들어가지 않는 압축 결과
+        };
+
+        thread_local ZstdContext tZstdContext;
+    } // namespace
+
+    PacketCompressor::PacketCompressor()
+        : mCompressInputBytes(core::gMetricRegistry->AddCounter(TEXT_8("net_compress_input_bytes_total"), TEXT_8("Payload bytes before compression")))
+        , mCompressOutputBytes(core::gMetricRegistry->AddCounter(TEXT_8("net_compress_output_bytes_total"), TEXT_8("Payload bytes after compression")))
+        , mCompressTimeUs(core::gMetricRegistry->AddCounter(TEXT_8("net_compress_microseconds_total"), TEXT_8("Time spent compressing payloads")))
+        , mDecompressInputBytes(core::gMetricRegistry->AddCounter(TEXT_8("net_decompress_input_bytes_total"), TEXT_8("Compressed payload bytes received")))
+        , mDecompressOutputBytes(core::gMetricRegistry->AddCounter(TEXT_8("net_decompress_output_bytes_total"), TEXT_8("Payload bytes after decompression")))
+        , mDecompressTimeUs(core::gMetricRegistry->AddCounter(TEXT_8("net_decompress_microseconds_total"), TEXT_8("Time spent decompressing payloads")))
+    {}
+
+    PacketCompressor::~PacketCompressor()
+    {
+        ::ZSTD_freeCDict(mCompressDictionary);
+        ::ZSTD_freeDDict(mDecompressDictionary);
+    }
+
+    /**
+     * 사전 파일을 로드합니다.
+     *
+     * @param path DictionaryTrainer가 만든 사전 파일 경로
+     * @return 성공 여부 (실패하면 사전 없이 압축)
+     */
+    Bool PacketCompressor::LoadDictionary(const String8& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open())
+        {
+            core::gLogger->Error(TEXT_8("PacketCompressor: Failed to open dictionary {}"), path);
+            return false;
+        }
+
+        const Vector<Byte> dictionary((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        if (dictionary.empty())
+        {
+            core::gLogger->Error(TEXT_8("PacketCompressor: Empty dictionary {}"), path);
+            return false;
+        }
+
+        ZSTD_CDict* compressDictionary = ::ZSTD_createCDict(dictionary.data(), dictionary.size(), kCompressionLevel);
+        ZSTD_DDict* decompressDictionary = ::ZSTD_createDDict(dictionary.data(), dictionary.size());
+        if ((compressDictionary == nullptr) || (decompressDictionary == nullptr))
+        {
+            ::ZSTD_freeCDict(compressDictionary);
+            ::ZSTD_freeDDict(decompressDictionary);
+            core::gLogger->Error(TEXT_8("PacketCompressor: Invalid dictionary {}"), path);
+            return false;
+        }
+
+        ::ZSTD_freeCDict(mCompressDictionary);
+        ::ZSTD_freeDDict(mDecompressDictionary);
+        mCompressDictionary = compressDictionary;
+        mDecompressDictionary = decompressDictionary;
+        mDictionaryId = ::ZSTD_getDictID_fromDict(dictionary.data(), dictionary.size());
+
+        core::gLogger->Info(TEXT_8("PacketCompressor: Loaded dictionary {} (id={}, {} bytes)"), path, mDictionaryId, dictionary.size());
+        return true;
+    }
+
+    Bool PacketCompressor::IsCompatible(CompressionType type, Int64 dictionaryId) const
+    {
+        return mIsEnabled && (type == CompressionType::Zstd) && (dictionaryId == mDictionaryId);
+    }
+
+    /**
+     * 동작:
+     * 1. 임계값 미만이면 압축하지 않음
+     * 2. 최대 압축 크기가 프레임 하나에 들어가면 송신 청크에 바로 압축
+     * 3. 들어가지 않으면 스레드별 버퍼에 압축한 뒤 프레임들로 복사
+     * 4. 압축 결과가 원본보다 작지 않으면 빈 목록 반환 (원본을 그대로 전송)
+     */
+    Vector<SharedPtr<core::SendBuffer>> PacketCompressor::Compress(PacketId id, const Byte* payload, Int64 payloadSize)
+    {
+        Vector<SharedPtr<core::SendBuffer>> frames;
+        if (payloadSize < mThreshold)
+        {
+            return frames;
+        }
+
+        const Int64 startUs = core::GetSteadyNowUs();
+        ZSTD_CCtx* context = tZstdContext.GetCompress();
+        const Int64 bound = static_cast_64(::ZSTD_compressBound(payloadSize));
+
+        auto compress = [this, context, payload, payloadSize](Byte* dest, Int64 capacity) -> Int64
+        {
+            const size_t result = (mCompressDictionary != nullptr)
+                                      ? ::ZSTD_compress_usingCDict(context, dest, capacity, payload, payloadSize, mCompressDictionary)
+                                      : ::ZSTD_compressCCtx(context, dest, capacity, payload, payloadSize, kCompressionLevel);
+            return ::ZSTD_isError(result) ? FAILURE : static_cast_64(result);
+        };
+
+        Int64 compressedSize = FAILURE;
+        if (bound <= kMaxFramePayloadSize)
+        {
+            SharedPtr<core::SendBuffer> frame = core::gSendChunkPool->Alloc(kPacketHeaderSize + bound);
+            PacketHeader* header = reinterpret_cast<PacketHeader*>(frame->GetBuffer());
+
+            compressedSize = compress(reinterpret_cast<Byte*>(header + 1), bound);
+            if ((compressedSize > 0) && (compressedSize < payloadSize))
+            {
+                header->size = kPacketHeaderSize + static_cast_32(compressedSize);
+                header->id = id;
+                header->flags = PacketHeader::kFlagCompressed;
+                frame->OnWritten(header->size);
+                frames.push_back(std::move(frame));
+            }
+            else
+            {
+                // 할당한 영역을 사용하지 않고 반환
+                frame->OnWritten(0);
+            }
+        }
+        else
+        {
+            Vector<Byte>& scratch = tZstdContext.scratch;
+            scratch.resize(bound);
+
+            compressedSize = compress(scratch.data(), bound);
+            if ((compressedSize > 0) && (compressedSize < payloadSize))
+            {
+                FrameOutputStream stream(id, compressedSize, PacketHeader::kFlagCompressed);
+                Int64 copiedSize = 0;
+                void* data = nullptr;
+                int size = 0;
+                while (stream.Next(&data, &size))
+                {
+                    ::memcpy(data, scratch.data() + copiedSize, size);
+                    copiedSize += size;
+                }
+                ASSERT_CRASH(stream.Finish(OUT frames), "COMPRESSED_FRAME_WRITE_FAILED");
+            }
+        }
+
+        if (!frames.empty())
+        {
+            mCompressInputBytes.Add(payloadSize);
+            mCompressOutputBytes.Add(compressedSize);
+        }
+        mCompressTimeUs.Add(core::GetSteadyNowUs() - startUs);
+
+        return frames;
+    }
+
+    Vector<SharedPtr<core::SendBuffer>> PacketCompressor::Compress(const SharedPtr<core::SendBuffer>& frame)
+    {
+        const PacketHeader* header = reinterpret_cast<const PacketHeader*>(frame->GetBuffer());
+        ASSERT_CRASH_DEBUG(header->flags == 0, "NOT_SINGLE_RAW_FRAME");
+
+        return Compress(header->id, reinterpret_cast<const Byte*>(header + 1), header->size - kPacketHeaderSize);
+    }
+
+    void PacketCompressor::LogStats() const
+    {
+        const Int64 inputBytes = mCompressInputBytes.GetValue();
+        const Int64 outputBytes = mCompressOutputBytes.GetValue();
+        const Float64 ratio = (inputBytes > 0) ? static_cast<Float64>(outputBytes) / inputBytes : 1.0;
+
+        core::gLogger->Info(TEXT_8("PacketCompressor: Input={} bytes, Output={} bytes, Ratio={:.3f}, CompressCpu={:.1f} ms, DecompressCpu={:.1f} ms"),
+                            inputBytes, outputBytes, ratio, mCompressTimeUs.GetValue() / 1000.0, mDecompressTimeUs.GetValue() / 1000.0);
+    }
+
+    /**
+     * 동작:
+     * 1. 압축 프레임 헤더의 원본 크기를 읽어 제한을 넘거나 알 수 없으면 실패
+     * 2. 원본 크기만큼 버퍼를 할당하고 해제 (사전 ID가 다르면 zstd가 실패를 반환)
+     * 3. 해제한 크기가 원본 크기와 다르면 실패
+     */
+    Int64 PacketCompressor::Decompress(Vector<Byte>& message)
+    {
+        const Int64 startUs = core::GetSteadyNowUs();
+
+        const Byte* compressed = message.data() + kPacketHeaderSize;
+        const Int64 compressedSize = static_cast_64(message.size()) - kPacketHeaderSize;
+
+        const UInt64 contentSize = ::ZSTD_getFrameContentSize(compressed, compressedSize);
+        if ((contentSize == ZSTD_CONTENTSIZE_UNKNOWN) || (contentSize == ZSTD_CONTENTSIZE_ERROR) ||
+            (contentSize > static_cast<UInt64>(kMaxMessageSize - kPacketHeaderSize)))
+        {
+            return FAILURE;
+        }
+
+        Vector<Byte> decompressed(kPacketHeaderSize + contentSize);
+        ZSTD_DCtx* context = tZstdContext.GetDecompress();
+        const size_t result = (mDecompressDictionary != nullptr)
+                                  ? ::ZSTD_decompress_usingDDict(context, decompressed.data() + kPacketHeaderSize, contentSize,
+                                                                 compressed, compressedSize, mDecompressDictionary)
+                                  : ::ZSTD_decompressDCtx(context, decompressed.data() + kPacketHeaderSize, contentSize,
+                                                          compressed, compressedSize);
+        if (::ZSTD_isError(result) || (result != contentSize))
+        {
+            return FAILURE;
+        }
+
+        PacketHeader* header = reinterpret_cast<PacketHeader*>(decompressed.data());
+        *header = *reinterpret_cast<const PacketHeader*>(message.data());
+        header->size = static_cast_32(decompressed.size());
+        header->flags = 0;
+
+        mDecompressInputBytes.Add(compressedSize);
+        mDecompressOutputBytes.Add(static_cast_64(contentSize));
+        mDecompressTimeUs.Add(core::GetSteadyNowUs() - startUs);
+
+        message = std::move(decompressed);
+        return SUCCESS;
+    }
+
+    void DictionaryTrainer::AddSample(const Byte* payload, Int64 payloadSize)
+    {
+        if ((payloadSize <= 0) ||
+            (GetSampleCount() >= kMaxSampleCount) ||
+            (static_cast_64(mSamples.size()) + payloadSize > kMaxSampleBytes))
+        {
+            return;
+        }
+
+        mSamples.insert(mSamples.end(), payload, payload + payloadSize);
+        mSampleSizes.push_back(static_cast<size_t>(payloadSize));
+    }
+
+    /**
+     * 모은 표본으로 사전을 학습해 파일로 씁니다.
+     *
+     * @param path 사전 파일 경로
+     * @return 성공 여부 (표본이 너무 적으면 zstd가 실패를 반환)
+     */
+    Bool DictionaryTrainer::Train(const String8& path)
+    {
+        Vector<Byte> dictionary(kDictionarySize);
+        const size_t result = ::ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(), mSamples.data(),
+                                                      mSampleSizes.data(), static_cast<unsigned>(mSampleSizes.size()));
+        if (::ZDICT_isError(result))
+        {
+            core::gLogger->Error(TEXT_8("DictionaryTrainer: Training failed with {} samples: {}"),
+                                 mSampleSizes.size(), ::ZDICT_getErrorName(result));
+            return false;
+        }
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            core::gLogger->Error(TEXT_8("DictionaryTrainer: Failed to open {}"), path);
+            return false;
+        }
+
+        file.write(reinterpret_cast<const char*>(dictionary.data()), result);
+
+        core::gLogger->Info(TEXT_8("DictionaryTrainer: Wrote {} ({} bytes) from {} samples, {} bytes"),
+                            path, result, mSampleSizes.size(), mSamples.size());
+        return true;
+    }
+} // namespace proto
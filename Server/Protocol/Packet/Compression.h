@@ -0,0 +1,143 @@
+﻿/*    Protocol/Packet/Compression.h    */
+
+#pragma once
+
+#include "Protocol/Packet/Type.h"
+
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+namespace core
+{
+    class Counter;
+    class SendBuffer;
+}
+
+namespace proto
+{
+    // C2S_Hello/S2C_Hello의 compression 값
+    enum class CompressionType : Int64
+    {
+        None = 0,
+        Zstd = 1,
+    };
+
+    /*
+     * PacketCompressor - 공유 사전을 사용하는 zstd 메시지 압축
+     *
+     * 압축을 협상한 세션에는 임계값(SetThreshold) 이상인 페이로드를 압축해서 보냅니다.
+     * 압축된 메시지는 모든 프레임에 kFlagCompressed가 설정되고, 재조립한 뒤 한 번에 해제합니다.
+     *
+     * 주요 기능:
+     * - 패킷 표본으로 학습한 사전을 한 번 로드해 모든 세션이 공유 (작은 메시지도 압축 효과가 있음)
+     * - 세션별 스트림 상태 없이 메시지 단위로 압축하므로 같은 브로드캐스트는 한 번만 압축해 모든 세션이 공유
+     * - 임계값보다 작거나 압축해도 작아지지 않는 페이로드는 그대로 전송
+     * - 해제 전에 원본 크기를 확인해 kMaxMessageSize를 넘는 압축 폭탄을 거부
+     * - 압축/해제 입출력 바이트와 소요 시간을 net_compress_*, net_decompress_* 메트릭으로 기록
+     *
+     * 스레드 규칙:
+     * - 설정(SetEnabled, SetThreshold, LoadDictionary)은 서비스 시작 전 메인 스레드에서 호출
+     * - 압축/해제는 모든 스레드에서 호출 가능 (스레드별 zstd 컨텍스트 사용)
+     */
+    class PacketCompressor
+    {
+    public:
+        static PacketCompressor& GetInstance()
+        {
+            static PacketCompressor sInstance;
+            return sInstance;
+        }
+
+        // 복사 금지
+        PacketCompressor(const PacketCompressor&) = delete;
+        PacketCompressor& operator=(const PacketCompressor&) = delete;
+
+        Bool            LoadDictionary(const String8& path);
+        void            SetEnabled(Bool enabled) { mIsEnabled = enabled; }
+        Bool            IsEnabled() const { return mIsEnabled; }
+        void            SetThreshold(Int64 threshold) { mThreshold = std::max<Int64>(threshold, 0); }
+        Int64           GetThreshold() const { return mThreshold; }
+        Int64           GetDictionaryId() const { return mDictionaryId; }
+
+        /**
+         * 상대가 요청한 압축 방식을 사용할 수 있는지 확인합니다.
+         *
+         * @param type 상대가 요청한 압축 방식
+         * @param dictionaryId 상대가 로드한 사전 ID (사전이 없으면 0)
+         * @return 압축이 활성화되어 있고 같은 사전을 사용하면 true
+         */
+        Bool            IsCompatible(CompressionType type, Int64 dictionaryId) const;
+
+        /**
+         * 페이로드를 압축해 프레임 목록을 만듭니다.
+         *
+         * @param id 패킷 ID
+         * @param payload 직렬화된 페이로드
+         * @param payloadSize 페이로드 크기
+         * @return kFlagCompressed가 설정된 프레임 목록, 임계값 미만이거나 압축 효과가 없으면 빈 목록
+         */
+        Vector<SharedPtr<core::SendBuffer>>     Compress(PacketId id, const Byte* payload, Int64 payloadSize);
+
+        // 압축하지 않은 단일 프레임 송신 버퍼를 압축 (브로드캐스트용)
+        Vector<SharedPtr<core::SendBuffer>>     Compress(const SharedPtr<core::SendBuffer>& frame);
+
+        /**
+         * 재조립한 압축 메시지를 해제합니다.
+         *
+         * @param message 헤더 하나와 압축된 페이로드로 이루어진 메시지, 성공하면 해제된 메시지로 교체
+         * @return 성공하면 SUCCESS, 손상되었거나 원본 크기가 제한을 넘으면 FAILURE
+         */
+        Int64           Decompress(Vector<Byte>& message);
+
+        // 누적 압축률과 압축/해제에 쓴 CPU 시간 출력
+        void            LogStats() const;
+
+    private:
+        PacketCompressor();
+        ~PacketCompressor();
+
+    private:
+        static constexpr Int32      kCompressionLevel = 1;
+        static constexpr Int64      kDefaultThreshold = 64;
+
+    private:
+        Bool                mIsEnabled = false;
+        Int64               mThreshold = kDefaultThreshold;
+        Int64               mDictionaryId = 0;
+        ZSTD_CDict_s*       mCompressDictionary = nullptr;
+        ZSTD_DDict_s*       mDecompressDictionary = nullptr;
+
+        core::Counter&      mCompressInputBytes;
+        core::Counter&      mCompressOutputBytes;
+        core::Counter&      mCompressTimeUs;
+        core::Counter&      mDecompressInputBytes;
+        core::Counter&      mDecompressOutputBytes;
+        core::Counter&      mDecompressTimeUs;
+    };
+
+    /*
+     * DictionaryTrainer - 수신한 페이로드로 압축 사전 학습
+     *
+     * 표본 수와 전체 크기에 상한을 두고 표본을 모은 뒤 Train()으로 사전 파일을 씁니다.
+     * 수신한 패킷은 재조립 단계에서 이미 해제되어 있으므로 압축 사용 여부와 관계없이 수집할 수 있습니다.
+     *
+     * 스레드 규칙:
+     * - AddSample은 패킷을 처리하는 루프 스레드에서만 호출
+     */
+    class DictionaryTrainer
+    {
+    public:
+        void            AddSample(const Byte* payload, Int64 payloadSize);
+        Bool            Train(const String8& path);
+        Int64           GetSampleCount() const { return static_cast_64(mSampleSizes.size()); }
+
+    private:
+        static constexpr Int64      kDictionarySize = 16 * 1024;
+        static constexpr Int64      kMaxSampleCount = 100'000;
+        static constexpr Int64      kMaxSampleBytes = 16 * 1024 * 1024;
+
+    private:
+        Vector<Byte>        mSamples;
+        Vector<size_t>      mSampleSizes;
+    };
+} // namespace proto
@@ -8,6 +8,11 @@ using namespace core;
 
 namespace proto
 {
+    namespace
+    {
+        thread_local const RawPacket* tCurrentPacket = nullptr;
+    } // namespace
+
     PacketDispatcher::PacketDispatcher()
     {
         // Invalid 핸들러로 초기화
@@ -17,6 +22,20 @@ namespace proto
         }
     }
 
+    Bool PacketDispatcher::DispatchPacket(const SharedPtr<RawPacket>& packet)
+    {
+        tCurrentPacket = packet.get();
+        const Bool result = mIdToHandler[packet->GetId()](packet);
+        tCurrentPacket = nullptr;
+
+        return result;
+    }
+
+    const RawPacket* PacketDispatcher::GetCurrentPacket()
+    {
+        return tCurrentPacket;
+    }
+
     Bool PacketDispatcher::Handle_Invalid(const SharedPtr<RawPacket>& packet)
     {
         gLogger->Error(TEXT_8("Session[{}]: Invalid packet id: {}"), packet->GetOwner()->GetId(), packet->GetId());
@@ -22,7 +22,13 @@ namespace proto
          * @param packet 핸들러로 전달할 패킷
          * @return 패킷이 성공적으로 처리되었는지 여부
          */
-        Bool                DispatchPacket(const SharedPtr<RawPacket>& packet) { return mIdToHandler[packet->GetId()](packet); }
+        Bool                DispatchPacket(const SharedPtr<RawPacket>& packet);
+
+        /**
+         * 현재 스레드에서 처리 중인 패킷을 반환합니다.
+         * 핸들러에서 패킷의 수신/꺼낸 시각을 조회할 때 사용하며, 핸들러 밖에서는 nullptr입니다.
+         */
+        static const RawPacket* GetCurrentPacket();
 
     protected:
                             PacketDispatcher();
@@ -44,7 +50,7 @@ namespace proto
         static Bool         HandlePayload(TPayloadHandler handler, const SharedPtr<RawPacket>& packet)
         {
             TPayload payload;
-            if (!payload.ParseFromArray(packet->GetPayload(), packet->GetSize() - sizeof_16(PacketHeader)))
+            if (!payload.ParseFromArray(packet->GetPayload(), packet->GetPayloadSize()))
             {
                 return false;
             }
@@ -12,7 +12,11 @@ namespace proto
         Invalid = 0,
         C2S_EnterRoom = 1000,
         C2S_Chat = 1001,
-        S2C_EnterRoom = 1002,
-        S2C_Chat = 1003,
+        C2S_Ping = 1002,
+        C2S_Hello = 1003,
+        S2C_EnterRoom = 1004,
+        S2C_Chat = 1005,
+        S2C_Pong = 1006,
+        S2C_Hello = 1007,
     };
 } // namespace proto
\ No newline at end of file
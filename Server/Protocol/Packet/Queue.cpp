@@ -3,6 +3,8 @@
 #include "Protocol/Pch.h"
 #include "Protocol/Packet/Queue.h"
 #include "Protocol/Packet/Type.h"
+#include "Protocol/Packet/Assembler.h"
+#include "Core/Metric/Metric.h"
 
 namespace proto
 {
@@ -16,39 +18,65 @@ namespace proto
         }
     }
 
-    Int64 PacketQueue::Push(const SharedPtr<core::Session>& owner, const Byte* buffer, Int64 numBytes)
+    Int64 PacketQueue::Push(const SharedPtr<core::Session>& owner, PacketAssembler& assembler, const Byte* buffer, Int64 numBytes)
     {
-        Int64 packetOffset = 0;
+        static core::Counter& sReceivedPackets = core::gMetricRegistry->AddCounter(TEXT_8("net_session_received_packets_total"),
+                                                                                  TEXT_8("Packets received by sessions"));
 
-        // 모든 패킷을 큐에 넣는다
-        while (packetOffset < numBytes)
+        // 같은 수신 완료로 들어온 패킷은 수신 시각이 같음
+        const Int64 receiveUs = core::GetSteadyNowUs();
+
+        Int64 frameOffset = 0;
+        Int64 packetCount = 0;
+        Int64 result = SUCCESS;
+
+        // 전체가 수신된 모든 프레임을 처리한다
+        while (frameOffset < numBytes)
         {
-            const Int64 remainingBytes = numBytes - packetOffset;
+            const Int64 remainingBytes = numBytes - frameOffset;
 
-            // 패킷 헤더 크기만큼 있는지 확인
-            if (remainingBytes < sizeof_64(PacketHeader))
+            // 프레임 헤더 크기만큼 있는지 확인
+            if (remainingBytes < kPacketHeaderSize)
             {
                 break;
             }
 
-            const PacketHeader* header = reinterpret_cast<const PacketHeader*>(buffer + packetOffset);
-            ASSERT_CRASH_DEBUG(header->size > 0, "INVALID_PACKET_SIZE");
+            // 프레임 전체를 받기 전에 길이를 검증해서 잘못된 길이만큼 기다리지 않음
+            const PacketHeader* header = reinterpret_cast<const PacketHeader*>(buffer + frameOffset);
+            if (!PacketAssembler::IsValidFrame(*header))
+            {
+                result = FAILURE;
+                break;
+            }
 
-            // 패킷의 일부만 수신한 경우
+            // 프레임의 일부만 수신한 경우
             if (header->size > remainingBytes)
             {
                 break;
             }
 
-            // 패킷을 큐에 추가
-            SharedPtr<RawPacket> packet = std::make_shared<RawPacket>(owner, buffer + packetOffset);
-            Push(packet);
+            // 메시지가 완성되면 패킷을 큐에 추가
+            SharedPtr<RawPacket> packet;
+            if (assembler.Assemble(owner, buffer + frameOffset, OUT packet) != SUCCESS)
+            {
+                result = FAILURE;
+                break;
+            }
+
+            if (packet)
+            {
+                packet->SetReceiveUs(receiveUs);
+                Push(packet);
+                ++packetCount;
+            }
 
-            // 다음 패킷 오프셋으로 이동
-            packetOffset += header->size;
+            // 다음 프레임 오프셋으로 이동
+            frameOffset += header->size;
         }
 
-        return packetOffset;
+        sReceivedPackets.Add(packetCount);
+
+        return (result == SUCCESS) ? frameOffset : FAILURE;
     }
 
     Bool PacketQueue::TryPop(SharedPtr<RawPacket>& packet)
@@ -10,6 +10,7 @@ namespace core
 namespace proto
 {
     class RawPacket;
+    class PacketAssembler;
 
     class PacketQueue
     {
@@ -22,14 +23,16 @@ namespace proto
         void Push(const SharedPtr<RawPacket>& packet);
 
         /**
-         * 버퍼의 패킷들을 큐에 추가합니다.
+         * 버퍼의 프레임들을 재조립해 완성된 패킷을 큐에 추가합니다.
+         * 입출력 워커의 수신 완료 처리에서 호출되므로 호출 시각을 패킷의 수신 시각으로 기록합니다.
          *
          * @param owner 패킷 소유자 세션
-         * @param buffer 패킷 데이터 버퍼
+         * @param assembler 소유자 세션의 재조립 상태
+         * @param buffer 프레임 데이터 버퍼
          * @param numBytes 버퍼에 있는 데이터 크기 (바이트 단위)
-         * @return 버퍼의 패킷 중 큐로 추가된 패킷 크기의 합 (바이트 단위)
+         * @return 버퍼에서 처리한 프레임 크기의 합 (바이트 단위), 잘못된 프레임이 있으면 FAILURE
          */
-        Int64 Push(const SharedPtr<core::Session>& owner, const Byte* buffer, Int64 numBytes);
+        Int64 Push(const SharedPtr<core::Session>& owner, PacketAssembler& assembler, const Byte* buffer, Int64 numBytes);
 
         /**
          * 큐에서 패킷을 가져옵니다.
@@ -39,6 +42,11 @@ namespace proto
          */
         Bool TryPop(SharedPtr<RawPacket>& packet);
 
+        /**
+         * 큐에 남은 패킷 수의 근삿값을 반환합니다. (메트릭 샘플링용)
+         */
+        Int64 GetSize() const { return static_cast_64(mQueue.size_approx()); }
+
     private:
         LockfreeQueue<SharedPtr<RawPacket>> mQueue; // 패킷 큐
     };
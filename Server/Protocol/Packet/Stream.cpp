@@ -0,0 +1,96 @@
+﻿/*    Protocol/Packet/Stream.cpp    */
+
+#include "Protocol/Pch.h"
+#include "Protocol/Packet/Stream.h"
+#include "Core/Network/Buffer.h"
+
+namespace proto
+{
+    FrameOutputStream::FrameOutputStream(PacketId id, Int64 payloadSize, UInt16 flags)
+        : mId(id)
+        , mFlags(flags)
+        , mRemainingSize(payloadSize)
+    {
+        ASSERT_CRASH((payloadSize > 0) && (payloadSize + kPacketHeaderSize <= kMaxMessageSize), "INVALID_MESSAGE_SIZE");
+
+        mFrames.reserve((payloadSize + kMaxFramePayloadSize - 1) / kMaxFramePayloadSize);
+    }
+
+    FrameOutputStream::~FrameOutputStream()
+    {
+        // Finish()를 호출하지 않았어도 청크가 쓰기 상태로 남지 않도록 함
+        CloseFrame();
+    }
+
+    /**
+     * 다음 프레임의 페이로드 영역을 반환합니다.
+     *
+     * 동작:
+     * 1. 쓰고 있던 프레임의 쓰기 완료 (스레드별 청크는 한 번에 하나의 버퍼만 쓸 수 있음)
+     * 2. 남은 페이로드가 없으면 실패
+     * 3. 최대 kMaxFramePayloadSize만큼 프레임을 할당하고 헤더 작성
+     */
+    bool FrameOutputStream::Next(void** data, int* size)
+    {
+        CloseFrame();
+
+        if (mRemainingSize == 0)
+        {
+            return false;
+        }
+
+        const Int32 payloadSize = static_cast_32(std::min<Int64>(mRemainingSize, kMaxFramePayloadSize));
+        mRemainingSize -= payloadSize;
+
+        SharedPtr<core::SendBuffer> frame = core::gSendChunkPool->Alloc(kPacketHeaderSize + payloadSize);
+
+        PacketHeader* header = reinterpret_cast<PacketHeader*>(frame->GetBuffer());
+        header->size = kPacketHeaderSize + payloadSize;
+        header->id = mId;
+        header->flags = mFlags | ((mRemainingSize > 0) ? PacketHeader::kFlagMoreFragments : 0);
+
+        mFrames.push_back(std::move(frame));
+        mFramePayloadSize = payloadSize;
+        mByteCount += payloadSize;
+
+        *data = header + 1;
+        *size = payloadSize;
+
+        return true;
+    }
+
+    void FrameOutputStream::BackUp(int count)
+    {
+        ASSERT_CRASH((count >= 0) && (count <= mFramePayloadSize), "INVALID_BACKUP_SIZE");
+
+        mFramePayloadSize -= count;
+        mByteCount -= count;
+    }
+
+    Bool FrameOutputStream::Finish(OUT Vector<SharedPtr<core::SendBuffer>>& frames)
+    {
+        CloseFrame();
+
+        const Bool isComplete = mIsExact && (mRemainingSize == 0) && (mFrames.empty() == false);
+        frames = std::move(mFrames);
+        mFrames.clear();
+
+        return isComplete;
+    }
+
+    void FrameOutputStream::CloseFrame()
+    {
+        if (mFrames.empty() || (mFrames.back()->GetWrittenSize() > 0))
+        {
+            return;
+        }
+
+        // 쓰지 않은 영역을 되돌렸으면 프레임 크기가 헤더와 맞지 않음
+        if (kPacketHeaderSize + mFramePayloadSize != mFrames.back()->GetAllocSize())
+        {
+            mIsExact = false;
+        }
+
+        mFrames.back()->OnWritten(kPacketHeaderSize + mFramePayloadSize);
+    }
+} // namespace proto
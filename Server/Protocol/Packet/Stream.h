@@ -0,0 +1,63 @@
+﻿/*    Protocol/Packet/Stream.h    */
+
+#pragma once
+
+#include "Protocol/Packet/Type.h"
+#include <google/protobuf/io/zero_copy_stream.h>
+
+namespace core
+{
+    class SendBuffer;
+}
+
+namespace proto
+{
+    /*
+     * FrameOutputStream - 송신 청크의 프레임에 바로 직렬화하는 출력 스트림
+     *
+     * 주요 기능:
+     * - Next()마다 SendChunkPool에서 프레임 하나를 할당하고 헤더를 쓴 뒤 페이로드 영역을 넘겨줌
+     * - 페이로드 크기를 미리 알고 있으므로 마지막 프레임을 제외한 프레임에 kFlagMoreFragments 설정
+     * - 생성할 때 지정한 플래그(kFlagCompressed 등)는 모든 프레임에 설정
+     * - 중간 버퍼 없이 직렬화 결과가 그대로 송신 버퍼가 됨
+     *
+     * 사용 패턴:
+     * - CodedOutputStream으로 직렬화하고, CodedOutputStream을 해제한 뒤 Finish()로 프레임 목록을 가져옴
+     * - 스레드별 송신 청크를 사용하므로 생성한 스레드에서만 사용
+     */
+    class FrameOutputStream
+        : public google::protobuf::io::ZeroCopyOutputStream
+    {
+    public:
+        FrameOutputStream(PacketId id, Int64 payloadSize, UInt16 flags = 0);
+        virtual ~FrameOutputStream() override;
+
+        // 복사 금지
+        FrameOutputStream(const FrameOutputStream&) = delete;
+        FrameOutputStream& operator=(const FrameOutputStream&) = delete;
+
+        virtual bool        Next(void** data, int* size) override;
+        virtual void        BackUp(int count) override;
+        virtual int64_t     ByteCount() const override { return mByteCount; }
+
+        /**
+         * 마지막 프레임의 쓰기를 완료하고 프레임 목록을 반환합니다.
+         *
+         * @param frames 순서대로 송신할 프레임 목록
+         * @return 계획한 페이로드 크기만큼 정확히 썼으면 true
+         */
+        Bool                Finish(OUT Vector<SharedPtr<core::SendBuffer>>& frames);
+
+    private:
+        void                CloseFrame();
+
+    private:
+        PacketId                            mId;
+        UInt16                              mFlags; // 모든 프레임에 설정할 플래그
+        Int64                               mRemainingSize; // 아직 프레임을 할당하지 않은 페이로드 크기
+        Int64                               mByteCount = 0;
+        Vector<SharedPtr<core::SendBuffer>> mFrames;
+        Int32                               mFramePayloadSize = 0; // 쓰고 있는 프레임에 쓴 페이로드 크기
+        Bool                                mIsExact = true; // 모든 프레임을 할당한 크기만큼 썼는지 여부
+    };
+} // namespace proto
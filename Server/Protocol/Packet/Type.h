@@ -11,15 +11,38 @@ namespace core
 
 namespace proto
 {
+    /*
+     * PacketHeader - 프레임 헤더
+     *
+     * 하나의 메시지는 같은 id를 가진 하나 이상의 프레임으로 전송됩니다.
+     * kMaxFramePayloadSize보다 큰 메시지는 여러 프레임으로 나누고, 마지막 프레임을 제외한 모든 프레임에
+     * kFlagMoreFragments를 설정합니다. 수신 측은 PacketAssembler로 프레임을 검증하고 메시지로 재조립합니다.
+     * 압축된 메시지는 모든 프레임에 kFlagCompressed를 설정하고, 재조립을 마친 뒤 PacketCompressor로 해제합니다.
+     *
+     * 크기 제한:
+     * - 프레임 크기는 kMaxFrameSize 이하 (수신 버퍼와 송신 청크에 항상 들어가는 크기)
+     * - 재조립한 메시지 크기는 kMaxMessageSize 이하 (악의적인 길이로 메모리를 소모시키는 것을 방지)
+     * - 압축된 메시지는 해제한 크기도 kMaxMessageSize 이하
+     */
 #pragma pack(push, 1)
     struct PacketHeader
     {
-        Int16       size = 0; // 헤더까지 포함한 패킷의 전체 크기
+        Int32       size = 0; // 헤더까지 포함한 프레임의 전체 크기
         PacketId    id = PacketId::Invalid;
+        UInt16      flags = 0;
+
+        static constexpr UInt16     kFlagMoreFragments = 0x0001; // 뒤에 같은 메시지의 프레임이 이어짐
+        static constexpr UInt16     kFlagCompressed = 0x0002; // 메시지 페이로드가 zstd로 압축됨
+        static constexpr UInt16     kValidFlags = kFlagMoreFragments | kFlagCompressed;
     };
 #pragma pack(pop)
 
-    // 패킷을 직렬화된 바이너리 형태의 데이터로 소유
+    constexpr Int32     kPacketHeaderSize = sizeof_32(PacketHeader);
+    constexpr Int32     kMaxFrameSize = 0x4000; // 16KB
+    constexpr Int32     kMaxFramePayloadSize = kMaxFrameSize - kPacketHeaderSize;
+    constexpr Int32     kMaxMessageSize = 0x0040'0000; // 4MB, 헤더 하나를 포함한 재조립 후 크기
+
+    // 패킷을 직렬화된 바이너리 형태의 데이터로 소유 (조각난 메시지는 재조립된 하나의 패킷)
     class RawPacket
     {
     public:
@@ -28,16 +51,31 @@ namespace proto
             , mData(packet, packet + reinterpret_cast<const PacketHeader*>(packet)->size)
         {}
 
+        // 헤더의 size가 data 전체 크기로 설정된 패킷 데이터를 넘겨받음
+        explicit RawPacket(const SharedPtr<core::Session>& owner, Vector<Byte>&& data)
+            : mOwner(owner)
+            , mData(std::move(data))
+        {}
+
         const SharedPtr<core::Session>& GetOwner() const { return mOwner; }
 
         const PacketHeader* GetHeader() const { return reinterpret_cast<const PacketHeader*>(mData.data()); }
-        const Byte* GetPayload() const { return mData.data() + sizeof_16(PacketHeader); }
+        const Byte* GetPayload() const { return mData.data() + kPacketHeaderSize; }
 
-        Int16 GetSize() const { return GetHeader()->size; }
+        Int32 GetSize() const { return GetHeader()->size; }
+        Int32 GetPayloadSize() const { return GetSize() - kPacketHeaderSize; }
         Int16 GetId() const { return static_cast_16(GetHeader()->id); }
 
+        // 지연 측정용 스탬프 (마이크로초, 기록되지 않았으면 0)
+        Int64 GetReceiveUs() const { return mReceiveUs; }
+        void SetReceiveUs(Int64 us) { mReceiveUs = us; }
+        Int64 GetPopUs() const { return mPopUs; }
+        void SetPopUs(Int64 us) { mPopUs = us; }
+
     private:
         SharedPtr<core::Session> mOwner; // 패킷 소유자 세션
         Vector<Byte> mData; // 패킷 데이터
+        Int64 mReceiveUs = 0; // 수신 완료 시각
+        Int64 mPopUs = 0; // 패킷 큐에서 꺼낸 시각
     };
 } // namespace proto
@@ -32,6 +32,7 @@ inline constexpr C2S_EnterRoom::Impl_::Impl_(
             &::google::protobuf::internal::fixed_address_empty_string,
             ::_pbi::ConstantInitialized()),
         id_{::int64_t{0}},
+        room_id_{::int64_t{0}},
         _cached_size_{0} {}
 
 template <typename>
@@ -81,6 +82,58 @@ struct C2S_ChatDefaultTypeInternal {
 
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 C2S_ChatDefaultTypeInternal _C2S_Chat_default_instance_;
+
+inline constexpr C2S_Ping::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : sequence_{::int64_t{0}},
+        client_send_us_{::int64_t{0}},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR C2S_Ping::C2S_Ping(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct C2S_PingDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR C2S_PingDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~C2S_PingDefaultTypeInternal() {}
+  union {
+    C2S_Ping _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 C2S_PingDefaultTypeInternal _C2S_Ping_default_instance_;
+
+inline constexpr C2S_Hello::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : compression_{::int64_t{0}},
+        dictionary_id_{::int64_t{0}},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR C2S_Hello::C2S_Hello(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct C2S_HelloDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR C2S_HelloDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~C2S_HelloDefaultTypeInternal() {}
+  union {
+    C2S_Hello _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 C2S_HelloDefaultTypeInternal _C2S_Hello_default_instance_;
 }  // namespace proto
 static constexpr const ::_pb::EnumDescriptor**
     file_level_enum_descriptors_C2S_2eproto = nullptr;
@@ -99,6 +152,7 @@ const ::uint32_t
         ~0u,  // no sizeof(Split)
         PROTOBUF_FIELD_OFFSET(::proto::C2S_EnterRoom, _impl_.id_),
         PROTOBUF_FIELD_OFFSET(::proto::C2S_EnterRoom, _impl_.password_),
+        PROTOBUF_FIELD_OFFSET(::proto::C2S_EnterRoom, _impl_.room_id_),
         ~0u,  // no _has_bits_
         PROTOBUF_FIELD_OFFSET(::proto::C2S_Chat, _internal_metadata_),
         ~0u,  // no _extensions_
@@ -109,23 +163,50 @@ const ::uint32_t
         ~0u,  // no sizeof(Split)
         PROTOBUF_FIELD_OFFSET(::proto::C2S_Chat, _impl_.id_),
         PROTOBUF_FIELD_OFFSET(::proto::C2S_Chat, _impl_.message_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::proto::C2S_Ping, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::proto::C2S_Ping, _impl_.sequence_),
+        PROTOBUF_FIELD_OFFSET(::proto::C2S_Ping, _impl_.client_send_us_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::proto::C2S_Hello, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::proto::C2S_Hello, _impl_.compression_),
+        PROTOBUF_FIELD_OFFSET(::proto::C2S_Hello, _impl_.dictionary_id_),
 };
 
 static const ::_pbi::MigrationSchema
     schemas[] ABSL_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
         {0, -1, -1, sizeof(::proto::C2S_EnterRoom)},
-        {10, -1, -1, sizeof(::proto::C2S_Chat)},
+        {11, -1, -1, sizeof(::proto::C2S_Chat)},
+        {21, -1, -1, sizeof(::proto::C2S_Ping)},
+        {31, -1, -1, sizeof(::proto::C2S_Hello)},
 };
 static const ::_pb::Message* const file_default_instances[] = {
     &::proto::_C2S_EnterRoom_default_instance_._instance,
     &::proto::_C2S_Chat_default_instance_._instance,
+    &::proto::_C2S_Ping_default_instance_._instance,
+    &::proto::_C2S_Hello_default_instance_._instance,
 };
 const char descriptor_table_protodef_C2S_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
     protodesc_cold) = {
-    "\n\tC2S.proto\022\005proto\032\014Common.proto\"-\n\rC2S_"
-    "EnterRoom\022\n\n\002id\030\001 \001(\003\022\020\n\010password\030\002 \001(\t\""
-    "\'\n\010C2S_Chat\022\n\n\002id\030\001 \001(\003\022\017\n\007message\030\002 \001(\t"
-    "b\006proto3"
+    "\n\tC2S.proto\022\005proto\032\014Common.proto\">\n\rC2S_"
+    "EnterRoom\022\n\n\002id\030\001 \001(\003\022\020\n\010password\030\002 \001(\t\022"
+    "\017\n\007room_id\030\003 \001(\003\"\'\n\010C2S_Chat\022\n\n\002id\030\001 \001(\003"
+    "\022\017\n\007message\030\002 \001(\t\"4\n\010C2S_Ping\022\020\n\010sequenc"
+    "e\030\001 \001(\003\022\026\n\016client_send_us\030\002 \001(\003\"7\n\tC2S_H"
+    "ello\022\023\n\013compression\030\001 \001(\003\022\025\n\rdictionary_"
+    "id\030\002 \001(\003b\006proto3"
 };
 static const ::_pbi::DescriptorTable* const descriptor_table_C2S_2eproto_deps[1] =
     {
@@ -135,13 +216,13 @@ static ::absl::once_flag descriptor_table_C2S_2eproto_once;
 PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_C2S_2eproto = {
     false,
     false,
-    128,
+    256,
     descriptor_table_protodef_C2S_2eproto,
     "C2S.proto",
     &descriptor_table_C2S_2eproto_once,
     descriptor_table_C2S_2eproto_deps,
     1,
-    2,
+    4,
     schemas,
     file_default_instances,
     TableStruct_C2S_2eproto::offsets,
@@ -183,7 +264,13 @@ C2S_EnterRoom::C2S_EnterRoom(
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.id_ = from._impl_.id_;
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, id_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, id_),
+           offsetof(Impl_, room_id_) -
+               offsetof(Impl_, id_) +
+               sizeof(Impl_::room_id_));
 
   // @@protoc_insertion_point(copy_constructor:proto.C2S_EnterRoom)
 }
@@ -195,7 +282,12 @@ inline PROTOBUF_NDEBUG_INLINE C2S_EnterRoom::Impl_::Impl_(
 
 inline void C2S_EnterRoom::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.id_ = {};
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, id_),
+           0,
+           offsetof(Impl_, room_id_) -
+               offsetof(Impl_, id_) +
+               sizeof(Impl_::room_id_));
 }
 C2S_EnterRoom::~C2S_EnterRoom() {
   // @@protoc_insertion_point(destructor:proto.C2S_EnterRoom)
@@ -245,15 +337,15 @@ const ::google::protobuf::internal::ClassData* C2S_EnterRoom::GetClassData() con
   return _class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 36, 2> C2S_EnterRoom::_table_ = {
+const ::_pbi::TcParseTable<2, 3, 0, 36, 2> C2S_EnterRoom::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
+    3, 24,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
+    4294967288,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
+    3,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
     _class_data_.base(),
@@ -263,12 +355,16 @@ const ::_pbi::TcParseTable<1, 2, 0, 36, 2> C2S_EnterRoom::_table_ = {
     ::_pbi::TcParser::GetTable<::proto::C2S_EnterRoom>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    // string password = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(C2S_EnterRoom, _impl_.password_)}},
+    {::_pbi::TcParser::MiniParse, {}},
     // int64 id = 1;
     {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(C2S_EnterRoom, _impl_.id_), 63>(),
      {8, 63, 0, PROTOBUF_FIELD_OFFSET(C2S_EnterRoom, _impl_.id_)}},
+    // string password = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(C2S_EnterRoom, _impl_.password_)}},
+    // int64 room_id = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(C2S_EnterRoom, _impl_.room_id_), 63>(),
+     {24, 63, 0, PROTOBUF_FIELD_OFFSET(C2S_EnterRoom, _impl_.room_id_)}},
   }}, {{
     65535, 65535
   }}, {{
@@ -278,6 +374,9 @@ const ::_pbi::TcParseTable<1, 2, 0, 36, 2> C2S_EnterRoom::_table_ = {
     // string password = 2;
     {PROTOBUF_FIELD_OFFSET(C2S_EnterRoom, _impl_.password_), 0, 0,
     (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // int64 room_id = 3;
+    {PROTOBUF_FIELD_OFFSET(C2S_EnterRoom, _impl_.room_id_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
   }},
   // no aux_entries
   {{
@@ -295,7 +394,9 @@ PROTOBUF_NOINLINE void C2S_EnterRoom::Clear() {
   (void) cached_has_bits;
 
   _impl_.password_.ClearToEmpty();
-  _impl_.id_ = ::int64_t{0};
+  ::memset(&_impl_.id_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.room_id_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.room_id_));
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
@@ -329,6 +430,13 @@ PROTOBUF_NOINLINE void C2S_EnterRoom::Clear() {
             target = stream->WriteStringMaybeAliased(2, _s, target);
           }
 
+          // int64 room_id = 3;
+          if (this_._internal_room_id() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<3>(
+                    stream, this_._internal_room_id(), target);
+          }
+
           if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
             target =
                 ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -364,6 +472,11 @@ PROTOBUF_NOINLINE void C2S_EnterRoom::Clear() {
               total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
                   this_._internal_id());
             }
+            // int64 room_id = 3;
+            if (this_._internal_room_id() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_room_id());
+            }
           }
           return this_.MaybeComputeUnknownFieldsSize(total_size,
                                                      &this_._impl_._cached_size_);
@@ -383,6 +496,9 @@ void C2S_EnterRoom::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::g
   if (from._internal_id() != 0) {
     _this->_impl_.id_ = from._impl_.id_;
   }
+  if (from._internal_room_id() != 0) {
+    _this->_impl_.room_id_ = from._impl_.room_id_;
+  }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -400,7 +516,12 @@ void C2S_EnterRoom::InternalSwap(C2S_EnterRoom* PROTOBUF_RESTRICT other) {
   ABSL_DCHECK_EQ(arena, other->GetArena());
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.password_, &other->_impl_.password_, arena);
-        swap(_impl_.id_, other->_impl_.id_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(C2S_EnterRoom, _impl_.room_id_)
+      + sizeof(C2S_EnterRoom::_impl_.room_id_)
+      - PROTOBUF_FIELD_OFFSET(C2S_EnterRoom, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
 }
 
 ::google::protobuf::Metadata C2S_EnterRoom::GetMetadata() const {
@@ -663,6 +784,488 @@ void C2S_Chat::InternalSwap(C2S_Chat* PROTOBUF_RESTRICT other) {
 ::google::protobuf::Metadata C2S_Chat::GetMetadata() const {
   return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
 }
+// ===================================================================
+
+class C2S_Ping::_Internal {
+ public:
+};
+
+C2S_Ping::C2S_Ping(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto.C2S_Ping)
+}
+C2S_Ping::C2S_Ping(
+    ::google::protobuf::Arena* arena, const C2S_Ping& from)
+    : C2S_Ping(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE C2S_Ping::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void C2S_Ping::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, sequence_),
+           0,
+           offsetof(Impl_, client_send_us_) -
+               offsetof(Impl_, sequence_) +
+               sizeof(Impl_::client_send_us_));
+}
+C2S_Ping::~C2S_Ping() {
+  // @@protoc_insertion_point(destructor:proto.C2S_Ping)
+  SharedDtor(*this);
+}
+inline void C2S_Ping::SharedDtor(MessageLite& self) {
+  C2S_Ping& this_ = static_cast<C2S_Ping&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* C2S_Ping::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) C2S_Ping(arena);
+}
+constexpr auto C2S_Ping::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(C2S_Ping),
+                                            alignof(C2S_Ping));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull C2S_Ping::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_C2S_Ping_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &C2S_Ping::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<C2S_Ping>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &C2S_Ping::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<C2S_Ping>(), &C2S_Ping::ByteSizeLong,
+            &C2S_Ping::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(C2S_Ping, _impl_._cached_size_),
+        false,
+    },
+    &C2S_Ping::kDescriptorMethods,
+    &descriptor_table_C2S_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* C2S_Ping::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 0, 2> C2S_Ping::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::proto::C2S_Ping>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // int64 client_send_us = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(C2S_Ping, _impl_.client_send_us_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(C2S_Ping, _impl_.client_send_us_)}},
+    // int64 sequence = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(C2S_Ping, _impl_.sequence_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(C2S_Ping, _impl_.sequence_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int64 sequence = 1;
+    {PROTOBUF_FIELD_OFFSET(C2S_Ping, _impl_.sequence_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+    // int64 client_send_us = 2;
+    {PROTOBUF_FIELD_OFFSET(C2S_Ping, _impl_.client_send_us_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+PROTOBUF_NOINLINE void C2S_Ping::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.C2S_Ping)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.sequence_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.client_send_us_) -
+      reinterpret_cast<char*>(&_impl_.sequence_)) + sizeof(_impl_.client_send_us_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* C2S_Ping::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const C2S_Ping& this_ = static_cast<const C2S_Ping&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* C2S_Ping::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const C2S_Ping& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:proto.C2S_Ping)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // int64 sequence = 1;
+          if (this_._internal_sequence() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<1>(
+                    stream, this_._internal_sequence(), target);
+          }
+
+          // int64 client_send_us = 2;
+          if (this_._internal_client_send_us() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<2>(
+                    stream, this_._internal_client_send_us(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:proto.C2S_Ping)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t C2S_Ping::ByteSizeLong(const MessageLite& base) {
+          const C2S_Ping& this_ = static_cast<const C2S_Ping&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t C2S_Ping::ByteSizeLong() const {
+          const C2S_Ping& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:proto.C2S_Ping)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // int64 sequence = 1;
+            if (this_._internal_sequence() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_sequence());
+            }
+            // int64 client_send_us = 2;
+            if (this_._internal_client_send_us() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_client_send_us());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void C2S_Ping::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<C2S_Ping*>(&to_msg);
+  auto& from = static_cast<const C2S_Ping&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.C2S_Ping)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_sequence() != 0) {
+    _this->_impl_.sequence_ = from._impl_.sequence_;
+  }
+  if (from._internal_client_send_us() != 0) {
+    _this->_impl_.client_send_us_ = from._impl_.client_send_us_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void C2S_Ping::CopyFrom(const C2S_Ping& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.C2S_Ping)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void C2S_Ping::InternalSwap(C2S_Ping* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(C2S_Ping, _impl_.client_send_us_)
+      + sizeof(C2S_Ping::_impl_.client_send_us_)
+      - PROTOBUF_FIELD_OFFSET(C2S_Ping, _impl_.sequence_)>(
+          reinterpret_cast<char*>(&_impl_.sequence_),
+          reinterpret_cast<char*>(&other->_impl_.sequence_));
+}
+
+::google::protobuf::Metadata C2S_Ping::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class C2S_Hello::_Internal {
+ public:
+};
+
+C2S_Hello::C2S_Hello(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto.C2S_Hello)
+}
+C2S_Hello::C2S_Hello(
+    ::google::protobuf::Arena* arena, const C2S_Hello& from)
+    : C2S_Hello(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE C2S_Hello::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void C2S_Hello::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, compression_),
+           0,
+           offsetof(Impl_, dictionary_id_) -
+               offsetof(Impl_, compression_) +
+               sizeof(Impl_::dictionary_id_));
+}
+C2S_Hello::~C2S_Hello() {
+  // @@protoc_insertion_point(destructor:proto.C2S_Hello)
+  SharedDtor(*this);
+}
+inline void C2S_Hello::SharedDtor(MessageLite& self) {
+  C2S_Hello& this_ = static_cast<C2S_Hello&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* C2S_Hello::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) C2S_Hello(arena);
+}
+constexpr auto C2S_Hello::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(C2S_Hello),
+                                            alignof(C2S_Hello));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull C2S_Hello::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_C2S_Hello_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &C2S_Hello::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<C2S_Hello>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &C2S_Hello::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<C2S_Hello>(), &C2S_Hello::ByteSizeLong,
+            &C2S_Hello::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(C2S_Hello, _impl_._cached_size_),
+        false,
+    },
+    &C2S_Hello::kDescriptorMethods,
+    &descriptor_table_C2S_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* C2S_Hello::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 0, 2> C2S_Hello::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::proto::C2S_Hello>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // int64 dictionary_id = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(C2S_Hello, _impl_.dictionary_id_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(C2S_Hello, _impl_.dictionary_id_)}},
+    // int64 compression = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(C2S_Hello, _impl_.compression_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(C2S_Hello, _impl_.compression_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int64 compression = 1;
+    {PROTOBUF_FIELD_OFFSET(C2S_Hello, _impl_.compression_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+    // int64 dictionary_id = 2;
+    {PROTOBUF_FIELD_OFFSET(C2S_Hello, _impl_.dictionary_id_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+PROTOBUF_NOINLINE void C2S_Hello::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.C2S_Hello)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.compression_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.dictionary_id_) -
+      reinterpret_cast<char*>(&_impl_.compression_)) + sizeof(_impl_.dictionary_id_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* C2S_Hello::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const C2S_Hello& this_ = static_cast<const C2S_Hello&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* C2S_Hello::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const C2S_Hello& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:proto.C2S_Hello)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // int64 compression = 1;
+          if (this_._internal_compression() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<1>(
+                    stream, this_._internal_compression(), target);
+          }
+
+          // int64 dictionary_id = 2;
+          if (this_._internal_dictionary_id() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<2>(
+                    stream, this_._internal_dictionary_id(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:proto.C2S_Hello)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t C2S_Hello::ByteSizeLong(const MessageLite& base) {
+          const C2S_Hello& this_ = static_cast<const C2S_Hello&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t C2S_Hello::ByteSizeLong() const {
+          const C2S_Hello& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:proto.C2S_Hello)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // int64 compression = 1;
+            if (this_._internal_compression() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_compression());
+            }
+            // int64 dictionary_id = 2;
+            if (this_._internal_dictionary_id() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_dictionary_id());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void C2S_Hello::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<C2S_Hello*>(&to_msg);
+  auto& from = static_cast<const C2S_Hello&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.C2S_Hello)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_compression() != 0) {
+    _this->_impl_.compression_ = from._impl_.compression_;
+  }
+  if (from._internal_dictionary_id() != 0) {
+    _this->_impl_.dictionary_id_ = from._impl_.dictionary_id_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void C2S_Hello::CopyFrom(const C2S_Hello& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.C2S_Hello)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void C2S_Hello::InternalSwap(C2S_Hello* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(C2S_Hello, _impl_.dictionary_id_)
+      + sizeof(C2S_Hello::_impl_.dictionary_id_)
+      - PROTOBUF_FIELD_OFFSET(C2S_Hello, _impl_.compression_)>(
+          reinterpret_cast<char*>(&_impl_.compression_),
+          reinterpret_cast<char*>(&other->_impl_.compression_));
+}
+
+::google::protobuf::Metadata C2S_Hello::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace proto
 namespace google {
@@ -59,6 +59,12 @@ extern C2S_ChatDefaultTypeInternal _C2S_Chat_default_instance_;
 class C2S_EnterRoom;
 struct C2S_EnterRoomDefaultTypeInternal;
 extern C2S_EnterRoomDefaultTypeInternal _C2S_EnterRoom_default_instance_;
+class C2S_Hello;
+struct C2S_HelloDefaultTypeInternal;
+extern C2S_HelloDefaultTypeInternal _C2S_Hello_default_instance_;
+class C2S_Ping;
+struct C2S_PingDefaultTypeInternal;
+extern C2S_PingDefaultTypeInternal _C2S_Ping_default_instance_;
 }  // namespace proto
 namespace google {
 namespace protobuf {
@@ -221,6 +227,7 @@ class C2S_EnterRoom final
   enum : int {
     kPasswordFieldNumber = 2,
     kIdFieldNumber = 1,
+    kRoomIdFieldNumber = 3,
   };
   // string password = 2;
   void clear_password() ;
@@ -247,13 +254,23 @@ class C2S_EnterRoom final
   ::int64_t _internal_id() const;
   void _internal_set_id(::int64_t value);
 
+  public:
+  // int64 room_id = 3;
+  void clear_room_id() ;
+  ::int64_t room_id() const;
+  void set_room_id(::int64_t value);
+
+  private:
+  ::int64_t _internal_room_id() const;
+  void _internal_set_room_id(::int64_t value);
+
   public:
   // @@protoc_insertion_point(class_scope:proto.C2S_EnterRoom)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
   static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 0,
+      2, 3, 0,
       36, 2>
       _table_;
 
@@ -273,6 +290,7 @@ class C2S_EnterRoom final
                           const C2S_EnterRoom& from_msg);
     ::google::protobuf::internal::ArenaStringPtr password_;
     ::int64_t id_;
+    ::int64_t room_id_;
     ::google::protobuf::internal::CachedSize _cached_size_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
@@ -488,6 +506,412 @@ class C2S_Chat final
   union { Impl_ _impl_; };
   friend struct ::TableStruct_C2S_2eproto;
 };
+// -------------------------------------------------------------------
+
+class C2S_Ping final
+    : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:proto.C2S_Ping) */ {
+ public:
+  inline C2S_Ping() : C2S_Ping(nullptr) {}
+  ~C2S_Ping() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(C2S_Ping* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(C2S_Ping));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR C2S_Ping(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline C2S_Ping(const C2S_Ping& from) : C2S_Ping(nullptr, from) {}
+  inline C2S_Ping(C2S_Ping&& from) noexcept
+      : C2S_Ping(nullptr, std::move(from)) {}
+  inline C2S_Ping& operator=(const C2S_Ping& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline C2S_Ping& operator=(C2S_Ping&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const C2S_Ping& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const C2S_Ping* internal_default_instance() {
+    return reinterpret_cast<const C2S_Ping*>(
+        &_C2S_Ping_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 2;
+  friend void swap(C2S_Ping& a, C2S_Ping& b) { a.Swap(&b); }
+  inline void Swap(C2S_Ping* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(C2S_Ping* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  C2S_Ping* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<C2S_Ping>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const C2S_Ping& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const C2S_Ping& from) { C2S_Ping::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(C2S_Ping* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "proto.C2S_Ping"; }
+
+ protected:
+  explicit C2S_Ping(::google::protobuf::Arena* arena);
+  C2S_Ping(::google::protobuf::Arena* arena, const C2S_Ping& from);
+  C2S_Ping(::google::protobuf::Arena* arena, C2S_Ping&& from) noexcept
+      : C2S_Ping(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kSequenceFieldNumber = 1,
+    kClientSendUsFieldNumber = 2,
+  };
+  // int64 sequence = 1;
+  void clear_sequence() ;
+  ::int64_t sequence() const;
+  void set_sequence(::int64_t value);
+
+  private:
+  ::int64_t _internal_sequence() const;
+  void _internal_set_sequence(::int64_t value);
+
+  public:
+  // int64 client_send_us = 2;
+  void clear_client_send_us() ;
+  ::int64_t client_send_us() const;
+  void set_client_send_us(::int64_t value);
+
+  private:
+  ::int64_t _internal_client_send_us() const;
+  void _internal_set_client_send_us(::int64_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto.C2S_Ping)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 0,
+      0, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const C2S_Ping& from_msg);
+    ::int64_t sequence_;
+    ::int64_t client_send_us_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_C2S_2eproto;
+};
+// -------------------------------------------------------------------
+
+class C2S_Hello final
+    : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:proto.C2S_Hello) */ {
+ public:
+  inline C2S_Hello() : C2S_Hello(nullptr) {}
+  ~C2S_Hello() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(C2S_Hello* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(C2S_Hello));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR C2S_Hello(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline C2S_Hello(const C2S_Hello& from) : C2S_Hello(nullptr, from) {}
+  inline C2S_Hello(C2S_Hello&& from) noexcept
+      : C2S_Hello(nullptr, std::move(from)) {}
+  inline C2S_Hello& operator=(const C2S_Hello& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline C2S_Hello& operator=(C2S_Hello&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const C2S_Hello& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const C2S_Hello* internal_default_instance() {
+    return reinterpret_cast<const C2S_Hello*>(
+        &_C2S_Hello_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 3;
+  friend void swap(C2S_Hello& a, C2S_Hello& b) { a.Swap(&b); }
+  inline void Swap(C2S_Hello* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(C2S_Hello* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  C2S_Hello* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<C2S_Hello>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const C2S_Hello& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const C2S_Hello& from) { C2S_Hello::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(C2S_Hello* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "proto.C2S_Hello"; }
+
+ protected:
+  explicit C2S_Hello(::google::protobuf::Arena* arena);
+  C2S_Hello(::google::protobuf::Arena* arena, const C2S_Hello& from);
+  C2S_Hello(::google::protobuf::Arena* arena, C2S_Hello&& from) noexcept
+      : C2S_Hello(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kCompressionFieldNumber = 1,
+    kDictionaryIdFieldNumber = 2,
+  };
+  // int64 compression = 1;
+  void clear_compression() ;
+  ::int64_t compression() const;
+  void set_compression(::int64_t value);
+
+  private:
+  ::int64_t _internal_compression() const;
+  void _internal_set_compression(::int64_t value);
+
+  public:
+  // int64 dictionary_id = 2;
+  void clear_dictionary_id() ;
+  ::int64_t dictionary_id() const;
+  void set_dictionary_id(::int64_t value);
+
+  private:
+  ::int64_t _internal_dictionary_id() const;
+  void _internal_set_dictionary_id(::int64_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto.C2S_Hello)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 0,
+      0, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const C2S_Hello& from_msg);
+    ::int64_t compression_;
+    ::int64_t dictionary_id_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_C2S_2eproto;
+};
 
 // ===================================================================
 
@@ -575,6 +999,28 @@ inline void C2S_EnterRoom::set_allocated_password(std::string* value) {
   // @@protoc_insertion_point(field_set_allocated:proto.C2S_EnterRoom.password)
 }
 
+// int64 room_id = 3;
+inline void C2S_EnterRoom::clear_room_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.room_id_ = ::int64_t{0};
+}
+inline ::int64_t C2S_EnterRoom::room_id() const {
+  // @@protoc_insertion_point(field_get:proto.C2S_EnterRoom.room_id)
+  return _internal_room_id();
+}
+inline void C2S_EnterRoom::set_room_id(::int64_t value) {
+  _internal_set_room_id(value);
+  // @@protoc_insertion_point(field_set:proto.C2S_EnterRoom.room_id)
+}
+inline ::int64_t C2S_EnterRoom::_internal_room_id() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.room_id_;
+}
+inline void C2S_EnterRoom::_internal_set_room_id(::int64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.room_id_ = value;
+}
+
 // -------------------------------------------------------------------
 
 // C2S_Chat
@@ -649,6 +1095,102 @@ inline void C2S_Chat::set_allocated_message(std::string* value) {
   // @@protoc_insertion_point(field_set_allocated:proto.C2S_Chat.message)
 }
 
+// -------------------------------------------------------------------
+
+// C2S_Ping
+
+// int64 sequence = 1;
+inline void C2S_Ping::clear_sequence() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.sequence_ = ::int64_t{0};
+}
+inline ::int64_t C2S_Ping::sequence() const {
+  // @@protoc_insertion_point(field_get:proto.C2S_Ping.sequence)
+  return _internal_sequence();
+}
+inline void C2S_Ping::set_sequence(::int64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:proto.C2S_Ping.sequence)
+}
+inline ::int64_t C2S_Ping::_internal_sequence() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.sequence_;
+}
+inline void C2S_Ping::_internal_set_sequence(::int64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.sequence_ = value;
+}
+
+// int64 client_send_us = 2;
+inline void C2S_Ping::clear_client_send_us() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.client_send_us_ = ::int64_t{0};
+}
+inline ::int64_t C2S_Ping::client_send_us() const {
+  // @@protoc_insertion_point(field_get:proto.C2S_Ping.client_send_us)
+  return _internal_client_send_us();
+}
+inline void C2S_Ping::set_client_send_us(::int64_t value) {
+  _internal_set_client_send_us(value);
+  // @@protoc_insertion_point(field_set:proto.C2S_Ping.client_send_us)
+}
+inline ::int64_t C2S_Ping::_internal_client_send_us() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.client_send_us_;
+}
+inline void C2S_Ping::_internal_set_client_send_us(::int64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.client_send_us_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// C2S_Hello
+
+// int64 compression = 1;
+inline void C2S_Hello::clear_compression() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.compression_ = ::int64_t{0};
+}
+inline ::int64_t C2S_Hello::compression() const {
+  // @@protoc_insertion_point(field_get:proto.C2S_Hello.compression)
+  return _internal_compression();
+}
+inline void C2S_Hello::set_compression(::int64_t value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:proto.C2S_Hello.compression)
+}
+inline ::int64_t C2S_Hello::_internal_compression() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.compression_;
+}
+inline void C2S_Hello::_internal_set_compression(::int64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.compression_ = value;
+}
+
+// int64 dictionary_id = 2;
+inline void C2S_Hello::clear_dictionary_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.dictionary_id_ = ::int64_t{0};
+}
+inline ::int64_t C2S_Hello::dictionary_id() const {
+  // @@protoc_insertion_point(field_get:proto.C2S_Hello.dictionary_id)
+  return _internal_dictionary_id();
+}
+inline void C2S_Hello::set_dictionary_id(::int64_t value) {
+  _internal_set_dictionary_id(value);
+  // @@protoc_insertion_point(field_set:proto.C2S_Hello.dictionary_id)
+}
+inline ::int64_t C2S_Hello::_internal_dictionary_id() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.dictionary_id_;
+}
+inline void C2S_Hello::_internal_set_dictionary_id(::int64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.dictionary_id_ = value;
+}
+
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -79,6 +79,62 @@ struct S2C_ChatDefaultTypeInternal {
 
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 S2C_ChatDefaultTypeInternal _S2C_Chat_default_instance_;
+
+inline constexpr S2C_Pong::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : sequence_{::int64_t{0}},
+        client_send_us_{::int64_t{0}},
+        tick_wait_us_{::int64_t{0}},
+        queue_us_{::int64_t{0}},
+        handler_us_{::int64_t{0}},
+        egress_us_{::int64_t{0}},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR S2C_Pong::S2C_Pong(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct S2C_PongDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR S2C_PongDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~S2C_PongDefaultTypeInternal() {}
+  union {
+    S2C_Pong _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 S2C_PongDefaultTypeInternal _S2C_Pong_default_instance_;
+
+inline constexpr S2C_Hello::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : compression_{::int64_t{0}},
+        dictionary_id_{::int64_t{0}},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR S2C_Hello::S2C_Hello(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct S2C_HelloDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR S2C_HelloDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~S2C_HelloDefaultTypeInternal() {}
+  union {
+    S2C_Hello _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 S2C_HelloDefaultTypeInternal _S2C_Hello_default_instance_;
 }  // namespace proto
 static constexpr const ::_pb::EnumDescriptor**
     file_level_enum_descriptors_S2C_2eproto = nullptr;
@@ -107,23 +163,55 @@ const ::uint32_t
         ~0u,  // no sizeof(Split)
         PROTOBUF_FIELD_OFFSET(::proto::S2C_Chat, _impl_.id_),
         PROTOBUF_FIELD_OFFSET(::proto::S2C_Chat, _impl_.message_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::proto::S2C_Pong, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::proto::S2C_Pong, _impl_.sequence_),
+        PROTOBUF_FIELD_OFFSET(::proto::S2C_Pong, _impl_.client_send_us_),
+        PROTOBUF_FIELD_OFFSET(::proto::S2C_Pong, _impl_.tick_wait_us_),
+        PROTOBUF_FIELD_OFFSET(::proto::S2C_Pong, _impl_.queue_us_),
+        PROTOBUF_FIELD_OFFSET(::proto::S2C_Pong, _impl_.handler_us_),
+        PROTOBUF_FIELD_OFFSET(::proto::S2C_Pong, _impl_.egress_us_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::proto::S2C_Hello, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::proto::S2C_Hello, _impl_.compression_),
+        PROTOBUF_FIELD_OFFSET(::proto::S2C_Hello, _impl_.dictionary_id_),
 };
 
 static const ::_pbi::MigrationSchema
     schemas[] ABSL_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
         {0, -1, -1, sizeof(::proto::S2C_EnterRoom)},
         {10, -1, -1, sizeof(::proto::S2C_Chat)},
+        {20, -1, -1, sizeof(::proto::S2C_Pong)},
+        {34, -1, -1, sizeof(::proto::S2C_Hello)},
 };
 static const ::_pb::Message* const file_default_instances[] = {
     &::proto::_S2C_EnterRoom_default_instance_._instance,
     &::proto::_S2C_Chat_default_instance_._instance,
+    &::proto::_S2C_Pong_default_instance_._instance,
+    &::proto::_S2C_Hello_default_instance_._instance,
 };
 const char descriptor_table_protodef_S2C_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
     protodesc_cold) = {
     "\n\tS2C.proto\022\005proto\032\014Common.proto\",\n\rS2C_"
     "EnterRoom\022\n\n\002id\030\001 \001(\003\022\017\n\007success\030\002 \001(\010\"\'"
-    "\n\010S2C_Chat\022\n\n\002id\030\001 \001(\003\022\017\n\007message\030\002 \001(\tb"
-    "\006proto3"
+    "\n\010S2C_Chat\022\n\n\002id\030\001 \001(\003\022\017\n\007message\030\002 \001(\t\""
+    "\203\001\n\010S2C_Pong\022\020\n\010sequence\030\001 \001(\003\022\026\n\016client"
+    "_send_us\030\002 \001(\003\022\024\n\014tick_wait_us\030\003 \001(\003\022\020\n\010"
+    "queue_us\030\004 \001(\003\022\022\n\nhandler_us\030\005 \001(\003\022\021\n\teg"
+    "ress_us\030\006 \001(\003\"7\n\tS2C_Hello\022\023\n\013compressio"
+    "n\030\001 \001(\003\022\025\n\rdictionary_id\030\002 \001(\003b\006proto3"
 };
 static const ::_pbi::DescriptorTable* const descriptor_table_S2C_2eproto_deps[1] =
     {
@@ -133,13 +221,13 @@ static ::absl::once_flag descriptor_table_S2C_2eproto_once;
 PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_S2C_2eproto = {
     false,
     false,
-    127,
+    318,
     descriptor_table_protodef_S2C_2eproto,
     "S2C.proto",
     &descriptor_table_S2C_2eproto_once,
     descriptor_table_S2C_2eproto_deps,
     1,
-    2,
+    4,
     schemas,
     file_default_instances,
     TableStruct_S2C_2eproto::offsets,
@@ -644,6 +732,574 @@ void S2C_Chat::InternalSwap(S2C_Chat* PROTOBUF_RESTRICT other) {
 ::google::protobuf::Metadata S2C_Chat::GetMetadata() const {
   return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
 }
+// ===================================================================
+
+class S2C_Pong::_Internal {
+ public:
+};
+
+S2C_Pong::S2C_Pong(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto.S2C_Pong)
+}
+S2C_Pong::S2C_Pong(
+    ::google::protobuf::Arena* arena, const S2C_Pong& from)
+    : S2C_Pong(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE S2C_Pong::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void S2C_Pong::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, sequence_),
+           0,
+           offsetof(Impl_, egress_us_) -
+               offsetof(Impl_, sequence_) +
+               sizeof(Impl_::egress_us_));
+}
+S2C_Pong::~S2C_Pong() {
+  // @@protoc_insertion_point(destructor:proto.S2C_Pong)
+  SharedDtor(*this);
+}
+inline void S2C_Pong::SharedDtor(MessageLite& self) {
+  S2C_Pong& this_ = static_cast<S2C_Pong&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* S2C_Pong::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) S2C_Pong(arena);
+}
+constexpr auto S2C_Pong::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(S2C_Pong),
+                                            alignof(S2C_Pong));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull S2C_Pong::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_S2C_Pong_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &S2C_Pong::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<S2C_Pong>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &S2C_Pong::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<S2C_Pong>(), &S2C_Pong::ByteSizeLong,
+            &S2C_Pong::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(S2C_Pong, _impl_._cached_size_),
+        false,
+    },
+    &S2C_Pong::kDescriptorMethods,
+    &descriptor_table_S2C_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* S2C_Pong::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 6, 0, 0, 2> S2C_Pong::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    6, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967232,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    6,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::proto::S2C_Pong>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // int64 sequence = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(S2C_Pong, _impl_.sequence_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(S2C_Pong, _impl_.sequence_)}},
+    // int64 client_send_us = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(S2C_Pong, _impl_.client_send_us_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(S2C_Pong, _impl_.client_send_us_)}},
+    // int64 tick_wait_us = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(S2C_Pong, _impl_.tick_wait_us_), 63>(),
+     {24, 63, 0, PROTOBUF_FIELD_OFFSET(S2C_Pong, _impl_.tick_wait_us_)}},
+    // int64 queue_us = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(S2C_Pong, _impl_.queue_us_), 63>(),
+     {32, 63, 0, PROTOBUF_FIELD_OFFSET(S2C_Pong, _impl_.queue_us_)}},
+    // int64 handler_us = 5;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(S2C_Pong, _impl_.handler_us_), 63>(),
+     {40, 63, 0, PROTOBUF_FIELD_OFFSET(S2C_Pong, _impl_.handler_us_)}},
+    // int64 egress_us = 6;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(S2C_Pong, _impl_.egress_us_), 63>(),
+     {48, 63, 0, PROTOBUF_FIELD_OFFSET(S2C_Pong, _impl_.egress_us_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int64 sequence = 1;
+    {PROTOBUF_FIELD_OFFSET(S2C_Pong, _impl_.sequence_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+    // int64 client_send_us = 2;
+    {PROTOBUF_FIELD_OFFSET(S2C_Pong, _impl_.client_send_us_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+    // int64 tick_wait_us = 3;
+    {PROTOBUF_FIELD_OFFSET(S2C_Pong, _impl_.tick_wait_us_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+    // int64 queue_us = 4;
+    {PROTOBUF_FIELD_OFFSET(S2C_Pong, _impl_.queue_us_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+    // int64 handler_us = 5;
+    {PROTOBUF_FIELD_OFFSET(S2C_Pong, _impl_.handler_us_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+    // int64 egress_us = 6;
+    {PROTOBUF_FIELD_OFFSET(S2C_Pong, _impl_.egress_us_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+PROTOBUF_NOINLINE void S2C_Pong::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.S2C_Pong)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.sequence_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.egress_us_) -
+      reinterpret_cast<char*>(&_impl_.sequence_)) + sizeof(_impl_.egress_us_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* S2C_Pong::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const S2C_Pong& this_ = static_cast<const S2C_Pong&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* S2C_Pong::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const S2C_Pong& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:proto.S2C_Pong)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // int64 sequence = 1;
+          if (this_._internal_sequence() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<1>(
+                    stream, this_._internal_sequence(), target);
+          }
+
+          // int64 client_send_us = 2;
+          if (this_._internal_client_send_us() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<2>(
+                    stream, this_._internal_client_send_us(), target);
+          }
+
+          // int64 tick_wait_us = 3;
+          if (this_._internal_tick_wait_us() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<3>(
+                    stream, this_._internal_tick_wait_us(), target);
+          }
+
+          // int64 queue_us = 4;
+          if (this_._internal_queue_us() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<4>(
+                    stream, this_._internal_queue_us(), target);
+          }
+
+          // int64 handler_us = 5;
+          if (this_._internal_handler_us() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<5>(
+                    stream, this_._internal_handler_us(), target);
+          }
+
+          // int64 egress_us = 6;
+          if (this_._internal_egress_us() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<6>(
+                    stream, this_._internal_egress_us(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:proto.S2C_Pong)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t S2C_Pong::ByteSizeLong(const MessageLite& base) {
+          const S2C_Pong& this_ = static_cast<const S2C_Pong&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t S2C_Pong::ByteSizeLong() const {
+          const S2C_Pong& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:proto.S2C_Pong)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // int64 sequence = 1;
+            if (this_._internal_sequence() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_sequence());
+            }
+            // int64 client_send_us = 2;
+            if (this_._internal_client_send_us() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_client_send_us());
+            }
+            // int64 tick_wait_us = 3;
+            if (this_._internal_tick_wait_us() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_tick_wait_us());
+            }
+            // int64 queue_us = 4;
+            if (this_._internal_queue_us() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_queue_us());
+            }
+            // int64 handler_us = 5;
+            if (this_._internal_handler_us() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_handler_us());
+            }
+            // int64 egress_us = 6;
+            if (this_._internal_egress_us() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_egress_us());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void S2C_Pong::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<S2C_Pong*>(&to_msg);
+  auto& from = static_cast<const S2C_Pong&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.S2C_Pong)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_sequence() != 0) {
+    _this->_impl_.sequence_ = from._impl_.sequence_;
+  }
+  if (from._internal_client_send_us() != 0) {
+    _this->_impl_.client_send_us_ = from._impl_.client_send_us_;
+  }
+  if (from._internal_tick_wait_us() != 0) {
+    _this->_impl_.tick_wait_us_ = from._impl_.tick_wait_us_;
+  }
+  if (from._internal_queue_us() != 0) {
+    _this->_impl_.queue_us_ = from._impl_.queue_us_;
+  }
+  if (from._internal_handler_us() != 0) {
+    _this->_impl_.handler_us_ = from._impl_.handler_us_;
+  }
+  if (from._internal_egress_us() != 0) {
+    _this->_impl_.egress_us_ = from._impl_.egress_us_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void S2C_Pong::CopyFrom(const S2C_Pong& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.S2C_Pong)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void S2C_Pong::InternalSwap(S2C_Pong* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(S2C_Pong, _impl_.egress_us_)
+      + sizeof(S2C_Pong::_impl_.egress_us_)
+      - PROTOBUF_FIELD_OFFSET(S2C_Pong, _impl_.sequence_)>(
+          reinterpret_cast<char*>(&_impl_.sequence_),
+          reinterpret_cast<char*>(&other->_impl_.sequence_));
+}
+
+::google::protobuf::Metadata S2C_Pong::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class S2C_Hello::_Internal {
+ public:
+};
+
+S2C_Hello::S2C_Hello(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto.S2C_Hello)
+}
+S2C_Hello::S2C_Hello(
+    ::google::protobuf::Arena* arena, const S2C_Hello& from)
+    : S2C_Hello(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE S2C_Hello::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void S2C_Hello::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, compression_),
+           0,
+           offsetof(Impl_, dictionary_id_) -
+               offsetof(Impl_, compression_) +
+               sizeof(Impl_::dictionary_id_));
+}
+S2C_Hello::~S2C_Hello() {
+  // @@protoc_insertion_point(destructor:proto.S2C_Hello)
+  SharedDtor(*this);
+}
+inline void S2C_Hello::SharedDtor(MessageLite& self) {
+  S2C_Hello& this_ = static_cast<S2C_Hello&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* S2C_Hello::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) S2C_Hello(arena);
+}
+constexpr auto S2C_Hello::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(S2C_Hello),
+                                            alignof(S2C_Hello));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull S2C_Hello::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_S2C_Hello_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &S2C_Hello::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<S2C_Hello>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &S2C_Hello::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<S2C_Hello>(), &S2C_Hello::ByteSizeLong,
+            &S2C_Hello::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(S2C_Hello, _impl_._cached_size_),
+        false,
+    },
+    &S2C_Hello::kDescriptorMethods,
+    &descriptor_table_S2C_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* S2C_Hello::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 0, 2> S2C_Hello::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::proto::S2C_Hello>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // int64 dictionary_id = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(S2C_Hello, _impl_.dictionary_id_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(S2C_Hello, _impl_.dictionary_id_)}},
+    // int64 compression = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(S2C_Hello, _impl_.compression_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(S2C_Hello, _impl_.compression_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int64 compression = 1;
+    {PROTOBUF_FIELD_OFFSET(S2C_Hello, _impl_.compression_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+    // int64 dictionary_id = 2;
+    {PROTOBUF_FIELD_OFFSET(S2C_Hello, _impl_.dictionary_id_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+PROTOBUF_NOINLINE void S2C_Hello::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.S2C_Hello)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.compression_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.dictionary_id_) -
+      reinterpret_cast<char*>(&_impl_.compression_)) + sizeof(_impl_.dictionary_id_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* S2C_Hello::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const S2C_Hello& this_ = static_cast<const S2C_Hello&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* S2C_Hello::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const S2C_Hello& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:proto.S2C_Hello)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // int64 compression = 1;
+          if (this_._internal_compression() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<1>(
+                    stream, this_._internal_compression(), target);
+          }
+
+          // int64 dictionary_id = 2;
+          if (this_._internal_dictionary_id() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<2>(
+                    stream, this_._internal_dictionary_id(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:proto.S2C_Hello)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t S2C_Hello::ByteSizeLong(const MessageLite& base) {
+          const S2C_Hello& this_ = static_cast<const S2C_Hello&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t S2C_Hello::ByteSizeLong() const {
+          const S2C_Hello& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:proto.S2C_Hello)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // int64 compression = 1;
+            if (this_._internal_compression() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_compression());
+            }
+            // int64 dictionary_id = 2;
+            if (this_._internal_dictionary_id() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_dictionary_id());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void S2C_Hello::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<S2C_Hello*>(&to_msg);
+  auto& from = static_cast<const S2C_Hello&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.S2C_Hello)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_compression() != 0) {
+    _this->_impl_.compression_ = from._impl_.compression_;
+  }
+  if (from._internal_dictionary_id() != 0) {
+    _this->_impl_.dictionary_id_ = from._impl_.dictionary_id_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void S2C_Hello::CopyFrom(const S2C_Hello& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.S2C_Hello)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void S2C_Hello::InternalSwap(S2C_Hello* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(S2C_Hello, _impl_.dictionary_id_)
+      + sizeof(S2C_Hello::_impl_.dictionary_id_)
+      - PROTOBUF_FIELD_OFFSET(S2C_Hello, _impl_.compression_)>(
+          reinterpret_cast<char*>(&_impl_.compression_),
+          reinterpret_cast<char*>(&other->_impl_.compression_));
+}
+
+::google::protobuf::Metadata S2C_Hello::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace proto
 namespace google {
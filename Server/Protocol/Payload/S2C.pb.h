@@ -59,6 +59,12 @@ extern S2C_ChatDefaultTypeInternal _S2C_Chat_default_instance_;
 class S2C_EnterRoom;
 struct S2C_EnterRoomDefaultTypeInternal;
 extern S2C_EnterRoomDefaultTypeInternal _S2C_EnterRoom_default_instance_;
+class S2C_Hello;
+struct S2C_HelloDefaultTypeInternal;
+extern S2C_HelloDefaultTypeInternal _S2C_Hello_default_instance_;
+class S2C_Pong;
+struct S2C_PongDefaultTypeInternal;
+extern S2C_PongDefaultTypeInternal _S2C_Pong_default_instance_;
 }  // namespace proto
 namespace google {
 namespace protobuf {
@@ -482,6 +488,460 @@ class S2C_Chat final
   union { Impl_ _impl_; };
   friend struct ::TableStruct_S2C_2eproto;
 };
+// -------------------------------------------------------------------
+
+class S2C_Pong final
+    : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:proto.S2C_Pong) */ {
+ public:
+  inline S2C_Pong() : S2C_Pong(nullptr) {}
+  ~S2C_Pong() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(S2C_Pong* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(S2C_Pong));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR S2C_Pong(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline S2C_Pong(const S2C_Pong& from) : S2C_Pong(nullptr, from) {}
+  inline S2C_Pong(S2C_Pong&& from) noexcept
+      : S2C_Pong(nullptr, std::move(from)) {}
+  inline S2C_Pong& operator=(const S2C_Pong& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline S2C_Pong& operator=(S2C_Pong&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const S2C_Pong& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const S2C_Pong* internal_default_instance() {
+    return reinterpret_cast<const S2C_Pong*>(
+        &_S2C_Pong_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 2;
+  friend void swap(S2C_Pong& a, S2C_Pong& b) { a.Swap(&b); }
+  inline void Swap(S2C_Pong* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(S2C_Pong* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  S2C_Pong* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<S2C_Pong>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const S2C_Pong& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const S2C_Pong& from) { S2C_Pong::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(S2C_Pong* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "proto.S2C_Pong"; }
+
+ protected:
+  explicit S2C_Pong(::google::protobuf::Arena* arena);
+  S2C_Pong(::google::protobuf::Arena* arena, const S2C_Pong& from);
+  S2C_Pong(::google::protobuf::Arena* arena, S2C_Pong&& from) noexcept
+      : S2C_Pong(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kSequenceFieldNumber = 1,
+    kClientSendUsFieldNumber = 2,
+    kTickWaitUsFieldNumber = 3,
+    kQueueUsFieldNumber = 4,
+    kHandlerUsFieldNumber = 5,
+    kEgressUsFieldNumber = 6,
+  };
+  // int64 sequence = 1;
+  void clear_sequence() ;
+  ::int64_t sequence() const;
+  void set_sequence(::int64_t value);
+
+  private:
+  ::int64_t _internal_sequence() const;
+  void _internal_set_sequence(::int64_t value);
+
+  public:
+  // int64 client_send_us = 2;
+  void clear_client_send_us() ;
+  ::int64_t client_send_us() const;
+  void set_client_send_us(::int64_t value);
+
+  private:
+  ::int64_t _internal_client_send_us() const;
+  void _internal_set_client_send_us(::int64_t value);
+
+  public:
+  // int64 tick_wait_us = 3;
+  void clear_tick_wait_us() ;
+  ::int64_t tick_wait_us() const;
+  void set_tick_wait_us(::int64_t value);
+
+  private:
+  ::int64_t _internal_tick_wait_us() const;
+  void _internal_set_tick_wait_us(::int64_t value);
+
+  public:
+  // int64 queue_us = 4;
+  void clear_queue_us() ;
+  ::int64_t queue_us() const;
+  void set_queue_us(::int64_t value);
+
+  private:
+  ::int64_t _internal_queue_us() const;
+  void _internal_set_queue_us(::int64_t value);
+
+  public:
+  // int64 handler_us = 5;
+  void clear_handler_us() ;
+  ::int64_t handler_us() const;
+  void set_handler_us(::int64_t value);
+
+  private:
+  ::int64_t _internal_handler_us() const;
+  void _internal_set_handler_us(::int64_t value);
+
+  public:
+  // int64 egress_us = 6;
+  void clear_egress_us() ;
+  ::int64_t egress_us() const;
+  void set_egress_us(::int64_t value);
+
+  private:
+  ::int64_t _internal_egress_us() const;
+  void _internal_set_egress_us(::int64_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto.S2C_Pong)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      3, 6, 0,
+      0, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const S2C_Pong& from_msg);
+    ::int64_t sequence_;
+    ::int64_t client_send_us_;
+    ::int64_t tick_wait_us_;
+    ::int64_t queue_us_;
+    ::int64_t handler_us_;
+    ::int64_t egress_us_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_S2C_2eproto;
+};
+// -------------------------------------------------------------------
+
+class S2C_Hello final
+    : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:proto.S2C_Hello) */ {
+ public:
+  inline S2C_Hello() : S2C_Hello(nullptr) {}
+  ~S2C_Hello() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(S2C_Hello* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(S2C_Hello));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR S2C_Hello(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline S2C_Hello(const S2C_Hello& from) : S2C_Hello(nullptr, from) {}
+  inline S2C_Hello(S2C_Hello&& from) noexcept
+      : S2C_Hello(nullptr, std::move(from)) {}
+  inline S2C_Hello& operator=(const S2C_Hello& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline S2C_Hello& operator=(S2C_Hello&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const S2C_Hello& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const S2C_Hello* internal_default_instance() {
+    return reinterpret_cast<const S2C_Hello*>(
+        &_S2C_Hello_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 3;
+  friend void swap(S2C_Hello& a, S2C_Hello& b) { a.Swap(&b); }
+  inline void Swap(S2C_Hello* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(S2C_Hello* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  S2C_Hello* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<S2C_Hello>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const S2C_Hello& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const S2C_Hello& from) { S2C_Hello::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(S2C_Hello* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "proto.S2C_Hello"; }
+
+ protected:
+  explicit S2C_Hello(::google::protobuf::Arena* arena);
+  S2C_Hello(::google::protobuf::Arena* arena, const S2C_Hello& from);
+  S2C_Hello(::google::protobuf::Arena* arena, S2C_Hello&& from) noexcept
+      : S2C_Hello(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kCompressionFieldNumber = 1,
+    kDictionaryIdFieldNumber = 2,
+  };
+  // int64 compression = 1;
+  void clear_compression() ;
+  ::int64_t compression() const;
+  void set_compression(::int64_t value);
+
+  private:
+  ::int64_t _internal_compression() const;
+  void _internal_set_compression(::int64_t value);
+
+  public:
+  // int64 dictionary_id = 2;
+  void clear_dictionary_id() ;
+  ::int64_t dictionary_id() const;
+  void set_dictionary_id(::int64_t value);
+
+  private:
+  ::int64_t _internal_dictionary_id() const;
+  void _internal_set_dictionary_id(::int64_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:proto.S2C_Hello)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 0,
+      0, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const S2C_Hello& from_msg);
+    ::int64_t compression_;
+    ::int64_t dictionary_id_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_S2C_2eproto;
+};
 
 // ===================================================================
 
@@ -617,6 +1077,190 @@ inline void S2C_Chat::set_allocated_message(std::string* value) {
   // @@protoc_insertion_point(field_set_allocated:proto.S2C_Chat.message)
 }
 
+// -------------------------------------------------------------------
+
+// S2C_Pong
+
+// int64 sequence = 1;
+inline void S2C_Pong::clear_sequence() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.sequence_ = ::int64_t{0};
+}
+inline ::int64_t S2C_Pong::sequence() const {
+  // @@protoc_insertion_point(field_get:proto.S2C_Pong.sequence)
+  return _internal_sequence();
+}
+inline void S2C_Pong::set_sequence(::int64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:proto.S2C_Pong.sequence)
+}
+inline ::int64_t S2C_Pong::_internal_sequence() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.sequence_;
+}
+inline void S2C_Pong::_internal_set_sequence(::int64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.sequence_ = value;
+}
+
+// int64 client_send_us = 2;
+inline void S2C_Pong::clear_client_send_us() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.client_send_us_ = ::int64_t{0};
+}
+inline ::int64_t S2C_Pong::client_send_us() const {
+  // @@protoc_insertion_point(field_get:proto.S2C_Pong.client_send_us)
+  return _internal_client_send_us();
+}
+inline void S2C_Pong::set_client_send_us(::int64_t value) {
+  _internal_set_client_send_us(value);
+  // @@protoc_insertion_point(field_set:proto.S2C_Pong.client_send_us)
+}
+inline ::int64_t S2C_Pong::_internal_client_send_us() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.client_send_us_;
+}
+inline void S2C_Pong::_internal_set_client_send_us(::int64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.client_send_us_ = value;
+}
+
+// int64 tick_wait_us = 3;
+inline void S2C_Pong::clear_tick_wait_us() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.tick_wait_us_ = ::int64_t{0};
+}
+inline ::int64_t S2C_Pong::tick_wait_us() const {
+  // @@protoc_insertion_point(field_get:proto.S2C_Pong.tick_wait_us)
+  return _internal_tick_wait_us();
+}
+inline void S2C_Pong::set_tick_wait_us(::int64_t value) {
+  _internal_set_tick_wait_us(value);
+  // @@protoc_insertion_point(field_set:proto.S2C_Pong.tick_wait_us)
+}
+inline ::int64_t S2C_Pong::_internal_tick_wait_us() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.tick_wait_us_;
+}
+inline void S2C_Pong::_internal_set_tick_wait_us(::int64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.tick_wait_us_ = value;
+}
+
+// int64 queue_us = 4;
+inline void S2C_Pong::clear_queue_us() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.queue_us_ = ::int64_t{0};
+}
+inline ::int64_t S2C_Pong::queue_us() const {
+  // @@protoc_insertion_point(field_get:proto.S2C_Pong.queue_us)
+  return _internal_queue_us();
+}
+inline void S2C_Pong::set_queue_us(::int64_t value) {
+  _internal_set_queue_us(value);
+  // @@protoc_insertion_point(field_set:proto.S2C_Pong.queue_us)
+}
+inline ::int64_t S2C_Pong::_internal_queue_us() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.queue_us_;
+}
+inline void S2C_Pong::_internal_set_queue_us(::int64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.queue_us_ = value;
+}
+
+// int64 handler_us = 5;
+inline void S2C_Pong::clear_handler_us() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.handler_us_ = ::int64_t{0};
+}
+inline ::int64_t S2C_Pong::handler_us() const {
+  // @@protoc_insertion_point(field_get:proto.S2C_Pong.handler_us)
+  return _internal_handler_us();
+}
+inline void S2C_Pong::set_handler_us(::int64_t value) {
+  _internal_set_handler_us(value);
+  // @@protoc_insertion_point(field_set:proto.S2C_Pong.handler_us)
+}
+inline ::int64_t S2C_Pong::_internal_handler_us() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.handler_us_;
+}
+inline void S2C_Pong::_internal_set_handler_us(::int64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.handler_us_ = value;
+}
+
+// int64 egress_us = 6;
+inline void S2C_Pong::clear_egress_us() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.egress_us_ = ::int64_t{0};
+}
+inline ::int64_t S2C_Pong::egress_us() const {
+  // @@protoc_insertion_point(field_get:proto.S2C_Pong.egress_us)
+  return _internal_egress_us();
+}
+inline void S2C_Pong::set_egress_us(::int64_t value) {
+  _internal_set_egress_us(value);
+  // @@protoc_insertion_point(field_set:proto.S2C_Pong.egress_us)
+}
+inline ::int64_t S2C_Pong::_internal_egress_us() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.egress_us_;
+}
+inline void S2C_Pong::_internal_set_egress_us(::int64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.egress_us_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// S2C_Hello
+
+// int64 compression = 1;
+inline void S2C_Hello::clear_compression() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.compression_ = ::int64_t{0};
+}
+inline ::int64_t S2C_Hello::compression() const {
+  // @@protoc_insertion_point(field_get:proto.S2C_Hello.compression)
+  return _internal_compression();
+}
+inline void S2C_Hello::set_compression(::int64_t value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:proto.S2C_Hello.compression)
+}
+inline ::int64_t S2C_Hello::_internal_compression() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.compression_;
+}
+inline void S2C_Hello::_internal_set_compression(::int64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.compression_ = value;
+}
+
+// int64 dictionary_id = 2;
+inline void S2C_Hello::clear_dictionary_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.dictionary_id_ = ::int64_t{0};
+}
+inline ::int64_t S2C_Hello::dictionary_id() const {
+  // @@protoc_insertion_point(field_get:proto.S2C_Hello.dictionary_id)
+  return _internal_dictionary_id();
+}
+inline void S2C_Hello::set_dictionary_id(::int64_t value) {
+  _internal_set_dictionary_id(value);
+  // @@protoc_insertion_point(field_set:proto.S2C_Hello.dictionary_id)
+}
+inline ::int64_t S2C_Hello::_internal_dictionary_id() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.dictionary_id_;
+}
+inline void S2C_Hello::_internal_set_dictionary_id(::int64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.dictionary_id_ = value;
+}
+
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif  // __GNUC__
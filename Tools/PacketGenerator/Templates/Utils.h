@@ -3,7 +3,10 @@
 #pragma once
 
 #include "Protocol/Packet/Type.h"
+#include "Protocol/Packet/Stream.h"
+#include "Protocol/Packet/Compression.h"
 #include "Core/Network/Session.h"
+#include <google/protobuf/io/coded_stream.h>
 
 namespace proto
 {
@@ -26,33 +29,136 @@ namespace proto
             }
         }
 
-        // 전송할 Packet을 SendBuffer로 생성
+        // 전송할 Packet을 하나의 프레임으로 SendBuffer에 생성 (페이로드가 kMaxFramePayloadSize를 넘으면 nullptr)
         template<typename TPayload>
         static SharedPtr<core::SendBuffer> MakeSendBuffer(const TPayload& payload, PacketId id)
+        {
+            const Int64 payloadSize = static_cast_64(payload.ByteSizeLong());
+            if (payloadSize > kMaxFramePayloadSize)
+            {
+                LOG_ERROR(Network, TEXT_8("Packet[{}]: Payload too large for a frame: {}"), static_cast_16(id), payloadSize);
+                return nullptr;
+            }
+
+            return MakeFrame(payload, id, payloadSize);
+        }
+
+        // 전송할 Packet을 크기에 맞게 하나 이상의 프레임으로 생성 (페이로드가 kMaxMessageSize를 넘으면 빈 목록)
+        template<typename TPayload>
+        static Vector<SharedPtr<core::SendBuffer>> MakeSendBuffers(const TPayload& payload, PacketId id)
+        {
+            const Int64 payloadSize = static_cast_64(payload.ByteSizeLong());
+            if (!IsValidMessageSize(id, payloadSize))
+            {
+                return {};
+            }
+
+            if (payloadSize <= kMaxFramePayloadSize)
+            {
+                return {MakeFrame(payload, id, payloadSize)};
+            }
+
+            return MakeFrames(payload, id, payloadSize);
+        }
+
+    private:
+        template<typename TPayload>
+        static void Send(const SharedPtr<core::Session>& target, const TPayload& payload, PacketId id)
+        {
+            const Int64 payloadSize = static_cast_64(payload.ByteSizeLong());
+            if (!IsValidMessageSize(id, payloadSize))
+            {
+                return;
+            }
+
+            // 압축을 협상한 세션이면 압축해서 송신 (효과가 없으면 그대로 송신)
+            if (target->IsCompressionEnabled() && (payloadSize >= PacketCompressor::GetInstance().GetThreshold()))
+            {
+                Vector<SharedPtr<core::SendBuffer>> frames = MakeCompressedFrames(payload, id, payloadSize);
+                if (!frames.empty())
+                {
+                    target->SendAsync(frames);
+                    return;
+                }
+            }
+
+            if (payloadSize <= kMaxFramePayloadSize)
+            {
+                target->SendAsync(MakeFrame(payload, id, payloadSize));
+            }
+            else
+            {
+                // 프레임 사이에 다른 패킷이 끼지 않도록 한 번에 송신
+                target->SendAsync(MakeFrames(payload, id, payloadSize));
+            }
+        }
+
+        // 페이로드 크기는 클라이언트 입력에 따라 달라질 수 있으므로 넘치면 크래시 대신 기록하고 버림
+        static Bool IsValidMessageSize(PacketId id, Int64 payloadSize)
+        {
+            if (payloadSize + kPacketHeaderSize > kMaxMessageSize)
+            {
+                LOG_ERROR(Network, TEXT_8("Packet[{}]: Payload too large for a message: {}"), static_cast_16(id), payloadSize);
+                return false;
+            }
+
+            return true;
+        }
+
+        template<typename TPayload>
+        static SharedPtr<core::SendBuffer> MakeFrame(const TPayload& payload, PacketId id, Int64 payloadSize)
         {
             using namespace core;
 
-            const Int16 payloadSize = static_cast_16(payload.ByteSizeLong());
-            const Int16 packetSize = sizeof_16(PacketHeader) + payloadSize;
+            ASSERT_CRASH_DEBUG(payloadSize <= kMaxFramePayloadSize, "PAYLOAD_TOO_LARGE");
+
+            const Int32 packetSize = kPacketHeaderSize + static_cast_32(payloadSize);
             SharedPtr<SendBuffer> buffer = gSendChunkPool->Alloc(packetSize);
 
             // 헤더 설정
             PacketHeader* header = reinterpret_cast<PacketHeader*>(buffer->GetBuffer());
             header->size = packetSize;
             header->id = id;
+            header->flags = 0;
 
             // 페이로드 직렬화
-            ASSERT_CRASH(payload.SerializeToArray(header + 1, payloadSize), "SERIALIZE_TO_ARRAY_FAILED");
+            ASSERT_CRASH(payload.SerializeToArray(header + 1, static_cast_32(payloadSize)), "SERIALIZE_TO_ARRAY_FAILED");
             buffer->OnWritten(packetSize);
 
             return buffer;
         }
 
-    private:
+        // 중간 버퍼 없이 송신 청크의 프레임들에 바로 직렬화
         template<typename TPayload>
-        static void Send(const SharedPtr<core::Session>& target, const TPayload& payload, PacketId id)
+        static Vector<SharedPtr<core::SendBuffer>> MakeFrames(const TPayload& payload, PacketId id, Int64 payloadSize)
         {
-            target->SendAsync(MakeSendBuffer(payload, id));
+            ASSERT_CRASH_DEBUG(payloadSize + kPacketHeaderSize <= kMaxMessageSize, "PAYLOAD_TOO_LARGE");
+
+            FrameOutputStream stream(id, payloadSize);
+            {
+                // ByteSizeLong()으로 계산해 둔 크기를 사용해서 직렬화
+                google::protobuf::io::CodedOutputStream output(&stream);
+                payload.SerializeWithCachedSizes(&output);
+                ASSERT_CRASH(!output.HadError(), "SERIALIZE_TO_STREAM_FAILED");
+            }
+
+            Vector<SharedPtr<core::SendBuffer>> frames;
+            ASSERT_CRASH(stream.Finish(OUT frames), "SERIALIZE_TO_STREAM_FAILED");
+
+            return frames;
+        }
+
+        // 스레드별 버퍼에 직렬화한 뒤 압축된 프레임들을 생성 (압축 효과가 없으면 빈 목록)
+        template<typename TPayload>
+        static Vector<SharedPtr<core::SendBuffer>> MakeCompressedFrames(const TPayload& payload, PacketId id, Int64 payloadSize)
+        {
+            ASSERT_CRASH_DEBUG(payloadSize + kPacketHeaderSize <= kMaxMessageSize, "PAYLOAD_TOO_LARGE");
+
+            thread_local Vector<Byte> tScratch;
+            tScratch.resize(payloadSize);
+            ASSERT_CRASH(payload.SerializeToArray(tScratch.data(), static_cast_32(payloadSize)), "SERIALIZE_TO_ARRAY_FAILED");
+
+            return PacketCompressor::GetInstance().Compress(id, tScratch.data(), payloadSize);
         }
     };
 } // namespace proto